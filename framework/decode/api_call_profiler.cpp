@@ -0,0 +1,358 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/api_call_profiler.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+thread_local ApiCallProfiler::ThreadState* ApiCallProfiler::thread_state_       = nullptr;
+thread_local ApiCallProfiler*              ApiCallProfiler::thread_state_owner_ = nullptr;
+
+static size_t GetStatsIndex(format::ApiCallId call_id)
+{
+    // API call IDs are unique within an API family, and replay only decodes a single family.
+    return static_cast<size_t>(call_id) & 0xffff;
+}
+
+static size_t GetHistogramBucket(uint64_t ticks)
+{
+    size_t bucket = 0;
+    while ((ticks >>= 1) != 0)
+    {
+        ++bucket;
+    }
+    return std::min(bucket, ApiCallProfiler::kHistogramBucketCount - 1);
+}
+
+static std::string GetCallName(format::ApiCallId call_id, const char* call_name)
+{
+    if (call_name != nullptr)
+    {
+        return call_name;
+    }
+
+    return format::GetApiCallName(call_id);
+}
+
+ApiCallProfiler::ApiCallProfiler(bool record_trace_events) :
+    record_trace_events_(record_trace_events), begin_ticks_(ReadTicks()),
+    begin_time_(static_cast<int64_t>(util::datetime::GetTimestamp()))
+{}
+
+ApiCallProfiler::~ApiCallProfiler()
+{
+    // Prevent the current thread from using its cached state pointer with a new profiler that is allocated at the same
+    // address.  Other threads are expected to have finished processing before the profiler is destroyed.
+    if (thread_state_owner_ == this)
+    {
+        thread_state_       = nullptr;
+        thread_state_owner_ = nullptr;
+    }
+}
+
+ApiCallProfiler::ThreadState* ApiCallProfiler::CreateThreadState()
+{
+    std::lock_guard<std::mutex> lock(thread_states_mutex_);
+
+    std::unique_ptr<ThreadState> state = std::make_unique<ThreadState>();
+    state->thread_index                = static_cast<uint32_t>(thread_states_.size());
+
+    if (record_trace_events_)
+    {
+        state->trace_events.reserve(64 * 1024);
+    }
+
+    thread_states_.emplace_back(std::move(state));
+    return thread_states_.back().get();
+}
+
+void ApiCallProfiler::RecordApiCall(ThreadState* state, uint64_t call_end)
+{
+    uint64_t total_ticks  = call_end - state->call_begin;
+    uint64_t decode_ticks = total_ticks;
+    uint64_t driver_ticks = 0;
+
+    if (state->driver_end > state->driver_begin)
+    {
+        driver_ticks = state->driver_end - state->driver_begin;
+    }
+
+    if (state->consumer_begin != 0)
+    {
+        decode_ticks = state->consumer_begin - state->call_begin;
+    }
+
+    size_t index = GetStatsIndex(state->call_id);
+    if (index >= state->stats.size())
+    {
+        state->stats.resize(index + 1);
+    }
+
+    CallStats& stats = state->stats[index];
+    stats.call_id    = state->call_id;
+    if (state->call_name != nullptr)
+    {
+        stats.call_name = state->call_name;
+    }
+
+    ++stats.count;
+    stats.total_ticks += total_ticks;
+    stats.decode_ticks += decode_ticks;
+    stats.driver_ticks += driver_ticks;
+    stats.mapping_ticks += (total_ticks - std::min(total_ticks, decode_ticks + driver_ticks));
+    stats.max_ticks = std::max(stats.max_ticks, total_ticks);
+    ++stats.histogram[GetHistogramBucket(total_ticks)];
+
+    if (record_trace_events_ && (state->trace_events.size() < kMaxTraceEventsPerThread))
+    {
+        state->trace_events.push_back(
+            { state->call_id, state->call_begin, call_end, state->driver_begin, state->driver_end });
+    }
+}
+
+std::vector<ApiCallProfiler::CallStats> ApiCallProfiler::MergeStats() const
+{
+    std::vector<CallStats> merged;
+
+    std::lock_guard<std::mutex> lock(thread_states_mutex_);
+    for (const auto& state : thread_states_)
+    {
+        if (state->stats.size() > merged.size())
+        {
+            merged.resize(state->stats.size());
+        }
+
+        for (size_t i = 0; i < state->stats.size(); ++i)
+        {
+            const CallStats& source = state->stats[i];
+            CallStats&       target = merged[i];
+
+            if (source.count > 0)
+            {
+                target.call_id = source.call_id;
+                if (source.call_name != nullptr)
+                {
+                    target.call_name = source.call_name;
+                }
+
+                target.count += source.count;
+                target.total_ticks += source.total_ticks;
+                target.decode_ticks += source.decode_ticks;
+                target.mapping_ticks += source.mapping_ticks;
+                target.driver_ticks += source.driver_ticks;
+                target.max_ticks = std::max(target.max_ticks, source.max_ticks);
+
+                for (size_t bucket = 0; bucket < kHistogramBucketCount; ++bucket)
+                {
+                    target.histogram[bucket] += source.histogram[bucket];
+                }
+            }
+        }
+    }
+
+    merged.erase(std::remove_if(merged.begin(), merged.end(), [](const CallStats& stats) { return stats.count == 0; }),
+                 merged.end());
+
+    return merged;
+}
+
+double ApiCallProfiler::GetNanosecondsPerTick() const
+{
+#if defined(GFXRECON_PROFILER_USE_TSC)
+    // Calibrate the time stamp counter against the monotonic clock over the lifetime of the profiler.
+    uint64_t elapsed_ticks = ReadTicks() - begin_ticks_;
+    int64_t  elapsed_time  = static_cast<int64_t>(util::datetime::GetTimestamp()) - begin_time_;
+
+    if ((elapsed_ticks > 0) && (elapsed_time > 0))
+    {
+        return static_cast<double>(elapsed_time) / static_cast<double>(elapsed_ticks);
+    }
+#endif
+
+    return 1.0;
+}
+
+void ApiCallProfiler::WriteSummary() const
+{
+    std::vector<CallStats> stats         = MergeStats();
+    double                 ns_per_tick   = GetNanosecondsPerTick();
+    double                 ms_per_tick   = ns_per_tick / 1000000.0;
+    double                 us_per_tick   = ns_per_tick / 1000.0;
+    uint64_t               total_calls   = 0;
+    uint64_t               total_ticks   = 0;
+    uint64_t               decode_ticks  = 0;
+    uint64_t               mapping_ticks = 0;
+    uint64_t               driver_ticks  = 0;
+
+    std::sort(stats.begin(), stats.end(), [](const CallStats& lhs, const CallStats& rhs) {
+        return lhs.total_ticks > rhs.total_ticks;
+    });
+
+    for (const auto& entry : stats)
+    {
+        total_calls += entry.count;
+        total_ticks += entry.total_ticks;
+        decode_ticks += entry.decode_ticks;
+        mapping_ticks += entry.mapping_ticks;
+        driver_ticks += entry.driver_ticks;
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nAPI call profile:");
+    GFXRECON_WRITE_CONSOLE("\tTotal calls: %" PRIu64, total_calls);
+    GFXRECON_WRITE_CONSOLE("\tTotal time: %.3f ms (decode %.3f ms, handle mapping %.3f ms, driver %.3f ms)",
+                           total_ticks * ms_per_tick,
+                           decode_ticks * ms_per_tick,
+                           mapping_ticks * ms_per_tick,
+                           driver_ticks * ms_per_tick);
+    GFXRECON_WRITE_CONSOLE("");
+    GFXRECON_WRITE_CONSOLE("%10s %8s %12s %12s %12s %12s %10s %10s %10s  %s",
+                           "Calls",
+                           "Time %",
+                           "Total ms",
+                           "Decode ms",
+                           "Mapping ms",
+                           "Driver ms",
+                           "Avg us",
+                           "P99 us",
+                           "Max us",
+                           "Name");
+
+    for (const auto& entry : stats)
+    {
+        // Report the upper bound of the histogram bucket containing the 99th percentile.
+        uint64_t p99_threshold = entry.count - (entry.count / 100);
+        uint64_t accumulated   = 0;
+        size_t   p99_bucket    = 0;
+        for (; p99_bucket < kHistogramBucketCount; ++p99_bucket)
+        {
+            accumulated += entry.histogram[p99_bucket];
+            if (accumulated >= p99_threshold)
+            {
+                break;
+            }
+        }
+
+        double p99_ticks = std::min(static_cast<double>(2ull << p99_bucket), static_cast<double>(entry.max_ticks));
+
+        GFXRECON_WRITE_CONSOLE("%10" PRIu64 " %8.2f %12.3f %12.3f %12.3f %12.3f %10.2f %10.2f %10.2f  %s",
+                               entry.count,
+                               (total_ticks > 0) ? (100.0 * entry.total_ticks / total_ticks) : 0.0,
+                               entry.total_ticks * ms_per_tick,
+                               entry.decode_ticks * ms_per_tick,
+                               entry.mapping_ticks * ms_per_tick,
+                               entry.driver_ticks * ms_per_tick,
+                               (entry.total_ticks * us_per_tick) / entry.count,
+                               p99_ticks * us_per_tick,
+                               entry.max_ticks * us_per_tick,
+                               GetCallName(entry.call_id, entry.call_name).c_str());
+    }
+}
+
+bool ApiCallProfiler::WriteTraceFile(const std::string& filename) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open profiler trace file %s", filename.c_str());
+        return false;
+    }
+
+    std::vector<CallStats> stats       = MergeStats();
+    double                 us_per_tick = GetNanosecondsPerTick() / 1000.0;
+    bool                   first_event = true;
+
+    // Trace events only carry the call ID, so build a lookup table for the names recorded with the statistics.
+    std::vector<const char*> call_names;
+    for (const auto& entry : stats)
+    {
+        size_t index = GetStatsIndex(entry.call_id);
+        if (index >= call_names.size())
+        {
+            call_names.resize(index + 1, nullptr);
+        }
+        call_names[index] = entry.call_name;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    std::lock_guard<std::mutex> lock(thread_states_mutex_);
+    for (const auto& state : thread_states_)
+    {
+        if (state->trace_events.size() == kMaxTraceEventsPerThread)
+        {
+            GFXRECON_LOG_WARNING("Profiler trace for thread %u was truncated after %" PRIu64 " API calls",
+                                 state->thread_index,
+                                 static_cast<uint64_t>(kMaxTraceEventsPerThread));
+        }
+
+        for (const auto& event : state->trace_events)
+        {
+            size_t      index = GetStatsIndex(event.call_id);
+            std::string name  = GetCallName(event.call_id, (index < call_names.size()) ? call_names[index] : nullptr);
+
+            fprintf(file,
+                    "%s\n{\"name\":\"%s\",\"cat\":\"api\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    first_event ? "" : ",",
+                    name.c_str(),
+                    state->thread_index,
+                    (event.call_begin - begin_ticks_) * us_per_tick,
+                    (event.call_end - event.call_begin) * us_per_tick);
+
+            if (event.driver_end > event.driver_begin)
+            {
+                fprintf(file,
+                        ",\n{\"name\":\"driver\",\"cat\":\"driver\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,"
+                        "\"dur\":%.3f}",
+                        state->thread_index,
+                        (event.driver_begin - begin_ticks_) * us_per_tick,
+                        (event.driver_end - event.driver_begin) * us_per_tick);
+            }
+
+            first_event = false;
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+
+    bool success = (ferror(file) == 0);
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write profiler trace file %s", filename.c_str());
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
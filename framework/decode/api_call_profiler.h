@@ -0,0 +1,180 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_API_CALL_PROFILER_H
+#define GFXRECON_DECODE_API_CALL_PROFILER_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/date_time.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define GFXRECON_PROFILER_USE_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define GFXRECON_PROFILER_USE_TSC
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Records per-ApiCallId call counts and the time spent decoding parameters, mapping handles, and calling the driver
+// during replay.  The file processor brackets each function call with BeginApiCall()/EndApiCall() and the replay
+// consumer marks the start of its Process_* function and the driver call that it makes.  Time that is not spent in
+// the consumer is attributed to decode, and consumer time that is not spent in the driver call is attributed to handle
+// mapping.  Statistics are accumulated per thread without locking, and are only merged when a report is written.
+class ApiCallProfiler
+{
+  public:
+    ApiCallProfiler(bool record_trace_events);
+
+    ~ApiCallProfiler();
+
+    void BeginApiCall(format::ApiCallId call_id)
+    {
+        ThreadState* state    = GetThreadState();
+        state->call_id        = call_id;
+        state->call_name      = nullptr;
+        state->consumer_begin = 0;
+        state->driver_begin   = 0;
+        state->driver_end     = 0;
+        state->call_begin     = ReadTicks();
+    }
+
+    void EndApiCall()
+    {
+        uint64_t     call_end = ReadTicks();
+        ThreadState* state    = GetThreadState();
+        RecordApiCall(state, call_end);
+    }
+
+    void BeginConsumerCall(const char* call_name)
+    {
+        ThreadState* state    = GetThreadState();
+        state->call_name      = call_name;
+        state->consumer_begin = ReadTicks();
+    }
+
+    void BeginDriverCall() { GetThreadState()->driver_begin = ReadTicks(); }
+
+    void EndDriverCall() { GetThreadState()->driver_end = ReadTicks(); }
+
+    // Writes a table of the profiled API calls, sorted by total time, to the console.
+    void WriteSummary() const;
+
+    // Writes the recorded API calls in the Chrome trace event format, for use with chrome://tracing or Perfetto.
+    bool WriteTraceFile(const std::string& filename) const;
+
+  public:
+    // Histogram buckets are powers of two, in timer ticks.  The last bucket holds all calls of 2^31 ticks or longer.
+    static const size_t kHistogramBucketCount = 32;
+
+  private:
+    struct CallStats
+    {
+        format::ApiCallId call_id{ format::ApiCallId::ApiCall_Unknown };
+        const char*       call_name{ nullptr };
+        uint64_t          count{ 0 };
+        uint64_t          total_ticks{ 0 };
+        uint64_t          decode_ticks{ 0 };
+        uint64_t          mapping_ticks{ 0 };
+        uint64_t          driver_ticks{ 0 };
+        uint64_t          max_ticks{ 0 };
+        uint64_t          histogram[kHistogramBucketCount]{};
+    };
+
+    struct TraceEvent
+    {
+        format::ApiCallId call_id;
+        uint64_t          call_begin;
+        uint64_t          call_end;
+        uint64_t          driver_begin;
+        uint64_t          driver_end;
+    };
+
+    struct ThreadState
+    {
+        uint32_t                thread_index{ 0 };
+        format::ApiCallId       call_id{ format::ApiCallId::ApiCall_Unknown };
+        const char*             call_name{ nullptr };
+        uint64_t                call_begin{ 0 };
+        uint64_t                consumer_begin{ 0 };
+        uint64_t                driver_begin{ 0 };
+        uint64_t                driver_end{ 0 };
+        std::vector<CallStats>  stats;
+        std::vector<TraceEvent> trace_events;
+    };
+
+  private:
+    static uint64_t ReadTicks()
+    {
+#if defined(GFXRECON_PROFILER_USE_TSC)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(util::datetime::GetTimestamp());
+#endif
+    }
+
+    ThreadState* GetThreadState()
+    {
+        if ((thread_state_ == nullptr) || (thread_state_owner_ != this))
+        {
+            thread_state_       = CreateThreadState();
+            thread_state_owner_ = this;
+        }
+        return thread_state_;
+    }
+
+    ThreadState* CreateThreadState();
+
+    void RecordApiCall(ThreadState* state, uint64_t call_end);
+
+    std::vector<CallStats> MergeStats() const;
+
+    double GetNanosecondsPerTick() const;
+
+  private:
+    // Limit on the number of trace events recorded per thread, to bound memory use for long captures.
+    static const size_t kMaxTraceEventsPerThread = 4 * 1024 * 1024;
+
+    static thread_local ThreadState*     thread_state_;
+    static thread_local ApiCallProfiler* thread_state_owner_;
+
+    bool                                      record_trace_events_;
+    uint64_t                                  begin_ticks_;
+    int64_t                                   begin_time_;
+    mutable std::mutex                        thread_states_mutex_;
+    std::vector<std::unique_ptr<ThreadState>> thread_states_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_API_CALL_PROFILER_H
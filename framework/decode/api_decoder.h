@@ -39,6 +39,8 @@ struct ApiCallInfo
 {
     uint64_t         index{ 0 };
     format::ThreadId thread_id{ 0 };
+    uint64_t         parameter_size{ 0 }; // Size of the uncompressed parameter data.
+    uint64_t         block_size{ 0 };     // Size of the block in the capture file, after compression.
 };
 
 class ApiDecoder
@@ -0,0 +1,104 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_statistics.h"
+
+#include "format/format_util.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+BlockStatistics::BlockStatistics() : current_block_bytes_(0), current_block_uncompressed_bytes_(0) {}
+
+void BlockStatistics::AddBlock(uint32_t frame_number, const format::BlockHeader& block_header)
+{
+    format::BlockType block_type = format::RemoveCompressedBlockBit(block_header.type);
+
+    current_block_bytes_              = sizeof(block_header) + block_header.size;
+    current_block_uncompressed_bytes_ = current_block_bytes_;
+    current_totals_.clear();
+
+    if (frame_number >= frame_totals_.size())
+    {
+        frame_totals_.resize(static_cast<size_t>(frame_number) + 1);
+    }
+
+    AddCurrentBlock(&block_totals_);
+    AddCurrentBlock(&frame_totals_[frame_number]);
+
+    if (format::IsBlockCompressed(block_header.type))
+    {
+        AddCurrentBlock(&compressed_block_totals_);
+    }
+
+    if (block_type == format::BlockType::kFunctionCallBlock)
+    {
+        AddCurrentBlock(&function_call_totals_);
+    }
+    else if (block_type == format::BlockType::kMetaDataBlock)
+    {
+        AddCurrentBlock(&meta_data_totals_);
+    }
+}
+
+void BlockStatistics::AddFunctionCall(format::ApiCallId call_id)
+{
+    AddCurrentBlock(&api_call_totals_[call_id]);
+}
+
+void BlockStatistics::AddMetaData(format::MetaDataType meta_data_type)
+{
+    AddCurrentBlock(&meta_data_type_totals_[meta_data_type]);
+}
+
+void BlockStatistics::AddFillMemory(format::HandleId memory_id)
+{
+    AddCurrentBlock(&fill_memory_totals_[memory_id]);
+}
+
+void BlockStatistics::AddDecompressedData(uint64_t compressed_size, uint64_t uncompressed_size)
+{
+    // The compressed data is already included in the uncompressed size of the block, and is replaced by the size of
+    // the decompressed data.
+    current_block_uncompressed_bytes_ = (current_block_uncompressed_bytes_ - compressed_size) + uncompressed_size;
+
+    for (auto totals : current_totals_)
+    {
+        totals->uncompressed_bytes = (totals->uncompressed_bytes - compressed_size) + uncompressed_size;
+    }
+}
+
+void BlockStatistics::AddCurrentBlock(Totals* totals)
+{
+    assert(totals != nullptr);
+
+    ++totals->count;
+    totals->bytes += current_block_bytes_;
+    totals->uncompressed_bytes += current_block_uncompressed_bytes_;
+
+    current_totals_.push_back(totals);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
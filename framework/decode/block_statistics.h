@@ -0,0 +1,113 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_STATISTICS_H
+#define GFXRECON_DECODE_BLOCK_STATISTICS_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Records block counts and sizes from the blocks read by the file processor, attributing the size of each block to its
+// frame, its block type, and, where they apply, its API call, meta-data type, and filled memory object.
+//
+// The file processor reports each block when its header is read, followed by the API call ID, meta-data type, and
+// memory ID of the block as they are read.  Blocks initially have an uncompressed size equal to their size in the file,
+// which is increased when compressed block data is decompressed, or when the uncompressed size is read from the header
+// of a compressed function call block that is skipped.  Compressed meta-data blocks that are skipped without being
+// decompressed are reported with their file size.
+class BlockStatistics
+{
+  public:
+    // Number of blocks with their total size in the file and total uncompressed size, including block headers.
+    struct Totals
+    {
+        uint64_t count{ 0 };
+        uint64_t bytes{ 0 };
+        uint64_t uncompressed_bytes{ 0 };
+    };
+
+  public:
+    BlockStatistics();
+
+    void AddBlock(uint32_t frame_number, const format::BlockHeader& block_header);
+
+    // Function call and meta-data blocks restored from a blob reference block are attributed the size of the blob
+    // reference block.
+    void AddFunctionCall(format::ApiCallId call_id);
+
+    void AddMetaData(format::MetaDataType meta_data_type);
+
+    void AddFillMemory(format::HandleId memory_id);
+
+    void AddDecompressedData(uint64_t compressed_size, uint64_t uncompressed_size);
+
+    const Totals& GetBlockTotals() const { return block_totals_; }
+
+    const Totals& GetCompressedBlockTotals() const { return compressed_block_totals_; }
+
+    const Totals& GetFunctionCallBlockTotals() const { return function_call_totals_; }
+
+    const Totals& GetMetaDataBlockTotals() const { return meta_data_totals_; }
+
+    // Totals indexed by the frame number reported by the file processor, which starts at 0.
+    const std::vector<Totals>& GetFrameTotals() const { return frame_totals_; }
+
+    const std::map<format::ApiCallId, Totals>& GetApiCallTotals() const { return api_call_totals_; }
+
+    const std::map<format::MetaDataType, Totals>& GetMetaDataTypeTotals() const { return meta_data_type_totals_; }
+
+    // Totals for fill memory and fill memory reference meta-data blocks, by the ID of the memory object filled.  Only
+    // blocks that are read, rather than skipped, by the file processor are included.
+    const std::map<format::HandleId, Totals>& GetFillMemoryTotals() const { return fill_memory_totals_; }
+
+  private:
+    void AddCurrentBlock(Totals* totals);
+
+  private:
+    // Size of the block currently being processed and the totals that include it, which are updated when its data is
+    // decompressed.
+    uint64_t                               current_block_bytes_;
+    uint64_t                               current_block_uncompressed_bytes_;
+    std::vector<Totals*>                   current_totals_;
+    Totals                                 block_totals_;
+    Totals                                 compressed_block_totals_;
+    Totals                                 function_call_totals_;
+    Totals                                 meta_data_totals_;
+    std::vector<Totals>                    frame_totals_;
+    std::map<format::ApiCallId, Totals>    api_call_totals_;
+    std::map<format::MetaDataType, Totals> meta_data_type_totals_;
+    std::map<format::HandleId, Totals>     fill_memory_totals_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_STATISTICS_H
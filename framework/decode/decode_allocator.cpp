@@ -26,7 +26,9 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+const size_t                  DecodeAllocator::kAllocatorBlockSize;
+const size_t                  DecodeAllocator::kMaxSpareAllocatorCount;
+thread_local DecodeAllocator* DecodeAllocator::instance_{ nullptr };
 
 void DecodeAllocator::Begin()
 {
@@ -41,14 +43,44 @@ void DecodeAllocator::Begin()
 void DecodeAllocator::End()
 {
     assert((instance_ != nullptr) && instance_->can_allocate_);
-    instance_->allocator_.Clear(false);
+    instance_->allocator_->Clear(false);
     instance_->can_allocate_ = false;
 }
 
+std::unique_ptr<util::MonotonicAllocator> DecodeAllocator::DetachAllocations()
+{
+    assert((instance_ != nullptr) && instance_->can_allocate_);
+    std::unique_ptr<util::MonotonicAllocator> allocations = std::move(instance_->allocator_);
+
+    if (!instance_->spare_allocators_.empty())
+    {
+        instance_->allocator_ = std::move(instance_->spare_allocators_.back());
+        instance_->spare_allocators_.pop_back();
+    }
+    else
+    {
+        instance_->allocator_ = std::make_unique<util::MonotonicAllocator>(kAllocatorBlockSize);
+    }
+
+    return allocations;
+}
+
+void DecodeAllocator::ReleaseDetachedAllocations(std::unique_ptr<util::MonotonicAllocator> allocations)
+{
+    if ((allocations != nullptr) && (instance_ != nullptr) &&
+        (instance_->spare_allocators_.size() < kMaxSpareAllocatorCount))
+    {
+        // The memory blocks are kept for reuse, while oversized allocations are freed.
+        allocations->Clear(false);
+        instance_->spare_allocators_.emplace_back(std::move(allocations));
+    }
+}
+
 void DecodeAllocator::FreeSystemMemory()
 {
     assert((instance_ != nullptr) && !instance_->can_allocate_);
-    instance_->allocator_.Clear(true);
+    instance_->allocator_->Clear(true);
+    instance_->spare_allocators_.clear();
 }
 
 void DecodeAllocator::DestroyInstance()
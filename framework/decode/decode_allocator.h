@@ -27,6 +27,9 @@
 #include "util/defines.h"
 #include "util/monotonic_allocator.h"
 
+#include <memory>
+#include <vector>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -41,9 +44,17 @@ class DecodeAllocator
     static T* Allocate(size_t count = 1, bool initialize = true)
     {
         assert((instance_ != nullptr) && instance_->can_allocate_);
-        return instance_->can_allocate_ ? instance_->allocator_.Allocate<T>(count, initialize) : nullptr;
+        return instance_->can_allocate_ ? instance_->allocator_->Allocate<T>(count, initialize) : nullptr;
     }
 
+    // Transfers ownership of the allocations made since the last call to Begin to the caller, so that decoded data can
+    // remain valid after End is called.  Must be called between Begin and End.
+    static std::unique_ptr<util::MonotonicAllocator> DetachAllocations();
+
+    // Releases allocations that were transferred by DetachAllocations, keeping a limited number of the released
+    // allocators to be reused by later calls to DetachAllocations.  Must be called by the thread that detached them.
+    static void ReleaseDetachedAllocations(std::unique_ptr<util::MonotonicAllocator> allocations);
+
     // End must be called to release any allocations made since last call to Begin. Currently allocated system memory
     // is re-used for future allocations.
     static void End();
@@ -51,18 +62,22 @@ class DecodeAllocator
     // Free system memory blocks. Must not be called between Begin and End
     static void FreeSystemMemory();
 
-    // Destroy the allocator instance. This will also frees all allocated memory.
+    // Destroy the allocator instance. This will also frees all allocated memory. Each thread that decodes API calls has
+    // its own allocator instance, which must be destroyed by the thread that created it.
     static void DestroyInstance();
 
   private:
-    DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false) {}
+    DecodeAllocator() : allocator_(std::make_unique<util::MonotonicAllocator>(kAllocatorBlockSize)), can_allocate_(false)
+    {}
 
   private:
     static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t     kMaxSpareAllocatorCount{ 16 };
+    static thread_local DecodeAllocator* instance_;
 
-    util::MonotonicAllocator allocator_;
-    bool                     can_allocate_;
+    std::unique_ptr<util::MonotonicAllocator>              allocator_;
+    std::vector<std::unique_ptr<util::MonotonicAllocator>> spare_allocators_;
+    bool                                                   can_allocate_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -26,9 +26,11 @@
 #include "decode/decode_allocator.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
+#include "util/date_time.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <numeric>
 
@@ -37,7 +39,12 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 FileProcessor::FileProcessor() :
     file_header_{}, file_descriptor_(nullptr), current_frame_number_(0), bytes_read_(0),
-    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr), api_call_index_(0)
+    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), profiler_(nullptr),
+    block_statistics_(nullptr), compressor_(nullptr), api_call_index_(0), loop_first_frame_(0), loop_last_frame_(0),
+    loop_count_(0), loop_started_(false), loop_start_position_{}, loop_iteration_start_time_(0),
+    preload_first_frame_(0), preload_last_frame_(0), preloading_(false), preload_active_(false),
+    preload_read_offset_(0), preload_file_end_(0), preload_start_time_(0), preload_end_time_(0),
+    loading_retained_data_(false), blob_block_read_offset_(0), blob_block_active_(false)
 {}
 
 FileProcessor::~FileProcessor()
@@ -88,11 +95,26 @@ bool FileProcessor::Initialize(const std::string& filename)
 
 bool FileProcessor::ProcessNextFrame()
 {
-    bool success = IsFileValid();
+    bool success = preload_active_ || IsFileValid();
 
     if (success)
     {
-        success = ProcessBlocks();
+        if ((preload_first_frame_ > 0) && ((current_frame_number_ + 1) == preload_first_frame_))
+        {
+            success = PreloadFrames();
+        }
+
+        if (success && (loop_count_ > 0) && !loop_started_ && ((current_frame_number_ + 1) == loop_first_frame_))
+        {
+            success = BeginLoopIteration();
+        }
+
+        success = success && ProcessBlocks();
+
+        if (success && loop_started_ && (current_frame_number_ == loop_last_frame_))
+        {
+            success = EndLoopIteration();
+        }
     }
     else
     {
@@ -122,6 +144,358 @@ bool FileProcessor::ProcessAllFrames()
     return (error_state_ == kErrorNone);
 }
 
+bool FileProcessor::IndexFrames(std::vector<FramePosition>* frames, std::vector<uint64_t>* retained_data_offsets)
+{
+    assert((frames != nullptr) && (retained_data_offsets != nullptr));
+
+    if (!IsFileValid())
+    {
+        return false;
+    }
+
+    const int64_t  start_offset     = util::platform::FileTell(file_descriptor_);
+    const uint64_t start_bytes_read = bytes_read_;
+    uint32_t       frame_number     = current_frame_number_;
+    uint64_t       api_call_index   = api_call_index_;
+    bool           frame_start      = true;
+    bool           success          = true;
+
+    format::BlockHeader block_header;
+
+    while (ReadBlockHeader(&block_header))
+    {
+        // The block header has already been read, so the block starts one header before the current position.
+        const uint64_t block_offset = bytes_read_ - sizeof(block_header);
+
+        if (frame_start)
+        {
+            frames->push_back({ frame_number, block_offset, api_call_index });
+            frame_start = false;
+        }
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
+        {
+            format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+
+            success = ReadBytes(&api_call_id, sizeof(api_call_id)) &&
+                      SkipBytes(static_cast<size_t>(block_header.size) - sizeof(api_call_id));
+
+            if (success)
+            {
+                ++api_call_index;
+
+                if (IsFrameDelimiter(api_call_id))
+                {
+                    ++frame_number;
+                    frame_start = true;
+                }
+            }
+        }
+        else if (block_header.type == format::BlockType::kBlobReferenceBlock)
+        {
+            // Blob reference blocks are never frame delimiters, as their block data is not restored to read the API
+            // call ID, but may contain function calls that must be counted.
+            format::BlockType inner_block_type = format::BlockType::kUnknownBlock;
+
+            success = ReadBytes(&inner_block_type, sizeof(inner_block_type)) &&
+                      SkipBytes(static_cast<size_t>(block_header.size) - sizeof(inner_block_type));
+
+            if (success && (inner_block_type == format::BlockType::kFunctionCallBlock))
+            {
+                ++api_call_index;
+            }
+        }
+        else if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock)
+        {
+            format::MetaDataId meta_data_id = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_None,
+                                                                     format::MetaDataType::kUnknownMetaDataType);
+            size_t             read_size    = sizeof(meta_data_id);
+
+            success = ReadBytes(&meta_data_id, sizeof(meta_data_id));
+
+            if (success && (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kStoreBlobCommand))
+            {
+                // Stored blobs are retained for the blob reference blocks that follow.
+                retained_data_offsets->push_back(block_offset);
+            }
+            else if (success &&
+                     (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryReferenceCommand))
+            {
+                // Only the commands that include data retain content for the commands that reference it.
+                format::FillMemoryReferenceCommandHeader header;
+                size_t skip_size = sizeof(header.thread_id) + sizeof(header.memory_id) + sizeof(header.memory_offset) +
+                                   sizeof(header.memory_size) + sizeof(header.content_id);
+
+                success = SkipBytes(skip_size) && ReadBytes(&header.data_size, sizeof(header.data_size));
+                read_size += skip_size + sizeof(header.data_size);
+
+                if (success && (header.data_size > 0))
+                {
+                    retained_data_offsets->push_back(block_offset);
+                }
+            }
+
+            success = success && SkipBytes(static_cast<size_t>(block_header.size) - read_size);
+        }
+        else
+        {
+            success = SkipBytes(static_cast<size_t>(block_header.size));
+        }
+
+        if (!success)
+        {
+            break;
+        }
+    }
+
+    if (ferror(file_descriptor_))
+    {
+        GFXRECON_LOG_ERROR("Failed to read block data while indexing frames");
+        error_state_ = kErrorReadingFile;
+        success      = false;
+    }
+    else if (!success)
+    {
+        // Consistent with ProcessBlocks(), a truncated block at the end of the file is not treated as an error.
+        GFXRECON_LOG_WARNING("Incomplete block at end of file");
+        success = true;
+    }
+
+    // Return to the position that indexing started from; fseek also clears the EOF indicator.
+    bytes_read_ = start_bytes_read;
+    if (!util::platform::FileSeek(file_descriptor_, start_offset, util::platform::FileSeekSet))
+    {
+        error_state_ = kErrorSeekingFile;
+        success      = false;
+    }
+
+    return success;
+}
+
+bool FileProcessor::SeekToFrame(const FramePosition& position)
+{
+    auto preload_entry = preload_frame_offsets_.find(position.file_offset);
+    bool preloaded     = (preload_entry != preload_frame_offsets_.end());
+    bool success       = false;
+
+    if (preloaded)
+    {
+        // Reads continue from the preload buffer, and fall back to the file position following the preloaded frames
+        // when the buffer is exhausted.
+        success = (file_descriptor_ != nullptr) &&
+                  util::platform::FileSeek(
+                      file_descriptor_, static_cast<int64_t>(preload_file_end_), util::platform::FileSeekSet);
+    }
+    else
+    {
+        success = (file_descriptor_ != nullptr) &&
+                  util::platform::FileSeek(
+                      file_descriptor_, static_cast<int64_t>(position.file_offset), util::platform::FileSeekSet);
+    }
+
+    if (success)
+    {
+        preload_active_      = preloaded;
+        preload_read_offset_ = preloaded ? preload_entry->second : 0;
+
+        current_frame_number_ = position.frame_number;
+        api_call_index_       = position.api_call_index;
+        bytes_read_           = position.file_offset;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to the start of frame %u", position.frame_number);
+        error_state_ = kErrorSeekingFile;
+    }
+
+    return success;
+}
+
+bool FileProcessor::SeekToFrame(const FramePosition& position, const std::vector<uint64_t>& retained_data_offsets)
+{
+    // Blocks preceding the current read position have already been processed, and have retained their data.
+    auto first   = std::lower_bound(retained_data_offsets.begin(), retained_data_offsets.end(), bytes_read_);
+    auto last    = std::lower_bound(first, retained_data_offsets.end(), position.file_offset);
+    bool success = true;
+
+    if (first != last)
+    {
+        BlockStatistics* block_statistics = block_statistics_;
+
+        // The loaded blocks are not part of the processed frames, and are not included in the block statistics.
+        block_statistics_      = nullptr;
+        loading_retained_data_ = true;
+        preload_active_        = false;
+
+        for (auto entry = first; success && (entry != last); ++entry)
+        {
+            success = LoadRetainedData(*entry);
+        }
+
+        block_statistics_      = block_statistics;
+        loading_retained_data_ = false;
+    }
+
+    return success && SeekToFrame(position);
+}
+
+bool FileProcessor::LoadRetainedData(uint64_t block_offset)
+{
+    format::BlockHeader block_header;
+    format::MetaDataId  meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kUnknownMetaDataType);
+
+    if ((file_descriptor_ == nullptr) ||
+        !util::platform::FileSeek(file_descriptor_, static_cast<int64_t>(block_offset), util::platform::FileSeekSet))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to the block at file offset %" PRIu64, block_offset);
+        error_state_ = kErrorSeekingFile;
+        return false;
+    }
+
+    bytes_read_ = block_offset;
+
+    if (!ReadBlockHeader(&block_header) ||
+        (format::RemoveCompressedBlockBit(block_header.type) != format::BlockType::kMetaDataBlock) ||
+        !ReadBytes(&meta_data_id, sizeof(meta_data_id)))
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
+        return false;
+    }
+
+    return ProcessMetaData(block_header, meta_data_id);
+}
+
+void FileProcessor::SetLoopFrames(uint32_t first_frame, uint32_t last_frame, uint32_t loop_count)
+{
+    assert((first_frame > 0) && (first_frame <= last_frame));
+
+    loop_first_frame_ = first_frame;
+    loop_last_frame_  = last_frame;
+    loop_count_       = loop_count;
+    loop_started_     = false;
+    loop_iteration_times_.clear();
+}
+
+bool FileProcessor::BeginLoopIteration()
+{
+    // The number of bytes read is the file offset of the next block, including when reading from preloaded frames.
+    loop_start_position_ = { current_frame_number_, bytes_read_, api_call_index_ };
+    loop_started_        = true;
+
+    if (loop_check_begin_handler_)
+    {
+        loop_check_begin_handler_();
+    }
+
+    loop_iteration_start_time_ = util::datetime::GetTimestamp();
+
+    return true;
+}
+
+bool FileProcessor::EndLoopIteration()
+{
+    int64_t end_time = util::datetime::GetTimestamp();
+
+    loop_iteration_times_.push_back(util::datetime::DiffTimestamps(loop_iteration_start_time_, end_time));
+
+    GFXRECON_LOG_INFO("Completed loop iteration %u of %u for frames %u-%u",
+                      static_cast<uint32_t>(loop_iteration_times_.size()),
+                      loop_count_,
+                      loop_first_frame_,
+                      loop_last_frame_);
+
+    if ((loop_iteration_times_.size() == 1) && loop_check_end_handler_ && !loop_check_end_handler_())
+    {
+        // Replaying the range again would create its objects again, without the matching destroy calls.
+        loop_count_ = 0;
+        return true;
+    }
+
+    if (loop_iteration_times_.size() >= loop_count_)
+    {
+        // The range has been replayed the requested number of times; continue with the rest of the file.
+        loop_count_ = 0;
+        return true;
+    }
+
+    // The next iteration replays the range's fill memory commands along with its API calls, restoring the mapped
+    // memory contents that the range uploads.
+    loop_iteration_start_time_ = util::datetime::GetTimestamp();
+    return SeekToFrame(loop_start_position_);
+}
+
+void FileProcessor::SetPreloadFrames(uint32_t first_frame, uint32_t last_frame)
+{
+    assert((first_frame > 0) && (first_frame <= last_frame));
+
+    preload_first_frame_ = first_frame;
+    preload_last_frame_  = last_frame;
+}
+
+bool FileProcessor::PreloadFrames()
+{
+    GFXRECON_LOG_INFO("Preloading frames %u-%u", preload_first_frame_, preload_last_frame_);
+
+    preload_start_time_ = util::datetime::GetTimestamp();
+
+    // The blocks are processed without decoders, which copies each block to the preload buffer with the same sequence
+    // of reads that will be used to process it from the buffer.  Compressed data is stored in its decompressed form.
+    std::vector<ApiDecoder*> decoders           = std::move(decoders_);
+    AnnotationHandler*       annotation_handler = annotation_handler_;
+    ApiCallProfiler*         profiler           = profiler_;
+    BlockStatistics*         block_statistics   = block_statistics_;
+    uint32_t                 frame_number       = current_frame_number_;
+    uint64_t                 api_call_index     = api_call_index_;
+    uint64_t                 start_offset       = bytes_read_;
+    bool                     success            = true;
+
+    decoders_.clear();
+    annotation_handler_ = nullptr;
+    profiler_           = nullptr;
+    block_statistics_   = nullptr;
+    preloading_         = true;
+
+    preload_buffer_.clear();
+    preload_frame_offsets_.clear();
+
+    while (success && (current_frame_number_ < preload_last_frame_) && IsFileValid())
+    {
+        preload_frame_offsets_[bytes_read_] = preload_buffer_.size();
+        success                             = ProcessBlocks();
+    }
+
+    preloading_         = false;
+    decoders_           = std::move(decoders);
+    annotation_handler_ = annotation_handler;
+    profiler_           = profiler;
+    block_statistics_   = block_statistics;
+
+    if (error_state_ != kErrorNone)
+    {
+        return false;
+    }
+
+    // Processing resumes at the start of the preloaded frames, while the file position remains at the end of them.
+    preload_file_end_     = bytes_read_;
+    preload_active_       = !preload_buffer_.empty();
+    preload_read_offset_  = 0;
+    current_frame_number_ = frame_number;
+    api_call_index_       = api_call_index;
+    bytes_read_           = start_offset;
+    preload_first_frame_  = 0;
+    preload_end_time_     = util::datetime::GetTimestamp();
+
+    GFXRECON_LOG_INFO("Preloaded %" PRIu64 " bytes in %f seconds",
+                      static_cast<uint64_t>(preload_buffer_.size()),
+                      util::datetime::ConvertTimestampToSeconds(
+                          util::datetime::DiffTimestamps(preload_start_time_, preload_end_time_)));
+
+    return true;
+}
+
 bool FileProcessor::ProcessFileHeader()
 {
     bool success = false;
@@ -191,6 +565,11 @@ bool FileProcessor::ProcessBlocks()
 
         if (success)
         {
+            if (block_statistics_ != nullptr)
+            {
+                block_statistics_->AddBlock(current_frame_number_, block_header);
+            }
+
             if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
             {
                 format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
@@ -246,6 +625,12 @@ bool FileProcessor::ProcessBlocks()
                     HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
                 }
             }
+            else if (block_header.type == format::BlockType::kBlobReferenceBlock)
+            {
+                // Consistent with IndexFrames(), which does not restore the block data, a function call restored from
+                // a blob reference block is never treated as a frame delimiter.
+                success = ProcessBlobReferenceBlock(block_header);
+            }
             else if (block_header.type == format::BlockType::kAnnotation)
             {
                 if (annotation_handler_ != nullptr)
@@ -326,22 +711,66 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
     // This should only be null if initialization failed.
     assert(compressor_ != nullptr);
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    // Blob reference blocks with compressed data are rejected by ProcessBlobReferenceBlock().
+    assert(!blob_block_active_);
+
+    if (parameter_buffer_.size() < expected_uncompressed_size)
     {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
+        parameter_buffer_.resize(expected_uncompressed_size);
     }
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    if (preload_active_)
     {
-        if (parameter_buffer_.size() < expected_uncompressed_size)
+        // Preloaded data was decompressed when it was loaded, and is only stored in the buffer when the complete
+        // compressed data was read.  The number of bytes read advances by the size of the compressed data in the file.
+        if (expected_uncompressed_size > (preload_buffer_.size() - preload_read_offset_))
+        {
+            return false;
+        }
+
+        util::platform::MemoryCopy(parameter_buffer_.data(),
+                                   parameter_buffer_.size(),
+                                   preload_buffer_.data() + preload_read_offset_,
+                                   expected_uncompressed_size);
+        preload_read_offset_ += expected_uncompressed_size;
+        bytes_read_ += compressed_buffer_size;
+
+        if (preload_read_offset_ == preload_buffer_.size())
+        {
+            EndPreloadedReads();
+        }
+
+        if (block_statistics_ != nullptr)
         {
-            parameter_buffer_.resize(expected_uncompressed_size);
+            block_statistics_->AddDecompressedData(compressed_buffer_size, expected_uncompressed_size);
         }
 
+        *uncompressed_buffer_size = expected_uncompressed_size;
+        return true;
+    }
+
+    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    {
+        compressed_parameter_buffer_.resize(compressed_buffer_size);
+    }
+
+    if (ReadFileBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    {
         size_t uncompressed_size = compressor_->Decompress(
             compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
+            if (preloading_)
+            {
+                preload_buffer_.insert(
+                    preload_buffer_.end(), parameter_buffer_.begin(), parameter_buffer_.begin() + uncompressed_size);
+            }
+
+            if (block_statistics_ != nullptr)
+            {
+                block_statistics_->AddDecompressedData(compressed_buffer_size, uncompressed_size);
+            }
+
             *uncompressed_buffer_size = uncompressed_size;
             return true;
         }
@@ -350,20 +779,137 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
 }
 
 bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
+{
+    if (blob_block_active_)
+    {
+        return ReadBlobBlockBytes(buffer, buffer_size);
+    }
+
+    if (preload_active_)
+    {
+        return ReadPreloadedBytes(buffer, buffer_size);
+    }
+
+    bool success = ReadFileBytes(buffer, buffer_size);
+
+    if (success && preloading_)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buffer);
+        preload_buffer_.insert(preload_buffer_.end(), bytes, bytes + buffer_size);
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadFileBytes(void* buffer, size_t buffer_size)
 {
     size_t bytes_read = util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
     bytes_read_ += bytes_read;
     return (bytes_read == buffer_size);
 }
 
+bool FileProcessor::ReadPreloadedBytes(void* buffer, size_t buffer_size)
+{
+    assert(preload_read_offset_ <= preload_buffer_.size());
+
+    size_t copy_size = std::min(buffer_size, preload_buffer_.size() - preload_read_offset_);
+
+    util::platform::MemoryCopy(buffer, buffer_size, preload_buffer_.data() + preload_read_offset_, copy_size);
+    preload_read_offset_ += copy_size;
+    bytes_read_ += copy_size;
+
+    if (preload_read_offset_ == preload_buffer_.size())
+    {
+        EndPreloadedReads();
+    }
+
+    if (copy_size < buffer_size)
+    {
+        return ReadFileBytes(reinterpret_cast<uint8_t*>(buffer) + copy_size, buffer_size - copy_size);
+    }
+
+    return true;
+}
+
+void FileProcessor::EndPreloadedReads()
+{
+    // The remaining reads are from the file, which is positioned at the end of the preloaded frames.  The number of
+    // bytes read is set to the file position, which also counts data that was read from the file while preloading but
+    // not stored in the buffer, such as the part of an incomplete block at the end of the file.
+    preload_active_ = false;
+    bytes_read_     = preload_file_end_;
+}
+
+bool FileProcessor::ReadBlobBlockBytes(void* buffer, size_t buffer_size)
+{
+    assert(blob_block_read_offset_ <= blob_block_buffer_.size());
+
+    if (buffer_size > (blob_block_buffer_.size() - blob_block_read_offset_))
+    {
+        return false;
+    }
+
+    util::platform::MemoryCopy(
+        buffer, buffer_size, blob_block_buffer_.data() + blob_block_read_offset_, buffer_size);
+    blob_block_read_offset_ += buffer_size;
+
+    return true;
+}
+
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    bool success = false;
 
-    if (success)
+    if (blob_block_active_)
+    {
+        success = (skip_size <= (blob_block_buffer_.size() - blob_block_read_offset_));
+
+        if (success)
+        {
+            blob_block_read_offset_ += skip_size;
+        }
+
+        return success;
+    }
+
+    if (preload_active_)
     {
-        // These technically count as bytes read/processed.
-        bytes_read_ += skip_size;
+        size_t available = preload_buffer_.size() - preload_read_offset_;
+
+        if (skip_size < available)
+        {
+            preload_read_offset_ += skip_size;
+            bytes_read_ += skip_size;
+            return true;
+        }
+
+        preload_read_offset_ = preload_buffer_.size();
+        skip_size -= available;
+        EndPreloadedReads();
+    }
+
+    if (preloading_)
+    {
+        // Skipped data is copied to the preload buffer, so that it can be skipped again when the buffer is processed.
+        size_t offset = preload_buffer_.size();
+        preload_buffer_.resize(offset + skip_size);
+
+        success = ReadFileBytes(preload_buffer_.data() + offset, skip_size);
+
+        if (!success)
+        {
+            preload_buffer_.resize(offset);
+        }
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+
+        if (success)
+        {
+            // These technically count as bytes read/processed.
+            bytes_read_ += skip_size;
+        }
     }
 
     return success;
@@ -389,7 +935,42 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     uint64_t    uncompressed_size     = 0;
     ApiCallInfo call_info             = {};
     call_info.index                   = api_call_index_;
-    bool success                      = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
+
+    if (block_statistics_ != nullptr)
+    {
+        block_statistics_->AddFunctionCall(call_id);
+    }
+
+    if (!IsPreloadActive() && !IsApiCallDecoded(call_id))
+    {
+        // No decoder processes the call, so its parameter data is skipped without being read or decompressed.
+        if ((block_statistics_ != nullptr) && format::IsBlockCompressed(block_header.type))
+        {
+            // The uncompressed size of the parameter data follows the thread ID in the compressed block header.
+            format::ThreadId thread_id = 0;
+
+            if (!ReadBytes(&thread_id, sizeof(thread_id)) || !ReadBytes(&uncompressed_size, sizeof(uncompressed_size)))
+            {
+                HandleBlockReadError(kErrorReadingCompressedBlockHeader, "Failed to read function call block header");
+                return false;
+            }
+
+            parameter_buffer_size -= sizeof(thread_id) + sizeof(uncompressed_size);
+
+            block_statistics_->AddDecompressedData(parameter_buffer_size, uncompressed_size);
+        }
+
+        if (!SkipBytes(parameter_buffer_size))
+        {
+            HandleBlockReadError(kErrorSeekingFile, "Failed to skip function call block data");
+            return false;
+        }
+
+        ++api_call_index_;
+        return true;
+    }
+
+    bool success = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
     if (success)
     {
@@ -437,6 +1018,14 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
 
         if (success)
         {
+            call_info.parameter_size = parameter_buffer_size;
+            call_info.block_size     = block_header.size;
+
+            if (profiler_ != nullptr)
+            {
+                profiler_->BeginApiCall(call_id);
+            }
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
@@ -447,6 +1036,11 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
                 }
             }
 
+            if (profiler_ != nullptr)
+            {
+                profiler_->EndApiCall();
+            }
+
             ++api_call_index_;
         }
     }
@@ -463,6 +1057,28 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     bool success = false;
 
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+
+    if (block_statistics_ != nullptr)
+    {
+        block_statistics_->AddMetaData(meta_data_type);
+    }
+
+    // Blobs are stored for the blob reference blocks that follow, and are always processed.
+    if ((meta_data_type != format::MetaDataType::kStoreBlobCommand) && !IsPreloadActive() && !loading_retained_data_ &&
+        !IsMetaDataDecoded(meta_data_id))
+    {
+        // No decoder processes the meta-data, so its data is skipped without being read or decompressed.
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        if (!SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_data_id)))
+        {
+            HandleBlockReadError(kErrorSeekingFile, "Failed to skip meta-data block data");
+            return false;
+        }
+
+        return true;
+    }
+
     if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
     {
         format::FillMemoryCommandHeader header;
@@ -476,6 +1092,11 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
 
+            if (block_statistics_ != nullptr)
+            {
+                block_statistics_->AddFillMemory(header.memory_id);
+            }
+
             if (format::IsBlockCompressed(block_header.type))
             {
                 size_t uncompressed_size = 0;
@@ -523,6 +1144,160 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryReferenceCommand)
+    {
+        format::FillMemoryReferenceCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+        success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+        success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+        success = success && ReadBytes(&header.content_id, sizeof(header.content_id));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+            if (block_statistics_ != nullptr)
+            {
+                block_statistics_->AddFillMemory(header.memory_id);
+            }
+
+            const std::vector<uint8_t>* content = nullptr;
+
+            if (header.data_size > 0)
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    size_t uncompressed_size = 0;
+                    size_t compressed_size =
+                        static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+                    success = ReadCompressedParameterBuffer(
+                        compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+                }
+                else
+                {
+                    success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                }
+
+                if (success)
+                {
+                    // Retain the content for reference by later fill commands.
+                    auto& stored = fill_memory_content_[header.content_id];
+                    stored.assign(parameter_buffer_.begin(),
+                                  parameter_buffer_.begin() + static_cast<size_t>(header.data_size));
+                    content = &stored;
+                }
+                else
+                {
+                    if (format::IsBlockCompressed(block_header.type))
+                    {
+                        HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                             "Failed to read fill memory reference meta-data block");
+                    }
+                    else
+                    {
+                        HandleBlockReadError(kErrorReadingBlockData,
+                                             "Failed to read fill memory reference meta-data block");
+                    }
+                }
+            }
+            else
+            {
+                auto entry = fill_memory_content_.find(header.content_id);
+                if (entry != fill_memory_content_.end())
+                {
+                    content = &entry->second;
+                }
+                else
+                {
+                    GFXRECON_LOG_WARNING(
+                        "Skipping fill memory reference meta-data block with unknown content ID %" PRIx64,
+                        header.content_id);
+                }
+            }
+
+            if ((content != nullptr) && (content->size() < header.memory_size))
+            {
+                GFXRECON_LOG_WARNING("Skipping fill memory reference meta-data block with content ID %" PRIx64
+                                     " that is smaller than the fill size",
+                                     header.content_id);
+                content = nullptr;
+            }
+
+            if ((content != nullptr) && !loading_retained_data_)
+            {
+                for (auto decoder : decoders_)
+                {
+                    if (decoder->SupportsMetaDataId(meta_data_id))
+                    {
+                        decoder->DispatchFillMemoryCommand(header.thread_id,
+                                                           header.memory_id,
+                                                           header.memory_offset,
+                                                           header.memory_size,
+                                                           content->data());
+                    }
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader,
+                                 "Failed to read fill memory reference meta-data block header");
+        }
+    }
+    else if (meta_data_type == format::MetaDataType::kStoreBlobCommand)
+    {
+        format::StoreBlobCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(header.blob_digest, sizeof(header.blob_digest));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+                size_t compressed_size =
+                    static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+                success = ReadCompressedParameterBuffer(
+                    compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+            }
+            else
+            {
+                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+            }
+
+            if (success)
+            {
+                auto& blob = blob_table_[std::string(reinterpret_cast<const char*>(header.blob_digest),
+                                                     sizeof(header.blob_digest))];
+                blob.assign(parameter_buffer_.begin(),
+                            parameter_buffer_.begin() + static_cast<size_t>(header.data_size));
+            }
+            else
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read store blob meta-data block");
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read store blob meta-data block");
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read store blob meta-data block header");
+        }
+    }
     else if (meta_data_type == format::MetaDataType::kResizeWindowCommand)
     {
         // This command does not support compression.
@@ -1189,6 +1964,159 @@ bool FileProcessor::ProcessStateMarker(const format::BlockHeader& block_header,
     return success;
 }
 
+bool FileProcessor::ProcessBlobReferenceBlock(const format::BlockHeader& block_header)
+{
+    format::BlobReferenceBlockHeader header;
+
+    bool success = ReadBytes(&header.inner_block_type, sizeof(header.inner_block_type));
+    success      = success && ReadBytes(&header.inner_block_size, sizeof(header.inner_block_size));
+    success      = success && ReadBytes(&header.reference_count, sizeof(header.reference_count));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read blob reference block header");
+        return false;
+    }
+
+    if (format::IsBlockCompressed(header.inner_block_type))
+    {
+        // Restored block data is read from memory, and is never compressed.
+        GFXRECON_LOG_ERROR("Blob reference block has unsupported compressed block type %u", header.inner_block_type);
+        error_state_ = kErrorReadingBlockData;
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.inner_block_size);
+
+    uint64_t references_size = header.reference_count * sizeof(format::BlobReference);
+    uint64_t fixed_size      = (sizeof(header) - sizeof(header.block_header)) + references_size;
+
+    std::vector<format::BlobReference> references;
+    std::vector<uint8_t>               block_data;
+
+    if (block_header.size >= fixed_size)
+    {
+        references.resize(header.reference_count);
+        block_data.resize(static_cast<size_t>(block_header.size - fixed_size));
+
+        success = ReadBytes(references.data(), static_cast<size_t>(references_size)) &&
+                  ReadBytes(block_data.data(), block_data.size());
+    }
+    else
+    {
+        success = false;
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read blob reference block data");
+        return false;
+    }
+
+    // Restore the block data by inserting the referenced blobs between the ranges of data stored in the block.
+    size_t inner_block_size = static_cast<size_t>(header.inner_block_size);
+    size_t restored_size    = 0;
+    size_t block_data_used  = 0;
+    bool   valid            = true;
+
+    blob_block_buffer_.resize(inner_block_size);
+
+    for (const auto& reference : references)
+    {
+        auto entry = blob_table_.find(
+            std::string(reinterpret_cast<const char*>(reference.blob_digest), sizeof(reference.blob_digest)));
+
+        if ((entry == blob_table_.end()) || (entry->second.size() != reference.size) ||
+            (reference.offset < restored_size) || (reference.offset + reference.size > inner_block_size) ||
+            ((reference.offset - restored_size) > (block_data.size() - block_data_used)))
+        {
+            valid = false;
+            break;
+        }
+
+        size_t copy_size = static_cast<size_t>(reference.offset) - restored_size;
+        util::platform::MemoryCopy(blob_block_buffer_.data() + restored_size,
+                                   inner_block_size - restored_size,
+                                   block_data.data() + block_data_used,
+                                   copy_size);
+        util::platform::MemoryCopy(blob_block_buffer_.data() + reference.offset,
+                                   inner_block_size - static_cast<size_t>(reference.offset),
+                                   entry->second.data(),
+                                   entry->second.size());
+
+        block_data_used += copy_size;
+        restored_size = static_cast<size_t>(reference.offset + reference.size);
+    }
+
+    if (valid && ((inner_block_size - restored_size) == (block_data.size() - block_data_used)))
+    {
+        util::platform::MemoryCopy(blob_block_buffer_.data() + restored_size,
+                                   inner_block_size - restored_size,
+                                   block_data.data() + block_data_used,
+                                   inner_block_size - restored_size);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Skipping blob reference block with missing or invalid blob references");
+
+        if (header.inner_block_type == format::BlockType::kFunctionCallBlock)
+        {
+            ++api_call_index_;
+        }
+
+        return true;
+    }
+
+    // Process the restored block, reading its data from the restored block buffer.
+    format::BlockHeader inner_block_header;
+    inner_block_header.size = header.inner_block_size;
+    inner_block_header.type = header.inner_block_type;
+
+    blob_block_read_offset_ = 0;
+    blob_block_active_      = true;
+
+    if (header.inner_block_type == format::BlockType::kFunctionCallBlock)
+    {
+        format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+
+        success = ReadBytes(&api_call_id, sizeof(api_call_id));
+
+        if (success)
+        {
+            success = ProcessFunctionCall(inner_block_header, api_call_id);
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read function call block header");
+        }
+    }
+    else if (header.inner_block_type == format::BlockType::kMetaDataBlock)
+    {
+        format::MetaDataId meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kUnknownMetaDataType);
+
+        success = ReadBytes(&meta_data_id, sizeof(meta_data_id));
+
+        if (success)
+        {
+            success = ProcessMetaData(inner_block_header, meta_data_id);
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Skipping blob reference block with unsupported block type %u", header.inner_block_type);
+    }
+
+    blob_block_active_ = false;
+
+    return success;
+}
+
 bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, format::AnnotationType annotation_type)
 {
     bool     success      = false;
@@ -1237,6 +2165,32 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
     return success;
 }
 
+bool FileProcessor::IsApiCallDecoded(format::ApiCallId call_id) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FileProcessor::IsMetaDataDecoded(format::MetaDataId meta_data_id) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataId(meta_data_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
 {
     // TODO: IDs of API calls that were treated as frame delimiters by the GFXReconstruct layer should be in the capture
@@ -27,13 +27,17 @@
 #include "format/api_call_id.h"
 #include "format/format.h"
 #include "decode/annotation_handler.h"
+#include "decode/api_call_profiler.h"
+#include "decode/block_statistics.h"
 #include "decode/api_decoder.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -54,7 +58,17 @@ class FileProcessor
         kErrorReadingBlockData             = -7,
         kErrorReadingCompressedBlockData   = -8,
         kErrorInvalidFourCC                = -9,
-        kErrorUnsupportedCompressionType   = -10
+        kErrorUnsupportedCompressionType   = -10,
+        kErrorSeekingFile                  = -11
+    };
+
+    // File position of the first block of a frame, recorded by IndexFrames() so that processing can be resumed at a
+    // frame boundary with SeekToFrame().
+    struct FramePosition
+    {
+        uint32_t frame_number;
+        uint64_t file_offset;
+        uint64_t api_call_index;
     };
 
   public:
@@ -64,6 +78,10 @@ class FileProcessor
 
     void SetAnnotationProcessor(AnnotationHandler* handler) { annotation_handler_ = handler; }
 
+    void SetApiCallProfiler(ApiCallProfiler* profiler) { profiler_ = profiler; }
+
+    void SetBlockStatistics(BlockStatistics* block_statistics) { block_statistics_ = block_statistics; }
+
     void AddDecoder(ApiDecoder* decoder) { decoders_.push_back(decoder); }
 
     void RemoveDecoder(ApiDecoder* decoder)
@@ -80,6 +98,52 @@ class FileProcessor
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
     bool ProcessAllFrames();
 
+    // Scans the blocks following the current read position, reading only block headers and API call IDs, and records
+    // the position of each frame.  The file offsets of blocks with data that is retained for reference by later blocks
+    // are recorded to retained_data_offsets.  The read position is restored before returning.  Returns false if a block
+    // header could not be read.
+    bool IndexFrames(std::vector<FramePosition>* frames, std::vector<uint64_t>* retained_data_offsets);
+
+    // Moves the read position to the start of a frame that was recorded by IndexFrames().
+    bool SeekToFrame(const FramePosition& position);
+
+    // Moves the read position to the start of a frame that was recorded by IndexFrames(), first loading the retained
+    // data of the blocks from retained_data_offsets that are between the current read position and the frame.  The
+    // loaded blocks are not passed to the decoders, and are only read so that blocks following the frame can reference
+    // their data, such as stored blobs and fill memory reference content, which is required when processing of a file
+    // starts from a frame other than the first.
+    bool SeekToFrame(const FramePosition& position, const std::vector<uint64_t>& retained_data_offsets);
+
+    // Replays the frames from first_frame to last_frame, inclusive, loop_count times before continuing with the rest
+    // of the file.  Frames preceding the range are processed once, and the objects that they create are reused by each
+    // iteration.  Memory contents written by the range with fill memory commands are restored on each iteration, but
+    // other state that is modified by the range is not reset, so the range must be a steady-state section of the
+    // capture that destroys the objects it creates.
+    void SetLoopFrames(uint32_t first_frame, uint32_t last_frame, uint32_t loop_count);
+
+    // Sets functions that are called before the first replay of the looped frame range starts and after it completes,
+    // which can check that the range destroys the objects that it creates.  When the end handler returns false, the
+    // range is not replayed again, and processing continues with the rest of the file.
+    void SetLoopCheckHandlers(std::function<void()> begin_handler, std::function<bool()> end_handler)
+    {
+        loop_check_begin_handler_ = begin_handler;
+        loop_check_end_handler_   = end_handler;
+    }
+
+    // Returns the duration of each completed replay of the looped frame range, in nanoseconds.
+    const std::vector<int64_t>& GetLoopIterationTimes() const { return loop_iteration_times_; }
+
+    // When processing reaches first_frame, the blocks for the frames from first_frame to last_frame, inclusive, are
+    // read and decompressed into a single memory buffer before any of them are processed, and are then processed from
+    // memory without file I/O or decompression.  Seeking to a preloaded frame, as done when looping, continues to read
+    // from memory.
+    void SetPreloadFrames(uint32_t first_frame, uint32_t last_frame);
+
+    // Returns the timestamps for the start and end of frame preloading, which are zero if no frames were preloaded.
+    int64_t GetPreloadStartTime() const { return preload_start_time_; }
+
+    int64_t GetPreloadEndTime() const { return preload_end_time_; }
+
     const format::FileHeader& GetFileHeader() const { return file_header_; }
 
     const std::vector<format::FileOptionPair>& GetFileOptions() const { return file_options_; }
@@ -95,6 +159,10 @@ class FileProcessor
 
     bool ProcessBlocks();
 
+    bool BeginLoopIteration();
+
+    bool EndLoopIteration();
+
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
     bool ReadParameterBuffer(size_t buffer_size);
@@ -105,8 +173,21 @@ class FileProcessor
 
     bool ReadBytes(void* buffer, size_t buffer_size);
 
+    bool ReadFileBytes(void* buffer, size_t buffer_size);
+
+    bool ReadPreloadedBytes(void* buffer, size_t buffer_size);
+
+    void EndPreloadedReads();
+
     bool SkipBytes(size_t skip_size);
 
+    bool ReadBlobBlockBytes(void* buffer, size_t buffer_size);
+
+    bool PreloadFrames();
+
+    // Processes the block at the file offset only to retain its data, without passing it to the decoders.
+    bool LoadRetainedData(uint64_t block_offset);
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
@@ -117,6 +198,18 @@ class FileProcessor
 
     bool ProcessAnnotation(const format::BlockHeader& block_header, format::AnnotationType annotation_type);
 
+    // Function calls restored from blob reference blocks are never frame delimiters.
+    bool ProcessBlobReferenceBlock(const format::BlockHeader& block_header);
+
+    // Preloading stores blocks with the same sequence of reads that is used to process them from the preload buffer,
+    // so block data must not be skipped while frames are being preloaded or processed from the preload buffer.
+    bool IsPreloadActive() const { return (preloading_ || preload_active_); }
+
+    // Returns true if at least one decoder processes the API call or meta-data type.
+    bool IsApiCallDecoded(format::ApiCallId call_id) const;
+
+    bool IsMetaDataDecoded(format::MetaDataId meta_data_id) const;
+
     bool IsFrameDelimiter(format::ApiCallId call_id) const;
 
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
@@ -133,11 +226,48 @@ class FileProcessor
     uint64_t                            bytes_read_;
     Error                               error_state_;
     AnnotationHandler*                  annotation_handler_;
+    ApiCallProfiler*                    profiler_;
+    BlockStatistics*                    block_statistics_;
     std::vector<ApiDecoder*>            decoders_;
     std::vector<uint8_t>                parameter_buffer_;
     std::vector<uint8_t>                compressed_parameter_buffer_;
     util::Compressor*                   compressor_;
     uint64_t                            api_call_index_;
+    uint32_t                            loop_first_frame_;
+    uint32_t                            loop_last_frame_;
+    uint32_t                            loop_count_;
+    bool                                loop_started_;
+    FramePosition                       loop_start_position_;
+    int64_t                             loop_iteration_start_time_;
+    std::vector<int64_t>                loop_iteration_times_;
+    std::function<void()>               loop_check_begin_handler_;
+    std::function<bool()>               loop_check_end_handler_;
+    uint32_t                            preload_first_frame_;
+    uint32_t                            preload_last_frame_;
+    bool                                preloading_;
+    bool                                preload_active_;
+    std::vector<uint8_t>                preload_buffer_;
+    size_t                              preload_read_offset_;
+    uint64_t                            preload_file_end_;
+    int64_t                             preload_start_time_;
+    int64_t                             preload_end_time_;
+
+    // Maps the file offset of the first block of each preloaded frame to its offset in the preload buffer.
+    std::unordered_map<uint64_t, size_t> preload_frame_offsets_;
+
+    // Fill memory content retained for reference by later fill memory reference commands, keyed by content ID.  The
+    // file does not record the last reference to retained data, so the fill memory content and the blob table below
+    // are kept until the processor is destroyed, and use memory equal to the total size of the unique content and
+    // blobs in the file.
+    std::unordered_map<uint64_t, std::vector<uint8_t>> fill_memory_content_;
+    bool                                               loading_retained_data_;
+
+    // Blob data added by store blob commands, keyed by SHA-256 digest.  While a blob reference block is processed,
+    // reads are made from the block data, restored to blob_block_buffer_, instead of the file.
+    std::unordered_map<std::string, std::vector<uint8_t>> blob_table_;
+    std::vector<uint8_t>                                   blob_block_buffer_;
+    size_t                                                 blob_block_read_offset_;
+    bool                                                   blob_block_active_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
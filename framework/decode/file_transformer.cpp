@@ -26,6 +26,7 @@
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -33,11 +34,18 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 FileTransformer::FileTransformer() :
     file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
-    error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
+    error_state_(kErrorInvalidFileDescriptor), loading_state_(false), write_error_(false)
 {}
 
 FileTransformer::~FileTransformer()
 {
+    // Pending writes must complete before the output file is closed.
+    if (output_file_ != nullptr)
+    {
+        FlushWriteBuffer();
+        WaitForWrites();
+    }
+
     if (input_file_ != nullptr)
     {
         fclose(input_file_);
@@ -61,6 +69,9 @@ bool FileTransformer::Initialize(const std::string& input_filename, const std::s
 
         if ((result == 0) && (output_file_ != nullptr))
         {
+            writer_ = std::make_unique<util::ThreadPool>(1);
+            write_buffer_.reserve(kWriteBufferSize);
+
             success = ProcessFileHeader();
         }
         else
@@ -89,6 +100,7 @@ bool FileTransformer::Initialize(const std::string& input_filename, const std::s
 
         if (output_file_ != nullptr)
         {
+            WaitForWrites();
             fclose(output_file_);
             output_file_ = nullptr;
         }
@@ -107,6 +119,17 @@ bool FileTransformer::Process()
         success = ProcessNextBlock();
     }
 
+    if ((error_state_ == kErrorNone) && (input_file_ != nullptr) && (output_file_ != nullptr))
+    {
+        ProcessEndOfFile();
+    }
+
+    if (output_file_ != nullptr)
+    {
+        FlushWriteBuffer();
+        WaitForWrites();
+    }
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
@@ -118,7 +141,7 @@ bool FileTransformer::Process()
         {
             error_state_ = kErrorReadingFile;
         }
-        else if (ferror(output_file_))
+        else if (write_error_ || ferror(output_file_))
         {
             error_state_ = kErrorWritingFile;
         }
@@ -238,22 +261,25 @@ bool FileTransformer::ProcessNextBlock()
                 HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
             }
         }
-        else
+        else if (block_header.type == format::BlockType::kBlobReferenceBlock)
         {
-            // Copy the block to the output file.
-            success = WriteBlockHeader(block_header);
+            format::BlockType inner_block_type = format::BlockType::kUnknownBlock;
+
+            success = ReadBytes(&inner_block_type, sizeof(inner_block_type));
 
             if (success)
             {
-                success = CopyBytes(block_header.size);
-
-                if (!success)
-                {
-                    GFXRECON_LOG_ERROR("Failed to write block data");
-                    error_state_ = kErrorWritingBlockData;
-                }
+                success = ProcessBlobReferenceBlock(block_header, inner_block_type);
+            }
+            else
+            {
+                HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read blob reference block header");
             }
         }
+        else
+        {
+            success = ProcessPassThroughBlock(block_header);
+        }
     }
     else
     {
@@ -268,6 +294,24 @@ bool FileTransformer::ProcessNextBlock()
     return success;
 }
 
+bool FileTransformer::ProcessPassThroughBlock(const format::BlockHeader& block_header)
+{
+    // Copy the block to the output file.
+    if (!WriteBlockHeader(block_header))
+    {
+        return false;
+    }
+
+    if (!CopyBytes(block_header.size))
+    {
+        GFXRECON_LOG_ERROR("Failed to write block data");
+        error_state_ = kErrorWritingBlockData;
+        return false;
+    }
+
+    return true;
+}
+
 bool FileTransformer::ReadBlockHeader(format::BlockHeader* block_header)
 {
     assert(block_header != nullptr);
@@ -342,9 +386,21 @@ bool FileTransformer::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileTransformer::WriteBytes(const void* buffer, size_t buffer_size)
 {
-    size_t bytes_written = util::platform::FileWrite(buffer, 1, buffer_size, output_file_);
-    bytes_written_ += bytes_written;
-    return (bytes_written == buffer_size);
+    if (write_error_)
+    {
+        return false;
+    }
+
+    auto bytes = reinterpret_cast<const uint8_t*>(buffer);
+    write_buffer_.insert(write_buffer_.end(), bytes, bytes + buffer_size);
+    bytes_written_ += buffer_size;
+
+    if (write_buffer_.size() >= kWriteBufferSize)
+    {
+        return FlushWriteBuffer();
+    }
+
+    return true;
 }
 
 bool FileTransformer::SkipBytes(uint64_t skip_size)
@@ -362,16 +418,76 @@ bool FileTransformer::SkipBytes(uint64_t skip_size)
 
 bool FileTransformer::CopyBytes(uint64_t copy_size)
 {
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, copy_size);
-    if (ReadParameterBuffer(static_cast<size_t>(copy_size)))
+    // Read directly into the write buffer, in chunks no larger than the write buffer, so that large blocks do not
+    // require an equally large intermediate buffer.
+    while (copy_size > 0)
     {
-        if (WriteBytes(parameter_buffer_.data(), static_cast<size_t>(copy_size)))
+        if (write_error_)
         {
-            return true;
+            return false;
+        }
+
+        size_t chunk_size = static_cast<size_t>(std::min(copy_size, static_cast<uint64_t>(kWriteBufferSize)));
+        size_t offset     = write_buffer_.size();
+
+        write_buffer_.resize(offset + chunk_size);
+
+        if (!ReadBytes(write_buffer_.data() + offset, chunk_size))
+        {
+            write_buffer_.resize(offset);
+            return false;
+        }
+
+        bytes_written_ += chunk_size;
+        copy_size -= chunk_size;
+
+        if ((write_buffer_.size() >= kWriteBufferSize) && !FlushWriteBuffer())
+        {
+            return false;
         }
     }
 
-    return false;
+    return true;
+}
+
+bool FileTransformer::FlushWriteBuffer()
+{
+    if (!write_buffer_.empty())
+    {
+        assert(writer_ != nullptr);
+
+        // Limit the amount of memory held by pending writes when reads are faster than writes.
+        if (writer_->GetPendingTaskCount() >= kMaxPendingWriteCount)
+        {
+            writer_->Wait();
+        }
+
+        auto data = std::make_shared<std::vector<uint8_t>>(std::move(write_buffer_));
+
+        write_buffer_ = std::vector<uint8_t>();
+        write_buffer_.reserve(kWriteBufferSize);
+
+        writer_->Submit([this, data]() {
+            if (!write_error_)
+            {
+                size_t bytes_written = util::platform::FileWrite(data->data(), 1, data->size(), output_file_);
+                if (bytes_written != data->size())
+                {
+                    write_error_ = true;
+                }
+            }
+        });
+    }
+
+    return !write_error_;
+}
+
+void FileTransformer::WaitForWrites()
+{
+    if (writer_ != nullptr)
+    {
+        writer_->Wait();
+    }
 }
 
 void FileTransformer::HandleBlockReadError(Error error_code, const char* error_message)
@@ -396,7 +512,7 @@ void FileTransformer::HandleBlockWriteError(Error error_code, const char* error_
 
 void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_message)
 {
-    if (ferror(output_file_))
+    if (write_error_)
     {
         HandleBlockWriteError(error_code, error_message);
     }
@@ -524,5 +640,24 @@ bool FileTransformer::ProcessStateMarker(const format::BlockHeader& block_header
     return true;
 }
 
+bool FileTransformer::ProcessBlobReferenceBlock(const format::BlockHeader& block_header,
+                                                format::BlockType          inner_block_type)
+{
+    // Blob reference blocks are not compressed, and are copied from the old file to the new file unmodified.
+    if (!WriteBlockHeader(block_header) || !WriteBytes(&inner_block_type, sizeof(inner_block_type)))
+    {
+        HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write blob reference block header");
+        return false;
+    }
+
+    if (!CopyBytes(block_header.size - sizeof(inner_block_type)))
+    {
+        HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy blob reference block data");
+        return false;
+    }
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -26,7 +26,9 @@
 #include "format/format.h"
 #include "util/defines.h"
 #include "util/compressor.h"
+#include "util/thread_pool.h"
 
+#include <atomic>
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -133,6 +135,16 @@ class FileTransformer
 
     virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    virtual bool ProcessBlobReferenceBlock(const format::BlockHeader& block_header,
+                                           format::BlockType          inner_block_type);
+
+    // Called for blocks that are copied to the output file without being decoded, such as annotations and blocks of
+    // unrecognized type.
+    virtual bool ProcessPassThroughBlock(const format::BlockHeader& block_header);
+
+    // Called after all blocks have been read from the input file, to write any output that is still pending.
+    virtual bool ProcessEndOfFile() { return true; }
+
   private:
     bool ProcessFileHeader();
 
@@ -140,6 +152,16 @@ class FileTransformer
 
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
+    bool FlushWriteBuffer();
+
+    void WaitForWrites();
+
+  private:
+    // Output is accumulated in a buffer that is written to the file by a worker thread when full, allowing file reads
+    // and writes to overlap.
+    static const size_t kWriteBufferSize      = 4 * 1024 * 1024;
+    static const size_t kMaxPendingWriteCount = 4;
+
   private:
     FILE*                               input_file_;
     FILE*                               output_file_;
@@ -153,6 +175,9 @@ class FileTransformer
     std::vector<uint8_t>                parameter_buffer_;
     std::vector<uint8_t>                compressed_parameter_buffer_;
     std::unique_ptr<util::Compressor>   compressor_;
+    std::vector<uint8_t>                write_buffer_;
+    std::unique_ptr<util::ThreadPool>   writer_;
+    std::atomic<bool>                   write_error_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
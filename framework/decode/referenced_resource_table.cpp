@@ -29,9 +29,9 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 void ReferencedResourceTable::AddResource(format::HandleId resource_id)
 {
-    if (resource_id != format::kNullHandleId)
+    if ((resource_id != format::kNullHandleId) && (resource_indices_.find(resource_id) == resource_indices_.end()))
     {
-        resources_.emplace(resource_id, std::make_shared<ResourceInfo>());
+        AddResourceInfo(resource_id, false);
     }
 }
 
@@ -39,29 +39,21 @@ void ReferencedResourceTable::AddResource(format::HandleId parent_id, format::Ha
 {
     if ((parent_id != format::kNullHandleId) && (resource_id != format::kNullHandleId))
     {
-        auto parent_entry = resources_.find(parent_id);
+        ResourceIndex parent_index = 0;
 
-        if (parent_entry != resources_.end())
+        if (GetResourceIndex(parent_id, &parent_index))
         {
-            auto& parent_info = parent_entry->second;
-            assert(parent_info != nullptr);
+            ResourceIndex resource_index = 0;
 
-            auto resource_entry = resources_.find(resource_id);
-            if (resource_entry == resources_.end())
+            if (!GetResourceIndex(resource_id, &resource_index))
             {
-                // The resource is not in the table, so add it to both the table and to the parent's child list.
-                auto resource_info      = std::make_shared<ResourceInfo>();
-                resource_info->is_child = true;
-
-                parent_info->child_infos.emplace_back(std::weak_ptr<ResourceInfo>{ resource_info });
-                resources_.emplace(resource_id, resource_info);
-            }
-            else
-            {
-                // The resource has already been added to the table, but has multiple parent objects (e.g. a framebuffer
-                // is created from multiple image views), so we add it to the parent's child list.
-                parent_info->child_infos.emplace_back(std::weak_ptr<ResourceInfo>{ resource_entry->second });
+                // The resource is not in the table, so add it to the table as a child resource.
+                resource_index = AddResourceInfo(resource_id, true);
             }
+
+            // A resource may have multiple parent objects (e.g. a framebuffer is created from multiple image views), so
+            // an edge is recorded for each parent.
+            child_edges_.emplace_back(resource_index, parent_index);
         }
     }
 }
@@ -89,16 +81,14 @@ void ReferencedResourceTable::AddResourceToContainer(format::HandleId container_
         auto container_entry = containers_.find(container_id);
         if (container_entry != containers_.end())
         {
-            auto& container_info = container_entry->second;
-            auto  resource_entry = resources_.find(resource_id);
+            ResourceIndex resource_index = 0;
 
-            if (resource_entry != resources_.end())
+            if (GetResourceIndex(resource_id, &resource_index))
             {
-                auto& resource_info = resource_entry->second;
-                assert((container_info != nullptr) && (resource_info != nullptr));
+                auto& container_info = container_entry->second;
 
-                container_info->resource_infos.emplace(resource_id, std::weak_ptr<ResourceInfo>{ resource_info });
-                container_info->resource_bindings[binding].insert(std::make_pair(element, resource_id));
+                container_info.resources.Add(resource_index);
+                container_info.resource_bindings.emplace(MakeBindingKey(binding, element), resource_index);
             }
         }
     }
@@ -111,15 +101,11 @@ void ReferencedResourceTable::AddResourceToUser(format::HandleId user_id, format
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
         {
-            auto& user_info      = user_entry->second;
-            auto  resource_entry = resources_.find(resource_id);
+            ResourceIndex resource_index = 0;
 
-            if (resource_entry != resources_.end())
+            if (GetResourceIndex(resource_id, &resource_index))
             {
-                auto& resource_info = resource_entry->second;
-                assert((user_info != nullptr) && (resource_info != nullptr));
-
-                user_info->resource_infos.emplace(resource_id, std::weak_ptr<ResourceInfo>{ resource_info });
+                user_entry->second.resources.Add(resource_index);
             }
         }
     }
@@ -130,57 +116,38 @@ void ReferencedResourceTable::AddContainerToUser(format::HandleId user_id, forma
     if ((user_id != format::kNullHandleId) && (container_id != format::kNullHandleId))
     {
         auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
+        if ((user_entry != users_.end()) && (containers_.find(container_id) != containers_.end()))
         {
-            auto& user_info       = user_entry->second;
-            auto  container_entry = containers_.find(container_id);
-
-            if (container_entry != containers_.end())
-            {
-                auto& container_info = container_entry->second;
-                assert((user_info != nullptr) && (container_info != nullptr));
-
-                user_info->container_infos.emplace(container_id,
-                                                   std::weak_ptr<ResourceContainerInfo>{ container_info });
-            }
+            user_entry->second.containers.Add(container_id);
         }
     }
 }
 
 void ReferencedResourceTable::AddUserToUser(format::HandleId user_id, format::HandleId source_user_id)
 {
-    if ((user_id != format::kNullHandleId) && (source_user_id != format::kNullHandleId))
+    if ((user_id != format::kNullHandleId) && (source_user_id != format::kNullHandleId) && (user_id != source_user_id))
     {
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
         {
-            auto& user_info         = user_entry->second;
-            auto  source_user_entry = users_.find(source_user_id);
+            auto source_user_entry = users_.find(source_user_id);
 
             if (source_user_entry != users_.end())
             {
-                auto& source_user_info = source_user_entry->second;
-                assert((user_info != nullptr) && (source_user_info != nullptr));
-
                 // Copy resource and container info from source user to destination user.
-                auto&       resource_infos         = user_info->resource_infos;
-                auto&       container_infos        = user_info->container_infos;
-                const auto& source_resource_infos  = source_user_info->resource_infos;
-                const auto& source_container_infos = source_user_info->container_infos;
+                auto&       user_info        = user_entry->second;
+                const auto& source_user_info = source_user_entry->second;
 
-                for (auto& source_resource_info : source_resource_infos)
+                for (auto resource_index : source_user_info.resources.values)
                 {
-                    if (!source_resource_info.second.expired())
-                    {
-                        resource_infos.insert(source_resource_info);
-                    }
+                    user_info.resources.Add(resource_index);
                 }
 
-                for (auto& source_container_info : source_container_infos)
+                for (auto container_id : source_user_info.containers.values)
                 {
-                    if (!source_container_info.second.expired())
+                    if (containers_.find(container_id) != containers_.end())
                     {
-                        container_infos.insert(source_container_info);
+                        user_info.containers.Add(container_id);
                     }
                 }
             }
@@ -192,8 +159,8 @@ void ReferencedResourceTable::AddContainer(format::HandleId pool_id, format::Han
 {
     if ((pool_id != format::kNullHandleId) && (container_id != format::kNullHandleId))
     {
-        auto container_info     = std::make_shared<ResourceContainerInfo>();
-        container_info->pool_id = pool_id;
+        ResourceContainerInfo container_info;
+        container_info.pool_id = pool_id;
         containers_.emplace(container_id, std::move(container_info));
         container_pool_handles_[pool_id].insert(container_id);
     }
@@ -203,8 +170,8 @@ void ReferencedResourceTable::AddUser(format::HandleId pool_id, format::HandleId
 {
     if ((pool_id != format::kNullHandleId) && (user_id != format::kNullHandleId))
     {
-        auto user_info     = std::make_shared<ResourceUserInfo>();
-        user_info->pool_id = pool_id;
+        ResourceUserInfo user_info;
+        user_info.pool_id = pool_id;
         users_.emplace(user_id, std::move(user_info));
         user_pool_handles_[pool_id].insert(user_id);
     }
@@ -217,10 +184,7 @@ void ReferencedResourceTable::RemoveContainer(format::HandleId container_id)
         auto container_entry = containers_.find(container_id);
         if (container_entry != containers_.end())
         {
-            auto& container_info = container_entry->second;
-            assert(container_info != nullptr);
-
-            container_pool_handles_[container_info->pool_id].erase(container_id);
+            container_pool_handles_[container_entry->second.pool_id].erase(container_id);
             containers_.erase(container_entry);
         }
     }
@@ -233,10 +197,7 @@ void ReferencedResourceTable::RemoveUser(format::HandleId user_id)
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
         {
-            auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
-
-            user_pool_handles_[user_info->pool_id].erase(user_id);
+            user_pool_handles_[user_entry->second.pool_id].erase(user_id);
             users_.erase(user_entry);
         }
     }
@@ -250,10 +211,9 @@ void ReferencedResourceTable::ResetContainer(format::HandleId container_id)
         if (container_entry != containers_.end())
         {
             auto& container_info = container_entry->second;
-            assert(container_info != nullptr);
 
-            container_info->resource_infos.clear();
-            container_info->resource_bindings.clear();
+            container_info.resources.Clear();
+            container_info.resource_bindings.clear();
         }
     }
 }
@@ -266,10 +226,9 @@ void ReferencedResourceTable::ResetUser(format::HandleId user_id)
         if (user_entry != users_.end())
         {
             auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
 
-            user_info->resource_infos.clear();
-            user_info->container_infos.clear();
+            user_info.resources.Clear();
+            user_info.containers.Clear();
         }
     }
 }
@@ -333,22 +292,23 @@ void ReferencedResourceTable::CopyContainerEntry(format::HandleId source_contain
                                                  uint32_t         destination_binding,
                                                  uint32_t         destination_element)
 {
-    if (source_container_id != format::kNullHandleId)
+    if ((source_container_id != format::kNullHandleId) && (destination_container_id != format::kNullHandleId))
     {
-        const auto container_entry = containers_.find(source_container_id);
-        if (container_entry != containers_.end())
+        const auto source_entry      = containers_.find(source_container_id);
+        auto       destination_entry = containers_.find(destination_container_id);
+
+        if ((source_entry != containers_.end()) && (destination_entry != containers_.end()))
         {
-            const auto& container_info = container_entry->second;
-            const auto  binding_entry  = container_info->resource_bindings.find(source_binding);
-            if (binding_entry != container_info->resource_bindings.end())
+            const auto& source_bindings = source_entry->second.resource_bindings;
+            const auto  binding_entry   = source_bindings.find(MakeBindingKey(source_binding, source_element));
+
+            if (binding_entry != source_bindings.end())
             {
-                const auto& binding_elements = binding_entry->second;
-                const auto  element_entry    = binding_elements.find(source_element);
-                if (element_entry != binding_elements.end())
-                {
-                    AddResourceToContainer(
-                        destination_container_id, element_entry->second, destination_binding, destination_element);
-                }
+                auto& destination_info = destination_entry->second;
+
+                destination_info.resources.Add(binding_entry->second);
+                destination_info.resource_bindings.emplace(MakeBindingKey(destination_binding, destination_element),
+                                                           binding_entry->second);
             }
         }
     }
@@ -361,33 +321,21 @@ void ReferencedResourceTable::ProcessUserSubmission(format::HandleId user_id)
         auto user_entry = users_.find(user_id);
         if (user_entry != users_.end())
         {
-            auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
-
-            auto& resource_infos  = user_info->resource_infos;
-            auto& container_infos = user_info->container_infos;
+            const auto& user_info = user_entry->second;
 
-            for (auto& resource_info : resource_infos)
+            for (auto resource_index : user_info.resources.values)
             {
-                if (!resource_info.second.expired())
-                {
-                    auto resource_info_ptr  = resource_info.second.lock();
-                    resource_info_ptr->used = true;
-                }
+                resources_[resource_index].used = true;
             }
 
-            for (auto& container_info : container_infos)
+            for (auto container_id : user_info.containers.values)
             {
-                if (!container_info.second.expired())
+                const auto container_entry = containers_.find(container_id);
+                if (container_entry != containers_.end())
                 {
-                    auto container_info_ptr = container_info.second.lock();
-                    for (auto& resource_info : container_info_ptr->resource_infos)
+                    for (auto resource_index : container_entry->second.resources.values)
                     {
-                        if (!resource_info.second.expired())
-                        {
-                            auto resource_info_ptr  = resource_info.second.lock();
-                            resource_info_ptr->used = true;
-                        }
+                        resources_[resource_index].used = true;
                     }
                 }
             }
@@ -398,52 +346,105 @@ void ReferencedResourceTable::ProcessUserSubmission(format::HandleId user_id)
 void ReferencedResourceTable::GetReferencedResourceIds(std::unordered_set<format::HandleId>* referenced_ids,
                                                        std::unordered_set<format::HandleId>* unreferenced_ids) const
 {
-    for (auto resource_entry : resources_)
+    const size_t resource_count = resources_.size();
+
+    // Build a compressed sparse row adjacency list mapping each child resource to its parents.
+    std::vector<size_t>        parent_offsets(resource_count + 1, 0);
+    std::vector<ResourceIndex> parents(child_edges_.size());
+
+    for (const auto& edge : child_edges_)
+    {
+        ++parent_offsets[edge.first + 1];
+    }
+
+    for (size_t i = 0; i < resource_count; ++i)
     {
-        auto& resource_info = resource_entry.second;
+        parent_offsets[i + 1] += parent_offsets[i];
+    }
+
+    std::vector<size_t> insert_offsets(parent_offsets.begin(), parent_offsets.end() - 1);
+    for (const auto& edge : child_edges_)
+    {
+        parents[insert_offsets[edge.first]++] = edge.second;
+    }
 
-        if (!resource_info->is_child)
+    // A resource that was not used directly is considered used if it was used indirectly through a child, so the used
+    // state is propagated from each used resource to its ancestors.
+    std::vector<bool>          used(resource_count, false);
+    std::vector<ResourceIndex> pending;
+
+    for (size_t i = 0; i < resource_count; ++i)
+    {
+        if (resources_[i].used)
         {
-            bool used = IsUsed(resource_info.get());
+            used[i] = true;
+            pending.push_back(static_cast<ResourceIndex>(i));
+        }
+    }
+
+    while (!pending.empty())
+    {
+        ResourceIndex index = pending.back();
+        pending.pop_back();
+
+        for (size_t i = parent_offsets[index]; i < parent_offsets[index + 1]; ++i)
+        {
+            ResourceIndex parent_index = parents[i];
+            if (!used[parent_index])
+            {
+                used[parent_index] = true;
+                pending.push_back(parent_index);
+            }
+        }
+    }
 
-            if (used && (referenced_ids != nullptr))
+    for (size_t i = 0; i < resource_count; ++i)
+    {
+        const auto& resource_info = resources_[i];
+
+        if (!resource_info.is_child)
+        {
+            if (used[i] && (referenced_ids != nullptr))
             {
-                referenced_ids->insert(resource_entry.first);
+                referenced_ids->insert(resource_info.id);
             }
-            else if (!used && (unreferenced_ids != nullptr))
+            else if (!used[i] && (unreferenced_ids != nullptr))
             {
-                unreferenced_ids->insert(resource_entry.first);
+                unreferenced_ids->insert(resource_info.id);
             }
         }
     }
 }
 
-bool ReferencedResourceTable::IsUsed(const ResourceInfo* resource_info) const
+bool ReferencedResourceTable::GetResourceIndex(format::HandleId resource_id, ResourceIndex* index) const
 {
-    assert(resource_info != nullptr);
+    assert(index != nullptr);
 
-    if (resource_info->used)
+    auto entry = resource_indices_.find(resource_id);
+    if (entry != resource_indices_.end())
     {
+        (*index) = entry->second;
         return true;
     }
-    else
-    {
-        // If the resource was not used directly, check to see if it was used indirectly through a child.
-        for (const auto& child_info : resource_info->child_infos)
-        {
-            if (!child_info.expired())
-            {
-                const auto child_info_ptr = child_info.lock();
-                if (IsUsed(child_info_ptr.get()))
-                {
-                    return true;
-                }
-            }
-        }
-    }
 
     return false;
 }
 
+ReferencedResourceTable::ResourceIndex ReferencedResourceTable::AddResourceInfo(format::HandleId resource_id,
+                                                                                bool             is_child)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(ResourceIndex, resources_.size());
+    ResourceIndex index = static_cast<ResourceIndex>(resources_.size());
+
+    ResourceInfo resource_info;
+    resource_info.id       = resource_id;
+    resource_info.is_child = is_child;
+
+    resources_.push_back(resource_info);
+    resource_indices_.emplace(resource_id, index);
+
+    return index;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -28,7 +28,8 @@
 
 #include "vulkan/vulkan.h"
 
-#include <memory>
+#include <algorithm>
+#include <cstdint>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -89,44 +90,93 @@ class ReferencedResourceTable
                                   std::unordered_set<format::HandleId>* unreferenced_ids) const;
 
   private:
+    // Resources are assigned dense indices in creation order. Handle IDs are never reused within a capture file and
+    // resources are never removed from the table, so the index remains valid for the lifetime of the table.
+    typedef uint32_t ResourceIndex;
+
+    static const size_t kMinCompactListSize = 32;
+
     // Track the referenced/used state of a resource (buffer, image, view, framebuffer).
     struct ResourceInfo
     {
-        bool                                     used{ false };
-        bool                                     is_child{ false };
-        std::vector<std::weak_ptr<ResourceInfo>> child_infos;
+        format::HandleId id{ format::kNullHandleId };
+        bool             used{ false };
+        bool             is_child{ false };
+    };
+
+    // List of values that may contain duplicates, which are periodically removed when the list grows.  Avoids the
+    // per-entry allocation of a hash set for lists that frequently receive the same value (e.g. a command buffer that
+    // binds the same resources for every draw).
+    template <typename T>
+    struct CompactList
+    {
+        std::vector<T> values;
+        size_t         unique_count{ 0 };
+
+        void Add(T value)
+        {
+            values.push_back(value);
+
+            size_t compact_size = (unique_count > kMinCompactListSize) ? unique_count : kMinCompactListSize;
+            if (values.size() >= (compact_size * 2))
+            {
+                Compact();
+            }
+        }
+
+        void Compact()
+        {
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+            unique_count = values.size();
+        }
+
+        void Clear()
+        {
+            values.clear();
+            unique_count = 0;
+        }
     };
 
     // Track the referenced/used state of a resource container (descriptor set).
     struct ResourceContainerInfo
     {
-        format::HandleId                                                  pool_id{ format::kNullHandleId };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>> resource_infos;
+        format::HandleId           pool_id{ format::kNullHandleId };
+        CompactList<ResourceIndex> resources;
 
-        // Table mapping a container binding to a handle.  Each binding contains a table of handles keyed by array
-        // element index.
-        std::unordered_map<uint32_t, std::unordered_map<uint32_t, format::HandleId>> resource_bindings;
+        // Table mapping a container binding and array element, packed as (binding << 32) | element, to a resource.
+        std::unordered_map<uint64_t, ResourceIndex> resource_bindings;
     };
 
-    // Track the state of a resource user (command buffer).
+    // Track the state of a resource user (command buffer).  Containers are referenced by ID, and are ignored at
+    // submission if they have been removed from the table.
     struct ResourceUserInfo
     {
-        format::HandleId                                                           pool_id{ format::kNullHandleId };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>>          resource_infos;
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceContainerInfo>> container_infos;
+        format::HandleId              pool_id{ format::kNullHandleId };
+        CompactList<ResourceIndex>    resources;
+        CompactList<format::HandleId> containers;
     };
 
     typedef std::unordered_set<format::HandleId> PoolHandles;
 
   private:
-    bool IsUsed(const ResourceInfo* resource_info) const;
+    bool GetResourceIndex(format::HandleId resource_id, ResourceIndex* index) const;
+
+    ResourceIndex AddResourceInfo(format::HandleId resource_id, bool is_child);
+
+    static uint64_t MakeBindingKey(uint32_t binding, uint32_t element)
+    {
+        return (static_cast<uint64_t>(binding) << 32) | element;
+    }
 
   private:
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceInfo>>          resources_;
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceContainerInfo>> containers_;
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceUserInfo>>      users_;
-    std::unordered_map<format::HandleId, PoolHandles>                            container_pool_handles_;
-    std::unordered_map<format::HandleId, PoolHandles>                            user_pool_handles_;
+    std::vector<ResourceInfo>                                   resources_;
+    std::unordered_map<format::HandleId, ResourceIndex>         resource_indices_;
+    std::vector<std::pair<ResourceIndex, ResourceIndex>>        child_edges_; // (child, parent) pairs.
+    std::unordered_map<format::HandleId, ResourceContainerInfo> containers_;
+    std::unordered_map<format::HandleId, ResourceUserInfo>      users_;
+    std::unordered_map<format::HandleId, PoolHandles>           container_pool_handles_;
+    std::unordered_map<format::HandleId, PoolHandles>           user_pool_handles_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
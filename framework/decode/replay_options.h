@@ -30,10 +30,14 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 static constexpr char kDefaultScreenshotFilePrefix[] = "screenshot";
+static constexpr char kScreenshotHashManifestSuffix[] = "_hashes.csv";
 
 enum class ScreenshotFormat : uint32_t
 {
-    kBmp = 0
+    kBmp = 0,
+    kPng = 1,
+    kQoi = 2,
+    kHash = 3
 };
 
 struct ScreenshotRange
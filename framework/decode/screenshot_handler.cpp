@@ -22,37 +22,89 @@
 
 #include "decode/screenshot_handler.h"
 
+#include "generated/generated_vulkan_enum_to_string.h"
+#include "util/hash.h"
 #include "util/image_writer.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <cinttypes>
 #include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-const uint32_t kDefaultQueueFamilyIndex = 0;
-const uint32_t kDefaultQueueIndex       = 0;
-
 const size_t kUnormIndex = 0;
 const size_t kSrgbIndex  = 1;
 
+// Number of copy resources per device for pipelined screenshots, which is the number of screenshots that can be in
+// flight on the GPU before replay waits for the oldest one to complete.
+const size_t kPipelinedCopyResourceCount = 3;
+
+// Number of worker threads writing image files for pipelined screenshots.
+const size_t kImageWriterThreadCount = 2;
+
+// Limit on the number of image file writes that can be queued for the worker threads, to bound the memory used to
+// hold image data when files are written more slowly than frames are replayed.
+const size_t kMaxPendingImageWrites = 8;
+
+// Number of blocks in each dimension of the grid used to compute perceptual image hashes.
+const uint32_t kPerceptualHashGridSize = 8;
+
+const char kHashManifestHeader[] = "frame,image,width,height,format,hash,perceptual_hash\n";
+
+// Vulkan image formats for GPU conversion of swapchain images with formats that can not be converted by the CPU.
 const VkFormat kImageFormats[][2] = {
     // Vulkan image formats for ScreenshotFormat::kBmp
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kPng
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kQoi
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kHash
     { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB }
 };
 
 ScreenshotHandler::ScreenshotHandler(ScreenshotFormat                    screenshot_format,
-                                     const std::vector<ScreenshotRange>& screenshot_ranges) :
+                                     const std::vector<ScreenshotRange>& screenshot_ranges,
+                                     bool                                pipelined,
+                                     const std::string&                  hash_manifest_filename) :
     current_frame_number_(1),
-    screenshot_format_(screenshot_format), screenshot_ranges_(screenshot_ranges), current_range_index_(0)
-{}
+    screenshot_format_(screenshot_format), screenshot_ranges_(screenshot_ranges), current_range_index_(0),
+    pipelined_(pipelined), hash_manifest_filename_(hash_manifest_filename), hash_manifest_file_(nullptr)
+{
+    if (pipelined_)
+    {
+        image_writer_ = std::make_unique<util::ThreadPool>(kImageWriterThreadCount);
+    }
+}
 
 ScreenshotHandler::ScreenshotHandler(ScreenshotFormat               screenshot_format,
-                                     std::vector<ScreenshotRange>&& screenshot_ranges) :
+                                     std::vector<ScreenshotRange>&& screenshot_ranges,
+                                     bool                           pipelined,
+                                     const std::string&             hash_manifest_filename) :
     current_frame_number_(1),
-    screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0)
-{}
+    screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0),
+    pipelined_(pipelined), hash_manifest_filename_(hash_manifest_filename), hash_manifest_file_(nullptr)
+{
+    if (pipelined_)
+    {
+        image_writer_ = std::make_unique<util::ThreadPool>(kImageWriterThreadCount);
+    }
+}
+
+ScreenshotHandler::~ScreenshotHandler()
+{
+    if (image_writer_ != nullptr)
+    {
+        image_writer_->Wait();
+    }
+
+    if (hash_manifest_file_ != nullptr)
+    {
+        util::platform::FileClose(hash_manifest_file_);
+    }
+}
 
 void ScreenshotHandler::EndFrame()
 {
@@ -66,6 +118,15 @@ void ScreenshotHandler::EndFrame()
     }
 
     ++current_frame_number_;
+
+    if (pipelined_)
+    {
+        // Hand off any copies that have completed, without waiting for the copies that are still in flight.
+        for (auto& entry : device_resources_)
+        {
+            CompletePendingCopies(entry.first, &entry.second, false);
+        }
+    }
 }
 
 bool ScreenshotHandler::IsScreenshotFrame() const
@@ -90,7 +151,11 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                    VkImage                                 image,
                                    VkFormat                                format,
                                    uint32_t                                width,
-                                   uint32_t                                height)
+                                   uint32_t                                height,
+                                   VkQueue                                 queue,
+                                   uint32_t                                queue_family_index,
+                                   uint32_t                                wait_semaphore_count,
+                                   const VkSemaphore*                      wait_semaphores)
 {
     if ((device_table == nullptr) || (allocator == nullptr))
     {
@@ -100,39 +165,48 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
     VkResult result = VK_SUCCESS;
 
-    // TODO: Improved queue selection; ensure queue supports transfer operations.
-
-    // Get a command pool for the device.
-    auto copy_resource_entry = copy_resources_.find(device);
-    if (copy_resource_entry == copy_resources_.end())
+    // Get a command pool for the device.  The copy is submitted to the present queue, so the pool is recreated when
+    // the device presents from a queue of a different family.
+    auto device_resources_entry = device_resources_.find(device);
+    if ((device_resources_entry != device_resources_.end()) &&
+        (device_resources_entry->second.queue_family_index != queue_family_index))
     {
-        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
-        create_info.pNext                   = nullptr;
-        create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-        create_info.queueFamilyIndex        = kDefaultQueueFamilyIndex;
+        DestroyDeviceResources(device, device_table);
+        device_resources_entry = device_resources_.end();
+    }
 
-        VkCommandPool command_pool = VK_NULL_HANDLE;
-        result                     = device_table->CreateCommandPool(device, &create_info, nullptr, &command_pool);
+    if (device_resources_entry == device_resources_.end())
+    {
+        DeviceResources device_resources;
+        result = CreateDeviceResources(device, device_table, allocator, queue_family_index, &device_resources);
 
         if (result == VK_SUCCESS)
         {
-            CopyResource copy_resource = {};
-            copy_resource.command_pool = command_pool;
-            copy_resource.allocator    = allocator;
-
-            auto pair           = copy_resources_.emplace(device, std::move(copy_resource));
-            copy_resource_entry = pair.first;
+            auto pair              = device_resources_.emplace(device, std::move(device_resources));
+            device_resources_entry = pair.first;
         }
     }
 
     if (result == VK_SUCCESS)
     {
-        auto&   copy_resource = copy_resource_entry->second;
-        auto    copy_format   = GetConversionFormat(format);
-        VkQueue queue         = VK_NULL_HANDLE;
+        auto& device_resources = device_resources_entry->second;
+        auto& copy_resource    = device_resources.copy_resources[device_resources.next_copy_resource];
+        auto  copy_format      = GetConversionFormat(format);
 
-        // Get a queue.
-        device_table->GetDeviceQueue(device, kDefaultQueueFamilyIndex, kDefaultQueueIndex, &queue);
+        // The pipelined copy is ordered with the rendering of the swapchain image by the semaphores that the present
+        // waits on.  Without them, there is nothing to order the copy with rendering that was submitted to other
+        // queues, and the copy waits for the device to become idle instead.
+        bool pipelined_copy = pipelined_ && (wait_semaphore_count > 0);
+
+        // Copy resources are used in round-robin order.  If the next copy resource is still in use by a previous
+        // pipelined screenshot, its copy needs to complete before it can be reused.
+        device_resources.next_copy_resource =
+            (device_resources.next_copy_resource + 1) % device_resources.copy_resources.size();
+
+        if (copy_resource.pending)
+        {
+            CompletePendingCopy(device, device_table, &copy_resource, true);
+        }
 
         // Get a buffer size.
         VkDeviceSize buffer_size     = copy_resource.buffer_size;
@@ -169,178 +243,58 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
         if (result == VK_SUCCESS)
         {
-            // Get a command buffer.
-            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
-
-            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
-            allocate_info.pNext                       = nullptr;
-            allocate_info.commandPool                 = copy_resource.command_pool;
-            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-            allocate_info.commandBufferCount          = 1;
+            // Get a command buffer.  Pipelined copy resources have their own command buffers, which are reset when
+            // they are recorded.
+            VkCommandBuffer command_buffer = copy_resource.command_buffer;
 
-            result = device_table->AllocateCommandBuffers(device, &allocate_info, &command_buffer);
-            if (result == VK_SUCCESS)
+            if (command_buffer == VK_NULL_HANDLE)
             {
-                VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-                begin_info.pNext                    = nullptr;
-                begin_info.flags                    = 0;
-                begin_info.pInheritanceInfo         = nullptr;
+                VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+                allocate_info.pNext                       = nullptr;
+                allocate_info.commandPool                 = device_resources.command_pool;
+                allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+                allocate_info.commandBufferCount          = 1;
 
-                result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+                result = device_table->AllocateCommandBuffers(device, &allocate_info, &command_buffer);
             }
 
             if (result == VK_SUCCESS)
             {
-                // Transition source image to target to the TRANSFER_DST layout.
-                VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-                image_barrier.pNext                           = nullptr;
-                image_barrier.srcAccessMask                   = 0;
-                image_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-                image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-                image_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-                image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-                image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-                image_barrier.image                           = image;
-                image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-                image_barrier.subresourceRange.baseArrayLayer = 0;
-                image_barrier.subresourceRange.layerCount     = 1;
-                image_barrier.subresourceRange.baseMipLevel   = 0;
-                image_barrier.subresourceRange.levelCount     = 1;
-
-                device_table->CmdPipelineBarrier(command_buffer,
-                                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                                 VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                 0,
-                                                 0,
-                                                 nullptr,
-                                                 0,
-                                                 nullptr,
-                                                 1,
-                                                 &image_barrier);
-
-                // The 'copy_image' is the image to be used with the image to buffer copy.
-                VkImage copy_image = image;
-                if (copy_resource.convert_image != VK_NULL_HANDLE)
-                {
-                    // Need to perform a blit to covert the Vulkan image format to the image file format.
-                    copy_image = copy_resource.convert_image;
-
-                    // Transition blit target to the TRANSFER_DST layout.
-                    VkImageMemoryBarrier convert_image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-                    convert_image_barrier.pNext                           = nullptr;
-                    convert_image_barrier.srcAccessMask                   = 0;
-                    convert_image_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-                    convert_image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-                    convert_image_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                    convert_image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-                    convert_image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-                    convert_image_barrier.image                           = copy_image;
-                    convert_image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-                    convert_image_barrier.subresourceRange.baseArrayLayer = 0;
-                    convert_image_barrier.subresourceRange.layerCount     = 1;
-                    convert_image_barrier.subresourceRange.baseMipLevel   = 0;
-                    convert_image_barrier.subresourceRange.levelCount     = 1;
-
-                    device_table->CmdPipelineBarrier(command_buffer,
-                                                     VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                     0,
-                                                     0,
-                                                     nullptr,
-                                                     0,
-                                                     nullptr,
-                                                     1,
-                                                     &convert_image_barrier);
-
-                    VkImageBlit blit_region;
-                    blit_region.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-                    blit_region.srcSubresource.mipLevel       = 0;
-                    blit_region.srcSubresource.baseArrayLayer = 0;
-                    blit_region.srcSubresource.layerCount     = 1;
-                    blit_region.srcOffsets[0].x               = 0;
-                    blit_region.srcOffsets[0].y               = 0;
-                    blit_region.srcOffsets[0].z               = 0;
-                    blit_region.srcOffsets[1].x               = width;
-                    blit_region.srcOffsets[1].y               = height;
-                    blit_region.srcOffsets[1].z               = 1;
-                    blit_region.dstSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-                    blit_region.dstSubresource.mipLevel       = 0;
-                    blit_region.dstSubresource.baseArrayLayer = 0;
-                    blit_region.dstSubresource.layerCount     = 1;
-                    blit_region.dstOffsets[0].x               = 0;
-                    blit_region.dstOffsets[0].y               = 0;
-                    blit_region.dstOffsets[0].z               = 0;
-                    blit_region.dstOffsets[1].x               = width;
-                    blit_region.dstOffsets[1].y               = height;
-                    blit_region.dstOffsets[1].z               = 1;
-
-                    device_table->CmdBlitImage(command_buffer,
-                                               image,
-                                               VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                                               copy_image,
-                                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                               1,
-                                               &blit_region,
-                                               VK_FILTER_NEAREST);
-
-                    // Transition blit target from the TRANSFER_DST layout to TRANSFER_SRC layout for the image to
-                    // buffer copy.
-                    convert_image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                    convert_image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-                    convert_image_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                    convert_image_barrier.newLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-
-                    device_table->CmdPipelineBarrier(command_buffer,
-                                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                     0,
-                                                     0,
-                                                     nullptr,
-                                                     0,
-                                                     nullptr,
-                                                     1,
-                                                     &convert_image_barrier);
-                }
+                result = RecordCopyCommands(device_table, command_buffer, image, width, height, copy_resource);
+            }
 
-                VkBufferImageCopy copy_region;
-                copy_region.bufferOffset                    = 0;
-                copy_region.bufferRowLength                 = 0;
-                copy_region.bufferImageHeight               = 0;
-                copy_region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-                copy_region.imageSubresource.mipLevel       = 0;
-                copy_region.imageSubresource.baseArrayLayer = 0;
-                copy_region.imageSubresource.layerCount     = 1;
-                copy_region.imageOffset                     = { 0, 0, 0 };
-                copy_region.imageExtent                     = { width, height, 1 };
-
-                device_table->CmdCopyImageToBuffer(command_buffer,
-                                                   copy_image,
-                                                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                                                   copy_resource.buffer,
-                                                   1,
-                                                   &copy_region);
-
-                // Transition source image to PRESENT_SOURCE layout for vkQueuePresentKHR.
-                image_barrier.srcAccessMask       = VK_ACCESS_TRANSFER_READ_BIT;
-                image_barrier.dstAccessMask       = 0;
-                image_barrier.oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-                image_barrier.newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-                image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-
-                device_table->CmdPipelineBarrier(command_buffer,
-                                                 VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                 VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                 0,
-                                                 0,
-                                                 nullptr,
-                                                 0,
-                                                 nullptr,
-                                                 1,
-                                                 &image_barrier);
-
-                device_table->EndCommandBuffer(command_buffer);
+            if ((result == VK_SUCCESS) && pipelined_copy)
+            {
+                // Wait on the semaphores that the present will wait on, which are signaled by the rendering of the
+                // swapchain image, and then signal them again for the present.  The copy is submitted to the present
+                // queue, so rendering on that queue that was not synchronized with a semaphore is ordered by the
+                // queue submission order and the pipeline barrier that precedes the copy.
+                std::vector<VkPipelineStageFlags> wait_stages(wait_semaphore_count, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.waitSemaphoreCount   = wait_semaphore_count;
+                submit_info.pWaitSemaphores      = wait_semaphores;
+                submit_info.pWaitDstStageMask    = wait_stages.data();
+                submit_info.commandBufferCount   = 1;
+                submit_info.pCommandBuffers      = &command_buffer;
+                submit_info.signalSemaphoreCount = wait_semaphore_count;
+                submit_info.pSignalSemaphores    = wait_semaphores;
+
+                result = device_table->QueueSubmit(queue, 1, &submit_info, copy_resource.fence);
 
+                if (result == VK_SUCCESS)
+                {
+                    copy_resource.pending         = true;
+                    copy_resource.frame_number    = current_frame_number_;
+                    copy_resource.filename_prefix = filename_prefix;
+                }
+                else
+                {
+                    GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
+                }
+            }
+            else if (result == VK_SUCCESS)
+            {
                 // Make sure any pending work is finished, as we are not waiting on any semaphores from previous
                 // submissions.
                 result = device_table->DeviceWaitIdle(device);
@@ -367,33 +321,17 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                 if (result == VK_SUCCESS)
                 {
                     void* data = nullptr;
-                    result     = allocator->MapResourceMemoryDirect(
-                        copy_resource.buffer_size, 0, &data, copy_resource.buffer_data);
+                    result     = MapCopyResource(&copy_resource, &data);
 
                     if (result == VK_SUCCESS)
                     {
-                        if ((copy_resource.memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
-                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
-                        {
-                            VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
-                            invalidate_range.pNext               = nullptr;
-                            invalidate_range.memory              = copy_resource.buffer_memory;
-                            invalidate_range.offset              = 0;
-                            invalidate_range.size                = copy_resource.buffer_size;
-
-                            allocator->InvalidateMappedMemoryRangesDirect(
-                                1, &invalidate_range, &copy_resource.buffer_memory_data);
-                        }
-
-                        std::string filename = filename_prefix;
-                        filename += ".bmp";
-
-                        if (!util::imagewriter::WriteBmpImage(filename, width, height, copy_resource.buffer_size, data))
-                        {
-                            GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write file %s",
-                                               filename.c_str());
-                        }
-
+                        WriteImageFile(filename_prefix,
+                                       current_frame_number_,
+                                       copy_resource.format,
+                                       width,
+                                       height,
+                                       copy_resource.buffer_size,
+                                       data);
                         allocator->UnmapResourceMemoryDirect(copy_resource.buffer_data);
                     }
                 }
@@ -402,7 +340,10 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                     GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
                 }
 
-                device_table->FreeCommandBuffers(device, copy_resource.command_pool, 1, &command_buffer);
+                if (copy_resource.command_buffer == VK_NULL_HANDLE)
+                {
+                    device_table->FreeCommandBuffers(device, device_resources.command_pool, 1, &command_buffer);
+                }
             }
         }
         else
@@ -414,19 +355,30 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
 void ScreenshotHandler::DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table)
 {
-    auto entry = copy_resources_.find(device);
-    if (entry != copy_resources_.end())
+    auto entry = device_resources_.find(device);
+    if (entry != device_resources_.end())
     {
-        auto& copy_resource = entry->second;
+        auto& device_resources = entry->second;
 
-        if (device_table != nullptr)
+        // Screenshots that are still in flight are completed before their resources are destroyed.
+        CompletePendingCopies(device, &device_resources, true);
+
+        for (auto& copy_resource : device_resources.copy_resources)
         {
-            device_table->DestroyCommandPool(entry->first, copy_resource.command_pool, nullptr);
+            if ((device_table != nullptr) && (copy_resource.fence != VK_NULL_HANDLE))
+            {
+                device_table->DestroyFence(device, copy_resource.fence, nullptr);
+            }
+
+            DestroyCopyResource(device, &copy_resource);
         }
 
-        DestroyCopyResource(device, &copy_resource);
+        if (device_table != nullptr)
+        {
+            device_table->DestroyCommandPool(entry->first, device_resources.command_pool, nullptr);
+        }
 
-        copy_resources_.erase(entry);
+        device_resources_.erase(entry);
     }
 }
 
@@ -473,9 +425,46 @@ bool ScreenshotHandler::IsSrgbFormat(VkFormat image_format) const
     }
 }
 
+bool ScreenshotHandler::GetImageDataFormat(VkFormat                        image_format,
+                                           util::imagewriter::DataFormats* data_format) const
+{
+    assert(data_format != nullptr);
+
+    switch (image_format)
+    {
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            *data_format = util::imagewriter::DataFormats::kB8G8R8A8;
+            return true;
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            *data_format = util::imagewriter::DataFormats::kR8G8B8A8;
+            return true;
+        case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
+            *data_format = util::imagewriter::DataFormats::kA2R10G10B10;
+            return true;
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+            *data_format = util::imagewriter::DataFormats::kA2B10G10R10;
+            return true;
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            *data_format = util::imagewriter::DataFormats::kR16G16B16A16Sfloat;
+            return true;
+        default:
+            return false;
+    }
+}
+
 VkFormat ScreenshotHandler::GetConversionFormat(VkFormat image_format) const
 {
-    if (IsSrgbFormat(image_format))
+    util::imagewriter::DataFormats data_format;
+
+    if (GetImageDataFormat(image_format, &data_format))
+    {
+        // The image data is copied without a GPU format conversion, and is converted by the CPU when the file is
+        // written.
+        return image_format;
+    }
+    else if (IsSrgbFormat(image_format))
     {
         return kImageFormats[static_cast<size_t>(screenshot_format_)][kSrgbIndex];
     }
@@ -722,5 +711,507 @@ void ScreenshotHandler::DestroyCopyResource(VkDevice device, CopyResource* copy_
     }
 }
 
+VkResult ScreenshotHandler::CreateDeviceResources(VkDevice                   device,
+                                                  const encode::DeviceTable* device_table,
+                                                  VulkanResourceAllocator*   allocator,
+                                                  uint32_t                   queue_family_index,
+                                                  DeviceResources*           device_resources) const
+{
+    assert((device_table != nullptr) && (device_resources != nullptr));
+
+    VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    create_info.pNext                   = nullptr;
+    create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    create_info.queueFamilyIndex        = queue_family_index;
+
+    if (pipelined_)
+    {
+        // Pipelined command buffers are reset and re-recorded for each screenshot.
+        create_info.flags |= VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    }
+
+    VkResult result = device_table->CreateCommandPool(device, &create_info, nullptr, &device_resources->command_pool);
+
+    if (result == VK_SUCCESS)
+    {
+        device_resources->device_table       = device_table;
+        device_resources->queue_family_index = queue_family_index;
+        device_resources->copy_resources.resize(pipelined_ ? kPipelinedCopyResourceCount : 1);
+
+        for (auto& copy_resource : device_resources->copy_resources)
+        {
+            copy_resource.allocator = allocator;
+        }
+
+        if (pipelined_)
+        {
+            // Each pipelined copy resource has a command buffer that is recorded for each screenshot and a fence that
+            // is signaled when the screenshot's copy completes.
+            std::vector<VkCommandBuffer> command_buffers(device_resources->copy_resources.size(), VK_NULL_HANDLE);
+
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = device_resources->command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = static_cast<uint32_t>(command_buffers.size());
+
+            result = device_table->AllocateCommandBuffers(device, &allocate_info, command_buffers.data());
+
+            VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_create_info.pNext             = nullptr;
+            fence_create_info.flags             = 0;
+
+            for (size_t i = 0; (i < command_buffers.size()) && (result == VK_SUCCESS); ++i)
+            {
+                auto& copy_resource          = device_resources->copy_resources[i];
+                copy_resource.command_buffer = command_buffers[i];
+
+                result = device_table->CreateFence(device, &fence_create_info, nullptr, &copy_resource.fence);
+            }
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            for (const auto& copy_resource : device_resources->copy_resources)
+            {
+                if (copy_resource.fence != VK_NULL_HANDLE)
+                {
+                    device_table->DestroyFence(device, copy_resource.fence, nullptr);
+                }
+            }
+
+            // Destroying the pool frees any command buffers that were allocated from it.
+            device_table->DestroyCommandPool(device, device_resources->command_pool, nullptr);
+            device_resources->command_pool = VK_NULL_HANDLE;
+            device_resources->copy_resources.clear();
+        }
+    }
+
+    return result;
+}
+
+VkResult ScreenshotHandler::RecordCopyCommands(const encode::DeviceTable* device_table,
+                                               VkCommandBuffer            command_buffer,
+                                               VkImage                    image,
+                                               uint32_t                   width,
+                                               uint32_t                   height,
+                                               const CopyResource&        copy_resource) const
+{
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.pNext                    = nullptr;
+    begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    begin_info.pInheritanceInfo         = nullptr;
+
+    VkResult result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+
+    if (result == VK_SUCCESS)
+    {
+        // Transition source image to the TRANSFER_SRC layout.  The barrier waits for prior writes to the image from
+        // work submitted to the same queue, which is not otherwise ordered with the copy when the device is not idled.
+        VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        image_barrier.pNext                           = nullptr;
+        image_barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+        image_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+        image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        image_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        image_barrier.image                           = image;
+        image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        image_barrier.subresourceRange.baseArrayLayer = 0;
+        image_barrier.subresourceRange.layerCount     = 1;
+        image_barrier.subresourceRange.baseMipLevel   = 0;
+        image_barrier.subresourceRange.levelCount     = 1;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         1,
+                                         &image_barrier);
+
+        // The 'copy_image' is the image to be used with the image to buffer copy.
+        VkImage copy_image = image;
+        if (copy_resource.convert_image != VK_NULL_HANDLE)
+        {
+            // Need to perform a blit to covert the Vulkan image format to the image file format.
+            copy_image = copy_resource.convert_image;
+
+            // Transition blit target to the TRANSFER_DST layout.
+            VkImageMemoryBarrier convert_image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            convert_image_barrier.pNext                           = nullptr;
+            convert_image_barrier.srcAccessMask                   = 0;
+            convert_image_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            convert_image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+            convert_image_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            convert_image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            convert_image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            convert_image_barrier.image                           = copy_image;
+            convert_image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            convert_image_barrier.subresourceRange.baseArrayLayer = 0;
+            convert_image_barrier.subresourceRange.layerCount     = 1;
+            convert_image_barrier.subresourceRange.baseMipLevel   = 0;
+            convert_image_barrier.subresourceRange.levelCount     = 1;
+
+            device_table->CmdPipelineBarrier(command_buffer,
+                                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                             0,
+                                             0,
+                                             nullptr,
+                                             0,
+                                             nullptr,
+                                             1,
+                                             &convert_image_barrier);
+
+            VkImageBlit blit_region;
+            blit_region.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit_region.srcSubresource.mipLevel       = 0;
+            blit_region.srcSubresource.baseArrayLayer = 0;
+            blit_region.srcSubresource.layerCount     = 1;
+            blit_region.srcOffsets[0].x               = 0;
+            blit_region.srcOffsets[0].y               = 0;
+            blit_region.srcOffsets[0].z               = 0;
+            blit_region.srcOffsets[1].x               = width;
+            blit_region.srcOffsets[1].y               = height;
+            blit_region.srcOffsets[1].z               = 1;
+            blit_region.dstSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit_region.dstSubresource.mipLevel       = 0;
+            blit_region.dstSubresource.baseArrayLayer = 0;
+            blit_region.dstSubresource.layerCount     = 1;
+            blit_region.dstOffsets[0].x               = 0;
+            blit_region.dstOffsets[0].y               = 0;
+            blit_region.dstOffsets[0].z               = 0;
+            blit_region.dstOffsets[1].x               = width;
+            blit_region.dstOffsets[1].y               = height;
+            blit_region.dstOffsets[1].z               = 1;
+
+            device_table->CmdBlitImage(command_buffer,
+                                       image,
+                                       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                       copy_image,
+                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       1,
+                                       &blit_region,
+                                       VK_FILTER_NEAREST);
+
+            // Transition blit target from the TRANSFER_DST layout to TRANSFER_SRC layout for the image to buffer copy.
+            convert_image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            convert_image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            convert_image_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            convert_image_barrier.newLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+            device_table->CmdPipelineBarrier(command_buffer,
+                                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                             0,
+                                             0,
+                                             nullptr,
+                                             0,
+                                             nullptr,
+                                             1,
+                                             &convert_image_barrier);
+        }
+
+        VkBufferImageCopy copy_region;
+        copy_region.bufferOffset                    = 0;
+        copy_region.bufferRowLength                 = 0;
+        copy_region.bufferImageHeight               = 0;
+        copy_region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        copy_region.imageSubresource.mipLevel       = 0;
+        copy_region.imageSubresource.baseArrayLayer = 0;
+        copy_region.imageSubresource.layerCount     = 1;
+        copy_region.imageOffset                     = { 0, 0, 0 };
+        copy_region.imageExtent                     = { width, height, 1 };
+
+        device_table->CmdCopyImageToBuffer(
+            command_buffer, copy_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, copy_resource.buffer, 1, &copy_region);
+
+        // Transition source image to PRESENT_SOURCE layout for vkQueuePresentKHR.
+        image_barrier.srcAccessMask       = VK_ACCESS_TRANSFER_READ_BIT;
+        image_barrier.dstAccessMask       = 0;
+        image_barrier.oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        image_barrier.newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         1,
+                                         &image_barrier);
+
+        result = device_table->EndCommandBuffer(command_buffer);
+    }
+
+    return result;
+}
+
+VkResult ScreenshotHandler::MapCopyResource(CopyResource* copy_resource, void** data) const
+{
+    assert((copy_resource != nullptr) && (data != nullptr));
+
+    auto allocator = copy_resource->allocator;
+
+    VkResult result =
+        allocator->MapResourceMemoryDirect(copy_resource->buffer_size, 0, data, copy_resource->buffer_data);
+
+    if ((result == VK_SUCCESS) && ((copy_resource->memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
+                                   VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        invalidate_range.pNext               = nullptr;
+        invalidate_range.memory              = copy_resource->buffer_memory;
+        invalidate_range.offset              = 0;
+        invalidate_range.size                = copy_resource->buffer_size;
+
+        allocator->InvalidateMappedMemoryRangesDirect(1, &invalidate_range, &copy_resource->buffer_memory_data);
+    }
+
+    return result;
+}
+
+void ScreenshotHandler::CompletePendingCopy(VkDevice                   device,
+                                            const encode::DeviceTable* device_table,
+                                            CopyResource*              copy_resource,
+                                            bool                       wait)
+{
+    assert((device_table != nullptr) && (copy_resource != nullptr) && copy_resource->pending);
+
+    VkResult result = VK_SUCCESS;
+
+    if (wait)
+    {
+        result = device_table->WaitForFences(
+            device, 1, &copy_resource->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    }
+    else
+    {
+        result = device_table->GetFenceStatus(device, copy_resource->fence);
+
+        if (result == VK_NOT_READY)
+        {
+            return;
+        }
+    }
+
+    copy_resource->pending = false;
+    device_table->ResetFences(device, 1, &copy_resource->fence);
+
+    void* data = nullptr;
+
+    if (result == VK_SUCCESS)
+    {
+        result = MapCopyResource(copy_resource, &data);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // The image data is copied out of the staging buffer so that the copy resource can be reused while the file
+        // is written by a worker thread.
+        size_t data_size  = static_cast<size_t>(copy_resource->buffer_size);
+        auto   image_data = std::make_shared<std::vector<uint8_t>>(data_size);
+
+        util::platform::MemoryCopy(image_data->data(), data_size, data, data_size);
+        copy_resource->allocator->UnmapResourceMemoryDirect(copy_resource->buffer_data);
+
+        std::string filename_prefix = std::move(copy_resource->filename_prefix);
+        uint32_t    frame_number    = copy_resource->frame_number;
+        VkFormat    format          = copy_resource->format;
+        uint32_t    width           = copy_resource->width;
+        uint32_t    height          = copy_resource->height;
+
+        image_writer_->Submit(
+            [this, filename_prefix, frame_number, format, width, height, image_data]() {
+                WriteImageFile(
+                    filename_prefix, frame_number, format, width, height, image_data->size(), image_data->data());
+            },
+            kMaxPendingImageWrites);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
+    }
+}
+
+void ScreenshotHandler::CompletePendingCopies(VkDevice device, DeviceResources* device_resources, bool wait)
+{
+    assert(device_resources != nullptr);
+
+    // Process copies from oldest to newest, starting with the copy resource that will be used next.
+    size_t count = device_resources->copy_resources.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto& copy_resource = device_resources->copy_resources[(device_resources->next_copy_resource + i) % count];
+        if (copy_resource.pending)
+        {
+            CompletePendingCopy(device, device_resources->device_table, &copy_resource, wait);
+        }
+    }
+}
+
+bool ScreenshotHandler::WriteImageFile(const std::string& filename_prefix,
+                                       uint32_t           frame_number,
+                                       VkFormat           format,
+                                       uint32_t           width,
+                                       uint32_t           height,
+                                       VkDeviceSize       data_size,
+                                       const void*        data)
+{
+    util::imagewriter::DataFormats data_format = util::imagewriter::DataFormats::kB8G8R8A8;
+    std::string                    filename    = filename_prefix;
+    bool                           success     = false;
+
+    if (!GetImageDataFormat(format, &data_format))
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: unsupported copy format %u",
+                           static_cast<uint32_t>(format));
+        return false;
+    }
+
+    if ((static_cast<uint64_t>(height) * width * util::imagewriter::GetPixelSize(data_format)) > data_size)
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: image data is smaller than expected");
+        return false;
+    }
+
+    switch (screenshot_format_)
+    {
+        case ScreenshotFormat::kHash:
+            return WriteImageHashes(filename_prefix, frame_number, format, data_format, width, height, data);
+        case ScreenshotFormat::kPng:
+            filename += ".png";
+            success = util::imagewriter::WritePngImage(filename, width, height, data_size, data, data_format);
+            break;
+        case ScreenshotFormat::kQoi:
+            filename += ".qoi";
+            success = util::imagewriter::WriteQoiImage(filename, width, height, data_size, data, data_format);
+            break;
+        case ScreenshotFormat::kBmp:
+        default:
+            filename += ".bmp";
+            success = util::imagewriter::WriteBmpImage(filename, width, height, data_size, data, data_format);
+            break;
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write file %s", filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool ScreenshotHandler::WriteImageHashes(const std::string&             filename_prefix,
+                                         uint32_t                       frame_number,
+                                         VkFormat                       format,
+                                         util::imagewriter::DataFormats data_format,
+                                         uint32_t                       width,
+                                         uint32_t                       height,
+                                         const void*                    data)
+{
+    const uint32_t kRgbaBpp = 4;
+    const uint32_t kRgbBpp  = 3;
+
+    size_t                row_pitch = static_cast<size_t>(width) * util::imagewriter::GetPixelSize(data_format);
+    auto                  bytes     = reinterpret_cast<const uint8_t*>(data);
+    uint64_t              hash      = util::hash::kFnv1a64OffsetBasis;
+    std::vector<uint8_t>  rgba_row(static_cast<size_t>(width) * kRgbaBpp);
+    std::vector<uint8_t>  rgb_row(static_cast<size_t>(width) * kRgbBpp);
+    std::vector<uint64_t> block_sums(kPerceptualHashGridSize * kPerceptualHashGridSize, 0);
+    std::vector<uint64_t> block_counts(kPerceptualHashGridSize * kPerceptualHashGridSize, 0);
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        uint64_t block_row = (static_cast<uint64_t>(y) * kPerceptualHashGridSize / height) * kPerceptualHashGridSize;
+
+        util::imagewriter::ConvertPixelsToRgba8(
+            &bytes[static_cast<size_t>(y) * row_pitch], data_format, width, rgba_row.data());
+
+        // The alpha channel is excluded from the hashes, as swapchain alpha values are not displayed.
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            const uint8_t* rgba = &rgba_row[static_cast<size_t>(x) * kRgbaBpp];
+            uint8_t*       rgb  = &rgb_row[static_cast<size_t>(x) * kRgbBpp];
+            rgb[0]              = rgba[0];
+            rgb[1]              = rgba[1];
+            rgb[2]              = rgba[2];
+
+            uint64_t block = block_row + (static_cast<uint64_t>(x) * kPerceptualHashGridSize / width);
+            block_sums[block] += (77 * rgba[0]) + (150 * rgba[1]) + (29 * rgba[2]);
+            ++block_counts[block];
+        }
+
+        hash = util::hash::Fnv1a64(rgb_row.data(), rgb_row.size(), hash);
+    }
+
+    // Each bit of the perceptual hash is set when the average luminance of its block is above the average of all
+    // blocks, which is stable under small changes such as dithering and compression artifacts.
+    uint64_t block_average_sum = 0;
+    for (size_t i = 0; i < block_sums.size(); ++i)
+    {
+        block_sums[i] = (block_counts[i] > 0) ? (block_sums[i] / block_counts[i]) : 0;
+        block_average_sum += block_sums[i];
+    }
+
+    uint64_t perceptual_hash = 0;
+    uint64_t average         = block_average_sum / block_sums.size();
+    for (size_t i = 0; i < block_sums.size(); ++i)
+    {
+        if (block_sums[i] > average)
+        {
+            perceptual_hash |= (1ull << i);
+        }
+    }
+
+    // The manifest identifies images by their file name without the directory.
+    std::string image_name = filename_prefix;
+    size_t      separator  = image_name.find_last_of("/\\");
+    if (separator != std::string::npos)
+    {
+        image_name.erase(0, separator + 1);
+    }
+
+    char hash_values[64];
+    snprintf(hash_values, sizeof(hash_values), "%016" PRIx64 ",%016" PRIx64 "\n", hash, perceptual_hash);
+
+    std::string entry = std::to_string(frame_number) + "," + image_name + "," + std::to_string(width) + "," +
+                        std::to_string(height) + "," + util::ToString<VkFormat>(format) + "," + hash_values;
+
+    // Entries are written as they are computed, so that the manifest is usable if replay terminates early.  With
+    // pipelined screenshots, entries for consecutive frames may be written out of order.
+    std::lock_guard<std::mutex> lock(hash_manifest_mutex_);
+
+    if (hash_manifest_file_ == nullptr)
+    {
+        int32_t result = util::platform::FileOpen(&hash_manifest_file_, hash_manifest_filename_.c_str(), "w");
+
+        if ((result != 0) || (hash_manifest_file_ == nullptr))
+        {
+            GFXRECON_LOG_ERROR("Screenshot hashes could not be written: failed to open file %s",
+                               hash_manifest_filename_.c_str());
+            hash_manifest_file_ = nullptr;
+            return false;
+        }
+
+        util::platform::FilePuts(kHashManifestHeader, hash_manifest_file_);
+    }
+
+    util::platform::FilePuts(entry.c_str(), hash_manifest_file_);
+    util::platform::FileFlush(hash_manifest_file_);
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
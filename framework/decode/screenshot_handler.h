@@ -27,9 +27,14 @@
 #include "decode/vulkan_resource_allocator.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/image_writer.h"
+#include "util/thread_pool.h"
 
 #include "vulkan/vulkan.h"
 
+#include <cstdio>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -37,12 +42,28 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Writes swapchain images to files for the frames in the screenshot ranges.  By default, the image copy is submitted
+// and completed immediately, and the file is written before WriteImage() returns.  In pipelined mode, each device has a
+// ring of copy resources that are submitted to the present queue with a fence, waiting on the present's semaphores
+// instead of waiting for the device to become idle.  Presents without wait semaphores use the immediate copy.
+// Completed copies are read back when their copy resource is reused or at the end of a frame, and the image files are
+// written by a pool of worker threads, allowing screenshot generation to overlap with the replay of subsequent frames.
+// With the hash screenshot format, no image files are written; exact and perceptual hashes of each image are written to
+// a manifest file instead.
 class ScreenshotHandler
 {
   public:
-    ScreenshotHandler(ScreenshotFormat screenshot_format, const std::vector<ScreenshotRange>& screenshot_ranges);
+    ScreenshotHandler(ScreenshotFormat                    screenshot_format,
+                      const std::vector<ScreenshotRange>& screenshot_ranges,
+                      bool                                pipelined,
+                      const std::string&                  hash_manifest_filename);
 
-    ScreenshotHandler(ScreenshotFormat screenshot_format, std::vector<ScreenshotRange>&& screenshot_ranges);
+    ScreenshotHandler(ScreenshotFormat               screenshot_format,
+                      std::vector<ScreenshotRange>&& screenshot_ranges,
+                      bool                           pipelined,
+                      const std::string&             hash_manifest_filename);
+
+    ~ScreenshotHandler();
 
     uint32_t GetCurrentFrame() const { return current_frame_number_; }
 
@@ -58,14 +79,17 @@ class ScreenshotHandler
                     VkImage                                 image,
                     VkFormat                                format,
                     uint32_t                                width,
-                    uint32_t                                height);
+                    uint32_t                                height,
+                    VkQueue                                 queue,
+                    uint32_t                                queue_family_index,
+                    uint32_t                                wait_semaphore_count,
+                    const VkSemaphore*                      wait_semaphores);
 
     void DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table);
 
   private:
     struct CopyResource
     {
-        VkCommandPool                         command_pool{ VK_NULL_HANDLE };
         VulkanResourceAllocator*              allocator{ nullptr };
         VkDeviceSize                          buffer_size{ 0 };
         VkDeviceMemory                        buffer_memory{ VK_NULL_HANDLE };
@@ -80,13 +104,30 @@ class ScreenshotHandler
         uint32_t                              width{ 0 };
         uint32_t                              height{ 0 };
         VkMemoryPropertyFlags                 memory_property_flags{ 0 };
+        VkCommandBuffer                       command_buffer{ VK_NULL_HANDLE };
+        VkFence                               fence{ VK_NULL_HANDLE };
+        bool                                  pending{ false };
+        uint32_t                              frame_number{ 0 };
+        std::string                           filename_prefix;
+    };
+
+    struct DeviceResources
+    {
+        VkCommandPool              command_pool{ VK_NULL_HANDLE };
+        const encode::DeviceTable* device_table{ nullptr };
+        uint32_t                   queue_family_index{ 0 };
+        std::vector<CopyResource>  copy_resources;
+        size_t                     next_copy_resource{ 0 };
     };
 
-    typedef std::unordered_map<VkDevice, CopyResource> CommandPools;
+    typedef std::unordered_map<VkDevice, DeviceResources> DeviceResourceMap;
 
   private:
     bool IsSrgbFormat(VkFormat image_format) const;
 
+    // Returns true if the image data can be written to a file with a CPU format conversion.
+    bool GetImageDataFormat(VkFormat image_format, util::imagewriter::DataFormats* data_format) const;
+
     VkFormat GetConversionFormat(VkFormat image_format) const;
 
     VkDeviceSize GetCopyBufferSize(VkDevice                   device,
@@ -111,12 +152,59 @@ class ScreenshotHandler
 
     void DestroyCopyResource(VkDevice device, CopyResource* copy_resource) const;
 
+    VkResult CreateDeviceResources(VkDevice                   device,
+                                   const encode::DeviceTable* device_table,
+                                   VulkanResourceAllocator*   allocator,
+                                   uint32_t                   queue_family_index,
+                                   DeviceResources*           device_resources) const;
+
+    VkResult RecordCopyCommands(const encode::DeviceTable* device_table,
+                                VkCommandBuffer            command_buffer,
+                                VkImage                    image,
+                                uint32_t                   width,
+                                uint32_t                   height,
+                                const CopyResource&        copy_resource) const;
+
+    VkResult MapCopyResource(CopyResource* copy_resource, void** data) const;
+
+    // Reads back a pending pipelined copy and queues the image file write.  When wait is false, the copy is only read
+    // back if it has already completed.
+    void CompletePendingCopy(VkDevice                   device,
+                             const encode::DeviceTable* device_table,
+                             CopyResource*              copy_resource,
+                             bool                       wait);
+
+    void CompletePendingCopies(VkDevice device, DeviceResources* device_resources, bool wait);
+
+    bool WriteImageFile(const std::string& filename_prefix,
+                        uint32_t           frame_number,
+                        VkFormat           format,
+                        uint32_t           width,
+                        uint32_t           height,
+                        VkDeviceSize       data_size,
+                        const void*        data);
+
+    // Computes a 64-bit FNV-1a hash of the image's RGB values and a 64-bit average hash of the luminance of an 8x8
+    // grid of image blocks, and writes them to the hash manifest.
+    bool WriteImageHashes(const std::string&             filename_prefix,
+                          uint32_t                       frame_number,
+                          VkFormat                       format,
+                          util::imagewriter::DataFormats data_format,
+                          uint32_t                       width,
+                          uint32_t                       height,
+                          const void*                    data);
+
   private:
-    uint32_t                     current_frame_number_;
-    CommandPools                 copy_resources_;
-    ScreenshotFormat             screenshot_format_;
-    std::vector<ScreenshotRange> screenshot_ranges_;
-    size_t                       current_range_index_;
+    uint32_t                          current_frame_number_;
+    DeviceResourceMap                 device_resources_;
+    ScreenshotFormat                  screenshot_format_;
+    std::vector<ScreenshotRange>      screenshot_ranges_;
+    size_t                            current_range_index_;
+    bool                              pipelined_;
+    std::unique_ptr<util::ThreadPool> image_writer_;
+    std::string                       hash_manifest_filename_;
+    FILE*                             hash_manifest_file_;
+    std::mutex                        hash_manifest_mutex_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -38,6 +38,27 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Decodes an array of structs one struct at a time.  Structs with a fixed memory layout have DecodeStructArray()
+// overloads, declared with the struct decoders, that copy the entire array from the parameter buffer.
+template <typename T>
+size_t DecodeStructArray(
+    const uint8_t* buffer, size_t buffer_size, T* wrappers, typename T::struct_type* values, size_t len)
+{
+    size_t bytes_read = 0;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+
+        // Note: We only expect this function to be used with structs that have a decode_struct function.
+        //       If an error is encoutered here due to a new struct type, the struct decoders need to be
+        //       updated to support the new type.
+        bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &wrappers[i]);
+    }
+
+    return bytes_read;
+}
+
 template <typename T>
 class StructPointerDecoder : public PointerDecoderBase
 {
@@ -135,15 +156,8 @@ class StructPointerDecoder : public PointerDecoderBase
 
             if (HasData())
             {
-                for (size_t i = 0; i < len; ++i)
-                {
-                    decoded_structs_[i].decoded_value = &struct_memory_[i];
-
-                    // Note: We only expect this class to be used with structs that have a decode_struct function.
-                    //       If an error is encoutered here due to a new struct type, the struct decoders need to be
-                    //       updated to support the new type.
-                    bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_structs_[i]);
-                }
+                bytes_read += DecodeStructArray(
+                    (buffer + bytes_read), (buffer_size - bytes_read), decoded_structs_, struct_memory_, len);
             }
         }
 
@@ -220,15 +234,11 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
                         DecodeAllocator::Allocate<typename T::struct_type>(inner_len);
                     T* inner_decoded_structs = DecodeAllocator::Allocate<T>(inner_len);
 
-                    for (size_t j = 0; j < inner_len; ++j)
-                    {
-                        inner_decoded_structs[j].decoded_value = &inner_struct_memory[j];
-                        // Note: We only expect this class to be used with structs that have a decode_struct function.
-                        //       If an error is encoutered here due to a new struct type, the struct decoders need to be
-                        //       updated to support the new type.
-                        bytes_read +=
-                            DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &inner_decoded_structs[j]);
-                    }
+                    bytes_read += DecodeStructArray((buffer + bytes_read),
+                                                    (buffer_size - bytes_read),
+                                                    inner_decoded_structs,
+                                                    inner_struct_memory,
+                                                    inner_len);
 
                     struct_memory_[i]   = inner_struct_memory;
                     decoded_structs_[i] = inner_decoded_structs;
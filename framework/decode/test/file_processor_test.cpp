@@ -0,0 +1,195 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+const char     kPreloadTestFile[]  = "gfxrecon_decode_test_preload.gfxr";
+const uint32_t kPreloadFrameCount  = 4;
+const size_t   kLargeParameterSize = 4000;
+const size_t   kSmallParameterSize = 100;
+
+void WriteFunctionCall(FILE*                       file,
+                       gfxrecon::format::ApiCallId call_id,
+                       size_t                      parameter_size,
+                       gfxrecon::util::Compressor* compressor)
+{
+    std::vector<uint8_t> parameters(parameter_size);
+    for (size_t i = 0; i < parameter_size; ++i)
+    {
+        parameters[i] = static_cast<uint8_t>(i % 7);
+    }
+
+    gfxrecon::format::BlockHeader block_header;
+    gfxrecon::format::ThreadId    thread_id = 1;
+
+    if (compressor != nullptr)
+    {
+        std::vector<uint8_t> compressed;
+        uint64_t             uncompressed_size = parameter_size;
+        size_t compressed_size = compressor->Compress(parameter_size, parameters.data(), &compressed, 0);
+
+        REQUIRE(compressed_size > 0);
+
+        block_header.type = gfxrecon::format::BlockType::kCompressedFunctionCallBlock;
+        block_header.size = sizeof(call_id) + sizeof(thread_id) + sizeof(uncompressed_size) + compressed_size;
+
+        fwrite(&block_header, sizeof(block_header), 1, file);
+        fwrite(&call_id, sizeof(call_id), 1, file);
+        fwrite(&thread_id, sizeof(thread_id), 1, file);
+        fwrite(&uncompressed_size, sizeof(uncompressed_size), 1, file);
+        fwrite(compressed.data(), 1, compressed_size, file);
+    }
+    else
+    {
+        block_header.type = gfxrecon::format::BlockType::kFunctionCallBlock;
+        block_header.size = sizeof(call_id) + sizeof(thread_id) + parameter_size;
+
+        fwrite(&block_header, sizeof(block_header), 1, file);
+        fwrite(&call_id, sizeof(call_id), 1, file);
+        fwrite(&thread_id, sizeof(thread_id), 1, file);
+        fwrite(parameters.data(), 1, parameter_size, file);
+    }
+}
+
+// Writes a capture file with kPreloadFrameCount frames, followed by the first last_block_size bytes of an additional
+// block, and returns the size of the file.
+uint64_t WritePreloadTestFile(gfxrecon::format::CompressionType compression_type, size_t last_block_size)
+{
+    std::unique_ptr<gfxrecon::util::Compressor> compressor(gfxrecon::format::CreateCompressor(compression_type));
+
+    FILE* file = nullptr;
+    REQUIRE(gfxrecon::util::platform::FileOpen(&file, kPreloadTestFile, "wb") == 0);
+
+    gfxrecon::format::FileHeader     file_header;
+    gfxrecon::format::FileOptionPair option = { gfxrecon::format::FileOption::kCompressionType, compression_type };
+
+    file_header.fourcc        = GFXRECON_FOURCC;
+    file_header.major_version = 0;
+    file_header.minor_version = 0;
+    file_header.num_options   = 1;
+
+    fwrite(&file_header, sizeof(file_header), 1, file);
+    fwrite(&option, sizeof(option), 1, file);
+
+    for (uint32_t i = 0; i < kPreloadFrameCount; ++i)
+    {
+        WriteFunctionCall(
+            file, gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule, kLargeParameterSize, compressor.get());
+        WriteFunctionCall(
+            file, gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule, kSmallParameterSize, nullptr);
+        WriteFunctionCall(
+            file, gfxrecon::format::ApiCallId::ApiCall_vkQueuePresentKHR, kSmallParameterSize, compressor.get());
+    }
+
+    uint64_t file_size = static_cast<uint64_t>(ftell(file)) + last_block_size;
+
+    WriteFunctionCall(
+        file, gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule, kLargeParameterSize, compressor.get());
+    gfxrecon::util::platform::FileClose(file);
+
+    // Rewrite the file without the end of the last block, leaving an incomplete block at the end of the file.
+    std::vector<uint8_t> data(static_cast<size_t>(file_size));
+
+    REQUIRE(gfxrecon::util::platform::FileOpen(&file, kPreloadTestFile, "rb") == 0);
+    REQUIRE(fread(data.data(), 1, data.size(), file) == data.size());
+    gfxrecon::util::platform::FileClose(file);
+
+    REQUIRE(gfxrecon::util::platform::FileOpen(&file, kPreloadTestFile, "wb") == 0);
+    fwrite(data.data(), 1, data.size(), file);
+    gfxrecon::util::platform::FileClose(file);
+
+    return file_size;
+}
+
+uint64_t ProcessPreloadTestFile(uint32_t first_frame, uint32_t last_frame)
+{
+    gfxrecon::decode::FileProcessor file_processor;
+
+    REQUIRE(file_processor.Initialize(kPreloadTestFile));
+
+    if (first_frame > 0)
+    {
+        file_processor.SetPreloadFrames(first_frame, last_frame);
+    }
+
+    REQUIRE(file_processor.ProcessAllFrames());
+    REQUIRE(file_processor.GetCurrentFrameNumber() == kPreloadFrameCount);
+
+    return file_processor.GetNumBytesRead();
+}
+
+void CheckPreloadBytesRead(gfxrecon::format::CompressionType compression_type)
+{
+    SECTION("Preloading a range in the middle of the file counts each byte once")
+    {
+        uint64_t file_size = WritePreloadTestFile(compression_type, 0);
+
+        REQUIRE(ProcessPreloadTestFile(0, 0) == file_size);
+        REQUIRE(ProcessPreloadTestFile(2, 3) == file_size);
+    }
+
+    SECTION("Preloading a range that ends in the data of an incomplete block counts each byte once")
+    {
+        uint64_t file_size = WritePreloadTestFile(
+            compression_type, sizeof(gfxrecon::format::BlockHeader) + sizeof(gfxrecon::format::ApiCallId) + 10);
+
+        REQUIRE(ProcessPreloadTestFile(3, kPreloadFrameCount + 1) == file_size);
+    }
+
+    SECTION("Preloading a range that ends in the header of an incomplete block counts each byte once")
+    {
+        uint64_t file_size = WritePreloadTestFile(compression_type, sizeof(gfxrecon::format::BlockHeader) / 2);
+
+        REQUIRE(ProcessPreloadTestFile(1, kPreloadFrameCount + 1) == file_size);
+    }
+
+    remove(kPreloadTestFile);
+}
+
+} // namespace
+
+TEST_CASE("the number of bytes read is the input file offset when preloading frames", "[preload]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    SECTION("Uncompressed file") { CheckPreloadBytesRead(gfxrecon::format::CompressionType::kNone); }
+
+#if defined(ENABLE_ZLIB_COMPRESSION)
+    SECTION("Compressed file") { CheckPreloadBytesRead(gfxrecon::format::CompressionType::kZlib); }
+#endif
+
+    gfxrecon::util::Log::Release();
+}
@@ -0,0 +1,665 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "decode/referenced_resource_table.h"
+#include "format/format.h"
+
+#include <map>
+#include <random>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+using gfxrecon::decode::ReferencedResourceTable;
+using gfxrecon::format::HandleId;
+
+namespace
+{
+
+// Map based model of the table, following the original implementation that stored resource, container, and user info
+// in hash maps of shared objects.  Weak references to removed containers are modeled by looking up the container ID.
+class ReferenceModel
+{
+  public:
+    void AddResource(HandleId resource_id)
+    {
+        if (resource_id != gfxrecon::format::kNullHandleId)
+        {
+            resources_.emplace(resource_id, Resource{});
+        }
+    }
+
+    void AddResource(HandleId parent_id, HandleId resource_id)
+    {
+        if ((parent_id != gfxrecon::format::kNullHandleId) && (resource_id != gfxrecon::format::kNullHandleId) &&
+            (resources_.count(parent_id) != 0))
+        {
+            if (resources_.count(resource_id) == 0)
+            {
+                Resource resource;
+                resource.is_child = true;
+                resources_.emplace(resource_id, resource);
+            }
+
+            resources_[parent_id].children.push_back(resource_id);
+        }
+    }
+
+    void AddResourceToContainer(HandleId container_id, HandleId resource_id, uint32_t binding, uint32_t element)
+    {
+        auto container = containers_.find(container_id);
+        if ((container != containers_.end()) && (resources_.count(resource_id) != 0))
+        {
+            container->second.resources.insert(resource_id);
+            container->second.bindings[binding].insert(std::make_pair(element, resource_id));
+        }
+    }
+
+    void AddResourceToUser(HandleId user_id, HandleId resource_id)
+    {
+        auto user = users_.find(user_id);
+        if ((user != users_.end()) && (resources_.count(resource_id) != 0))
+        {
+            user->second.resources.insert(resource_id);
+        }
+    }
+
+    void AddContainerToUser(HandleId user_id, HandleId container_id)
+    {
+        auto user = users_.find(user_id);
+        if ((user != users_.end()) && (containers_.count(container_id) != 0))
+        {
+            user->second.containers.insert(container_id);
+        }
+    }
+
+    void AddUserToUser(HandleId user_id, HandleId source_user_id)
+    {
+        auto user        = users_.find(user_id);
+        auto source_user = users_.find(source_user_id);
+        if ((user != users_.end()) && (source_user != users_.end()))
+        {
+            user->second.resources.insert(source_user->second.resources.begin(), source_user->second.resources.end());
+
+            for (auto container_id : source_user->second.containers)
+            {
+                if (containers_.count(container_id) != 0)
+                {
+                    user->second.containers.insert(container_id);
+                }
+            }
+        }
+    }
+
+    void AddContainer(HandleId pool_id, HandleId container_id)
+    {
+        Container container;
+        container.pool_id = pool_id;
+        containers_.emplace(container_id, container);
+        container_pools_[pool_id].insert(container_id);
+    }
+
+    void AddUser(HandleId pool_id, HandleId user_id)
+    {
+        User user;
+        user.pool_id = pool_id;
+        users_.emplace(user_id, user);
+        user_pools_[pool_id].insert(user_id);
+    }
+
+    void RemoveContainer(HandleId container_id)
+    {
+        auto container = containers_.find(container_id);
+        if (container != containers_.end())
+        {
+            container_pools_[container->second.pool_id].erase(container_id);
+            containers_.erase(container);
+        }
+    }
+
+    void RemoveUser(HandleId user_id)
+    {
+        auto user = users_.find(user_id);
+        if (user != users_.end())
+        {
+            user_pools_[user->second.pool_id].erase(user_id);
+            users_.erase(user);
+        }
+    }
+
+    void ResetContainer(HandleId container_id)
+    {
+        auto container = containers_.find(container_id);
+        if (container != containers_.end())
+        {
+            container->second.resources.clear();
+            container->second.bindings.clear();
+        }
+    }
+
+    void ResetUser(HandleId user_id)
+    {
+        auto user = users_.find(user_id);
+        if (user != users_.end())
+        {
+            user->second.resources.clear();
+            user->second.containers.clear();
+        }
+    }
+
+    void ResetContainers(HandleId pool_id)
+    {
+        for (auto container_id : container_pools_[pool_id])
+        {
+            ResetContainer(container_id);
+        }
+    }
+
+    void ResetUsers(HandleId pool_id)
+    {
+        for (auto user_id : user_pools_[pool_id])
+        {
+            ResetUser(user_id);
+        }
+    }
+
+    void ClearContainers(HandleId pool_id)
+    {
+        for (auto container_id : container_pools_[pool_id])
+        {
+            containers_.erase(container_id);
+        }
+
+        container_pools_[pool_id].clear();
+    }
+
+    void ClearUsers(HandleId pool_id)
+    {
+        for (auto user_id : user_pools_[pool_id])
+        {
+            users_.erase(user_id);
+        }
+
+        user_pools_[pool_id].clear();
+    }
+
+    void CopyContainerEntry(HandleId source_container_id,
+                            uint32_t source_binding,
+                            uint32_t source_element,
+                            HandleId destination_container_id,
+                            uint32_t destination_binding,
+                            uint32_t destination_element)
+    {
+        auto container = containers_.find(source_container_id);
+        if (container != containers_.end())
+        {
+            auto binding = container->second.bindings.find(source_binding);
+            if (binding != container->second.bindings.end())
+            {
+                auto element = binding->second.find(source_element);
+                if (element != binding->second.end())
+                {
+                    AddResourceToContainer(
+                        destination_container_id, element->second, destination_binding, destination_element);
+                }
+            }
+        }
+    }
+
+    void ProcessUserSubmission(HandleId user_id)
+    {
+        auto user = users_.find(user_id);
+        if (user != users_.end())
+        {
+            for (auto resource_id : user->second.resources)
+            {
+                resources_[resource_id].used = true;
+            }
+
+            for (auto container_id : user->second.containers)
+            {
+                auto container = containers_.find(container_id);
+                if (container != containers_.end())
+                {
+                    for (auto resource_id : container->second.resources)
+                    {
+                        resources_[resource_id].used = true;
+                    }
+                }
+            }
+        }
+    }
+
+    void GetReferencedResourceIds(std::unordered_set<HandleId>* referenced_ids,
+                                  std::unordered_set<HandleId>* unreferenced_ids) const
+    {
+        for (const auto& resource : resources_)
+        {
+            if (!resource.second.is_child)
+            {
+                if (IsUsed(resource.first))
+                {
+                    referenced_ids->insert(resource.first);
+                }
+                else
+                {
+                    unreferenced_ids->insert(resource.first);
+                }
+            }
+        }
+    }
+
+  private:
+    struct Resource
+    {
+        bool                  used{ false };
+        bool                  is_child{ false };
+        std::vector<HandleId> children;
+    };
+
+    struct Container
+    {
+        HandleId                                         pool_id{ gfxrecon::format::kNullHandleId };
+        std::set<HandleId>                               resources;
+        std::map<uint32_t, std::map<uint32_t, HandleId>> bindings;
+    };
+
+    struct User
+    {
+        HandleId           pool_id{ gfxrecon::format::kNullHandleId };
+        std::set<HandleId> resources;
+        std::set<HandleId> containers;
+    };
+
+  private:
+    bool IsUsed(HandleId resource_id) const
+    {
+        const auto& resource = resources_.at(resource_id);
+
+        if (resource.used)
+        {
+            return true;
+        }
+
+        for (auto child_id : resource.children)
+        {
+            if (IsUsed(child_id))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+  private:
+    std::map<HandleId, Resource>           resources_;
+    std::map<HandleId, Container>          containers_;
+    std::map<HandleId, User>               users_;
+    std::map<HandleId, std::set<HandleId>> container_pools_;
+    std::map<HandleId, std::set<HandleId>> user_pools_;
+};
+
+void GetReferencedResourceIds(const ReferencedResourceTable& table,
+                              std::set<HandleId>*            referenced_ids,
+                              std::set<HandleId>*            unreferenced_ids)
+{
+    std::unordered_set<HandleId> referenced;
+    std::unordered_set<HandleId> unreferenced;
+    table.GetReferencedResourceIds(&referenced, &unreferenced);
+
+    referenced_ids->insert(referenced.begin(), referenced.end());
+    unreferenced_ids->insert(unreferenced.begin(), unreferenced.end());
+}
+
+void GetReferencedResourceIds(const ReferenceModel& model,
+                              std::set<HandleId>*   referenced_ids,
+                              std::set<HandleId>*   unreferenced_ids)
+{
+    std::unordered_set<HandleId> referenced;
+    std::unordered_set<HandleId> unreferenced;
+    model.GetReferencedResourceIds(&referenced, &unreferenced);
+
+    referenced_ids->insert(referenced.begin(), referenced.end());
+    unreferenced_ids->insert(unreferenced.begin(), unreferenced.end());
+}
+
+} // namespace
+
+TEST_CASE("ReferencedResourceTable propagates child use to parents", "[referenced_resource_table]")
+{
+    ReferencedResourceTable table;
+
+    // Two images with views, and a framebuffer that is a child of both views.
+    table.AddResource(1);
+    table.AddResource(2);
+    table.AddResource(3);
+    table.AddResource(1, 11);
+    table.AddResource(2, 12);
+
+    const HandleId views[] = { 11, 12 };
+    table.AddResource(2, views, 21);
+
+    table.AddUser(100, 200);
+    table.AddResourceToUser(200, 21);
+
+    std::set<HandleId> referenced;
+    std::set<HandleId> unreferenced;
+
+    GetReferencedResourceIds(table, &referenced, &unreferenced);
+    REQUIRE(referenced.empty());
+    REQUIRE(unreferenced == std::set<HandleId>{ 1, 2, 3 });
+
+    table.ProcessUserSubmission(200);
+
+    referenced.clear();
+    unreferenced.clear();
+    GetReferencedResourceIds(table, &referenced, &unreferenced);
+
+    // Child resources are not reported.
+    REQUIRE(referenced == std::set<HandleId>{ 1, 2 });
+    REQUIRE(unreferenced == std::set<HandleId>{ 3 });
+}
+
+TEST_CASE("ReferencedResourceTable ignores removed and reset containers", "[referenced_resource_table]")
+{
+    ReferencedResourceTable table;
+
+    table.AddResource(1);
+    table.AddResource(2);
+    table.AddResource(3);
+
+    table.AddContainer(10, 20);
+    table.AddContainer(10, 21);
+    table.AddContainer(11, 22);
+    table.AddResourceToContainer(20, 1, 0, 0);
+    table.AddResourceToContainer(21, 2, 0, 0);
+    table.AddResourceToContainer(22, 3, 0, 0);
+
+    table.AddUser(30, 40);
+    table.AddContainerToUser(40, 20);
+    table.AddContainerToUser(40, 21);
+    table.AddContainerToUser(40, 22);
+
+    // Container 20 is freed, container 21 is reset, and container 22 is used.
+    table.RemoveContainer(20);
+    table.ResetContainer(21);
+    table.ProcessUserSubmission(40);
+
+    std::set<HandleId> referenced;
+    std::set<HandleId> unreferenced;
+    GetReferencedResourceIds(table, &referenced, &unreferenced);
+
+    REQUIRE(referenced == std::set<HandleId>{ 3 });
+    REQUIRE(unreferenced == std::set<HandleId>{ 1, 2 });
+}
+
+TEST_CASE("ReferencedResourceTable copies container entries and user references", "[referenced_resource_table]")
+{
+    ReferencedResourceTable table;
+
+    table.AddResource(1);
+    table.AddResource(2);
+    table.AddResource(3);
+
+    table.AddContainer(10, 20);
+    table.AddContainer(10, 21);
+    table.AddResourceToContainer(20, 1, 0, 0);
+    table.AddResourceToContainer(20, 2, 1, 3);
+
+    // Only the entry at binding 1, element 3 is copied.
+    table.CopyContainerEntry(20, 1, 3, 21, 0, 0);
+
+    // Secondary command buffer 41 is executed by primary command buffer 40.
+    table.AddUser(30, 40);
+    table.AddUser(30, 41);
+    table.AddContainerToUser(41, 21);
+    table.AddUserToUser(40, 41);
+
+    table.ResetUser(41);
+    table.ProcessUserSubmission(40);
+
+    std::set<HandleId> referenced;
+    std::set<HandleId> unreferenced;
+    GetReferencedResourceIds(table, &referenced, &unreferenced);
+
+    REQUIRE(referenced == std::set<HandleId>{ 2 });
+    REQUIRE(unreferenced == std::set<HandleId>{ 1, 3 });
+}
+
+TEST_CASE("ReferencedResourceTable matches the map based table for random call sequences",
+          "[referenced_resource_table]")
+{
+    const uint32_t kSeedCount       = 20;
+    const uint32_t kOperationCount  = 3000;
+    const HandleId kFirstPoolId     = 10;
+    const uint32_t kPoolCount       = 3;
+    const uint32_t kBindingRange    = 2;
+    const HandleId kUnknownHandleId = 999999;
+
+    for (uint32_t seed = 0; seed < kSeedCount; ++seed)
+    {
+        std::mt19937            random(seed);
+        ReferencedResourceTable table;
+        ReferenceModel          model;
+
+        std::vector<HandleId> resource_ids;
+        std::vector<HandleId> container_ids;
+        std::vector<HandleId> user_ids;
+        HandleId              next_id = 1000;
+
+        auto pick = [&random](const std::vector<HandleId>& ids) -> HandleId {
+            // Occasionally pick an unknown handle, which must be ignored.
+            if (ids.empty() || ((random() % 20) == 0))
+            {
+                return kUnknownHandleId;
+            }
+
+            return ids[random() % ids.size()];
+        };
+
+        auto pick_pool = [&random]() -> HandleId { return kFirstPoolId + (random() % kPoolCount); };
+
+        for (uint32_t i = 0; i < kOperationCount; ++i)
+        {
+            switch (random() % 18)
+            {
+                case 0:
+                case 1:
+                {
+                    HandleId id = next_id++;
+                    resource_ids.push_back(id);
+                    table.AddResource(id);
+                    model.AddResource(id);
+                    break;
+                }
+                case 2:
+                {
+                    // A child of one or more existing resources.  Parents always precede children, as with views
+                    // and framebuffers, so the resource graph is acyclic.
+                    HandleId              id = next_id++;
+                    std::vector<HandleId> parent_ids(1 + (random() % 3));
+                    for (auto& parent_id : parent_ids)
+                    {
+                        parent_id = pick(resource_ids);
+                    }
+
+                    resource_ids.push_back(id);
+
+                    table.AddResource(parent_ids.size(), parent_ids.data(), id);
+                    for (auto parent_id : parent_ids)
+                    {
+                        model.AddResource(parent_id, id);
+                    }
+                    break;
+                }
+                case 3:
+                {
+                    HandleId id = next_id++;
+                    container_ids.push_back(id);
+                    HandleId pool_id = pick_pool();
+                    table.AddContainer(pool_id, id);
+                    model.AddContainer(pool_id, id);
+                    break;
+                }
+                case 4:
+                {
+                    HandleId id = next_id++;
+                    user_ids.push_back(id);
+                    HandleId pool_id = pick_pool();
+                    table.AddUser(pool_id, id);
+                    model.AddUser(pool_id, id);
+                    break;
+                }
+                case 5:
+                case 6:
+                {
+                    HandleId container_id = pick(container_ids);
+                    HandleId resource_id  = pick(resource_ids);
+                    uint32_t binding      = random() % kBindingRange;
+                    uint32_t element      = random() % kBindingRange;
+                    table.AddResourceToContainer(container_id, resource_id, binding, element);
+                    model.AddResourceToContainer(container_id, resource_id, binding, element);
+                    break;
+                }
+                case 7:
+                {
+                    HandleId user_id     = pick(user_ids);
+                    HandleId resource_id = pick(resource_ids);
+                    table.AddResourceToUser(user_id, resource_id);
+                    model.AddResourceToUser(user_id, resource_id);
+                    break;
+                }
+                case 8:
+                case 9:
+                {
+                    HandleId user_id      = pick(user_ids);
+                    HandleId container_id = pick(container_ids);
+                    table.AddContainerToUser(user_id, container_id);
+                    model.AddContainerToUser(user_id, container_id);
+                    break;
+                }
+                case 10:
+                {
+                    HandleId user_id        = pick(user_ids);
+                    HandleId source_user_id = pick(user_ids);
+                    table.AddUserToUser(user_id, source_user_id);
+                    model.AddUserToUser(user_id, source_user_id);
+                    break;
+                }
+                case 11:
+                {
+                    HandleId source_id      = pick(container_ids);
+                    HandleId destination_id = pick(container_ids);
+                    uint32_t values[4];
+                    for (auto& value : values)
+                    {
+                        value = random() % kBindingRange;
+                    }
+
+                    table.CopyContainerEntry(source_id, values[0], values[1], destination_id, values[2], values[3]);
+                    model.CopyContainerEntry(source_id, values[0], values[1], destination_id, values[2], values[3]);
+                    break;
+                }
+                case 12:
+                {
+                    HandleId container_id = pick(container_ids);
+                    if ((random() % 2) == 0)
+                    {
+                        table.RemoveContainer(container_id);
+                        model.RemoveContainer(container_id);
+                    }
+                    else
+                    {
+                        table.ResetContainer(container_id);
+                        model.ResetContainer(container_id);
+                    }
+                    break;
+                }
+                case 13:
+                {
+                    HandleId user_id = pick(user_ids);
+                    if ((random() % 2) == 0)
+                    {
+                        table.RemoveUser(user_id);
+                        model.RemoveUser(user_id);
+                    }
+                    else
+                    {
+                        table.ResetUser(user_id);
+                        model.ResetUser(user_id);
+                    }
+                    break;
+                }
+                case 14:
+                {
+                    HandleId pool_id = pick_pool();
+                    switch (random() % 8)
+                    {
+                        case 0:
+                            table.ClearContainers(pool_id);
+                            model.ClearContainers(pool_id);
+                            break;
+                        case 1:
+                            table.ClearUsers(pool_id);
+                            model.ClearUsers(pool_id);
+                            break;
+                        case 2:
+                        case 3:
+                            table.ResetContainers(pool_id);
+                            model.ResetContainers(pool_id);
+                            break;
+                        default:
+                            table.ResetUsers(pool_id);
+                            model.ResetUsers(pool_id);
+                            break;
+                    }
+                    break;
+                }
+                default:
+                {
+                    HandleId user_id = pick(user_ids);
+                    table.ProcessUserSubmission(user_id);
+                    model.ProcessUserSubmission(user_id);
+                    break;
+                }
+            }
+
+            if ((i % 500) == 499)
+            {
+                std::set<HandleId> table_referenced;
+                std::set<HandleId> table_unreferenced;
+                std::set<HandleId> model_referenced;
+                std::set<HandleId> model_unreferenced;
+
+                GetReferencedResourceIds(table, &table_referenced, &table_unreferenced);
+                GetReferencedResourceIds(model, &model_referenced, &model_unreferenced);
+
+                INFO("seed " << seed << ", operation " << i);
+                REQUIRE(table_referenced == model_referenced);
+                REQUIRE(table_unreferenced == model_unreferenced);
+            }
+        }
+    }
+}
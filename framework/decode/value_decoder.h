@@ -136,6 +136,14 @@ class ValueDecoder
         return DecodeArray(buffer, buffer_size, arr, len);
     }
 
+    // Copy an array of structs with a fixed memory layout, where the encoded struct members match the in-memory
+    // representation of the struct.
+    template <typename T>
+    static size_t DecodeFixedLayoutStructArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)
+    {
+        return DecodeArray(buffer, buffer_size, arr, len);
+    }
+
   private:
     template <typename DstT, typename SrcT>
     static typename std::enable_if<!std::is_pointer<SrcT>::value && !std::is_pointer<DstT>::value, DstT>::type
@@ -38,15 +38,28 @@ VulkanAsciiConsumerBase::~VulkanAsciiConsumerBase()
 void VulkanAsciiConsumerBase::Initialize(FILE* file)
 {
     assert(file);
-    file_ = file;
+    file_            = file;
+    is_fragment_     = false;
+    write_separator_ = false;
     fprintf(file_, "{");
 }
 
+void VulkanAsciiConsumerBase::InitializeFragment(FILE* file)
+{
+    assert(file);
+    file_            = file;
+    is_fragment_     = true;
+    write_separator_ = false;
+}
+
 void VulkanAsciiConsumerBase::Destroy()
 {
     if (file_ != nullptr)
     {
-        fprintf(file_, "\n}\n");
+        if (!is_fragment_)
+        {
+            fprintf(file_, "\n}\n");
+        }
         file_ = nullptr;
     }
 }
@@ -46,6 +46,10 @@ class VulkanAsciiConsumerBase : public VulkanConsumer
 
     void Initialize(FILE* file);
 
+    // Writes API calls without the enclosing braces of the JSON object, so that the output of consumers that each
+    // process a separate range of frames can be concatenated into a single JSON object.
+    void InitializeFragment(FILE* file);
+
     void Destroy();
 
     bool IsValid() const { return (file_ != nullptr); }
@@ -117,7 +121,8 @@ class VulkanAsciiConsumerBase : public VulkanConsumer
                                    ToStringFunctionType toStringFunction)
     {
         using namespace util;
-        fprintf(file_, "%s\n", (call_info.index ? "," : ""));
+        fprintf(file_, "%s\n", (write_separator_ ? "," : ""));
+        write_separator_ = true;
         fprintf(file_, "\"[%s]%s\":", std::to_string(call_info.index).c_str(), functionName.c_str());
         fprintf(file_, "%s", GetWhitespaceString(toStringFlags).c_str());
         fprintf(file_, "%s", ObjectToString(toStringFlags, tabCount, tabSize, toStringFunction).c_str());
@@ -125,6 +130,8 @@ class VulkanAsciiConsumerBase : public VulkanConsumer
 
   private:
     FILE* file_{ nullptr };
+    bool  is_fragment_{ false };
+    bool  write_separator_{ false };
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -27,19 +27,41 @@
 #include "generated/generated_vulkan_struct_decoders.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-VulkanDefaultAllocator::VulkanDefaultAllocator() : device_(VK_NULL_HANDLE), memory_properties_{} {}
+// Resources are bound to pooled allocations at their capture offsets, which were aligned relative to the start of the
+// captured allocation, so each pooled range must start at an offset that satisfies the largest alignment that a
+// resource may require.
+const VkDeviceSize kMinimumPoolAlignment = 64 * 1024;
+
+// Allocations larger than the block size divided by this value are not pooled.
+const VkDeviceSize kMaxPooledAllocationDivisor = 4;
+
+static VkDeviceSize AlignSize(VkDeviceSize size, VkDeviceSize alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+VulkanDefaultAllocator::VulkanDefaultAllocator() :
+    device_(VK_NULL_HANDLE), memory_properties_{}, pool_block_size_(0), pool_alignment_(kMinimumPoolAlignment),
+    non_coherent_atom_size_(1), unpooled_memory_types_(0), pooling_disabled_(false)
+{}
 
 VulkanDefaultAllocator::VulkanDefaultAllocator(const std::string& custom_error_string) :
-    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(custom_error_string)
+    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(custom_error_string), pool_block_size_(0),
+    pool_alignment_(kMinimumPoolAlignment), non_coherent_atom_size_(1), unpooled_memory_types_(0),
+    pooling_disabled_(false)
 {}
 
 VulkanDefaultAllocator::VulkanDefaultAllocator(std::string&& custom_error_string) :
-    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(std::move(custom_error_string))
+    device_(VK_NULL_HANDLE), memory_properties_{}, custom_error_string_(std::move(custom_error_string)),
+    pool_block_size_(0), pool_alignment_(kMinimumPoolAlignment), non_coherent_atom_size_(1), unpooled_memory_types_(0),
+    pooling_disabled_(false)
 {}
 
 VkResult VulkanDefaultAllocator::Initialize(uint32_t                                api_version,
@@ -54,8 +76,6 @@ VkResult VulkanDefaultAllocator::Initialize(uint32_t
 {
     GFXRECON_UNREFERENCED_PARAMETER(api_version);
     GFXRECON_UNREFERENCED_PARAMETER(instance);
-    GFXRECON_UNREFERENCED_PARAMETER(physical_device);
-    GFXRECON_UNREFERENCED_PARAMETER(device);
     GFXRECON_UNREFERENCED_PARAMETER(enabled_device_extensions);
     GFXRECON_UNREFERENCED_PARAMETER(capture_device_type);
     GFXRECON_UNREFERENCED_PARAMETER(capture_memory_properties);
@@ -64,11 +84,44 @@ VkResult VulkanDefaultAllocator::Initialize(uint32_t
     functions_         = functions;
     memory_properties_ = replay_memory_properties;
 
+    if (pool_block_size_ > 0)
+    {
+        memory_pools_.resize(replay_memory_properties.memoryTypeCount);
+
+        if (functions.get_physical_device_properties != nullptr)
+        {
+            VkPhysicalDeviceProperties properties;
+            functions.get_physical_device_properties(physical_device, &properties);
+
+            // Pooled ranges are aligned to the non-coherent atom size so that flushes of pooled allocations remain
+            // aligned, and to the buffer-image granularity so that linear and non-linear resources bound to adjacent
+            // pooled allocations never share a granularity page.
+            non_coherent_atom_size_ = std::max(properties.limits.nonCoherentAtomSize, VkDeviceSize{ 1 });
+            pool_alignment_         = std::max(
+                { kMinimumPoolAlignment, properties.limits.bufferImageGranularity, non_coherent_atom_size_ });
+        }
+    }
+
     return VK_SUCCESS;
 }
 
 void VulkanDefaultAllocator::Destroy()
 {
+    for (const auto& pool : memory_pools_)
+    {
+        for (const auto& block : pool)
+        {
+            if (block->mapped_pointer != nullptr)
+            {
+                functions_.unmap_memory(device_, block->memory);
+            }
+
+            functions_.free_memory(device_, block->memory, nullptr);
+        }
+    }
+
+    memory_pools_.clear();
+
     device_ = VK_NULL_HANDLE;
 }
 
@@ -87,6 +140,20 @@ VkResult VulkanDefaultAllocator::CreateBuffer(const VkBufferCreateInfo*    creat
         (*allocator_data)               = reinterpret_cast<ResourceData>(resource_alloc_info);
 
         result = functions_.create_buffer(device_, create_info, allocation_callbacks, buffer);
+
+        if ((result == VK_SUCCESS) && (pool_block_size_ > 0) && !pooling_disabled_)
+        {
+            if ((create_info->flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) != 0)
+            {
+                DisableMemoryPooling("VkBuffer");
+            }
+            else
+            {
+                VkMemoryRequirements requirements;
+                functions_.get_buffer_memory_requirements(device_, *buffer, &requirements);
+                UpdatePoolableMemoryTypes(requirements);
+            }
+        }
     }
 
     return result;
@@ -120,6 +187,22 @@ VkResult VulkanDefaultAllocator::CreateImage(const VkImageCreateInfo*     create
         (*allocator_data)               = reinterpret_cast<ResourceData>(resource_alloc_info);
 
         result = functions_.create_image(device_, create_info, allocation_callbacks, image);
+
+        if ((result == VK_SUCCESS) && (pool_block_size_ > 0) && !pooling_disabled_)
+        {
+            if ((create_info->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0)
+            {
+                DisableMemoryPooling("VkImage");
+            }
+            else if ((create_info->flags & VK_IMAGE_CREATE_DISJOINT_BIT) == 0)
+            {
+                // The requirements for the planes of disjoint images must be queried with
+                // vkGetImageMemoryRequirements2, so their alignment is not checked.
+                VkMemoryRequirements requirements;
+                functions_.get_image_memory_requirements(device_, *image, &requirements);
+                UpdatePoolableMemoryTypes(requirements);
+            }
+        }
     }
 
     return result;
@@ -170,9 +253,20 @@ void VulkanDefaultAllocator::FreeMemory(VkDeviceMemory               memory,
                                         const VkAllocationCallbacks* allocation_callbacks,
                                         MemoryData                   allocator_data)
 {
+    bool is_pooled = false;
+
     if (allocator_data != 0)
     {
         auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
+
+        if (memory_alloc_info->pool_block != nullptr)
+        {
+            // The memory handle references a pooled block, which is only freed when it no longer contains any
+            // allocations.
+            FreeToPool(memory_alloc_info);
+            is_pooled = true;
+        }
+
         delete memory_alloc_info;
     }
     else if (memory != VK_NULL_HANDLE)
@@ -180,7 +274,10 @@ void VulkanDefaultAllocator::FreeMemory(VkDeviceMemory               memory,
         GFXRECON_LOG_WARNING("VulkanDefaultAllocator freeing a VkDeviceMemory object without allocator data");
     }
 
-    functions_.free_memory(device_, memory, allocation_callbacks);
+    if (!is_pooled)
+    {
+        functions_.free_memory(device_, memory, allocation_callbacks);
+    }
 }
 
 void VulkanDefaultAllocator::GetDeviceMemoryCommitment(VkDeviceMemory memory,
@@ -202,7 +299,9 @@ VkResult VulkanDefaultAllocator::BindBufferMemory(VkBuffer               buffer,
 
     if (bind_memory_properties != nullptr)
     {
-        result = functions_.bind_buffer_memory(device_, buffer, memory, memory_offset);
+        VkDeviceSize bind_offset = memory_offset + GetPoolOffset(allocator_memory_data);
+
+        result = functions_.bind_buffer_memory(device_, buffer, memory, bind_offset);
 
         if (result == VK_SUCCESS)
         {
@@ -210,7 +309,7 @@ VkResult VulkanDefaultAllocator::BindBufferMemory(VkBuffer               buffer,
             {
                 auto resource_alloc_info          = reinterpret_cast<ResourceAllocInfo*>(allocator_buffer_data);
                 resource_alloc_info->bound_memory = memory;
-                resource_alloc_info->bound_offset = memory_offset;
+                resource_alloc_info->bound_offset = bind_offset;
 
                 auto memory_alloc_info    = reinterpret_cast<MemoryAllocInfo*>(allocator_memory_data);
                 (*bind_memory_properties) = memory_alloc_info->property_flags;
@@ -237,6 +336,21 @@ VkResult VulkanDefaultAllocator::BindBufferMemory2(uint32_t
     if ((bind_infos != nullptr) && (allocator_buffer_datas != nullptr) && (allocator_memory_datas != nullptr) &&
         (bind_memory_properties != nullptr))
     {
+        std::unique_ptr<VkBindBufferMemoryInfo[]> pooled_bind_infos;
+
+        if (pool_block_size_ > 0)
+        {
+            pooled_bind_infos = std::make_unique<VkBindBufferMemoryInfo[]>(bind_info_count);
+
+            for (uint32_t i = 0; i < bind_info_count; ++i)
+            {
+                pooled_bind_infos[i] = bind_infos[i];
+                pooled_bind_infos[i].memoryOffset += GetPoolOffset(allocator_memory_datas[i]);
+            }
+
+            bind_infos = pooled_bind_infos.get();
+        }
+
         result = functions_.bind_buffer_memory2(device_, bind_info_count, bind_infos);
 
         if (result == VK_SUCCESS)
@@ -278,7 +392,9 @@ VkResult VulkanDefaultAllocator::BindImageMemory(VkImage                image,
 
     if (bind_memory_properties != nullptr)
     {
-        result = functions_.bind_image_memory(device_, image, memory, memory_offset);
+        VkDeviceSize bind_offset = memory_offset + GetPoolOffset(allocator_memory_data);
+
+        result = functions_.bind_image_memory(device_, image, memory, bind_offset);
 
         if (result == VK_SUCCESS)
         {
@@ -287,7 +403,7 @@ VkResult VulkanDefaultAllocator::BindImageMemory(VkImage                image,
             {
                 auto resource_alloc_info          = reinterpret_cast<ResourceAllocInfo*>(allocator_image_data);
                 resource_alloc_info->bound_memory = memory;
-                resource_alloc_info->bound_offset = memory_offset;
+                resource_alloc_info->bound_offset = bind_offset;
 
                 auto memory_alloc_info    = reinterpret_cast<MemoryAllocInfo*>(allocator_memory_data);
                 (*bind_memory_properties) = memory_alloc_info->property_flags;
@@ -314,6 +430,21 @@ VkResult VulkanDefaultAllocator::BindImageMemory2(uint32_t                     b
     if ((bind_infos != nullptr) && (allocator_image_datas != nullptr) && (allocator_memory_datas != nullptr) &&
         (bind_memory_properties != nullptr))
     {
+        std::unique_ptr<VkBindImageMemoryInfo[]> pooled_bind_infos;
+
+        if (pool_block_size_ > 0)
+        {
+            pooled_bind_infos = std::make_unique<VkBindImageMemoryInfo[]>(bind_info_count);
+
+            for (uint32_t i = 0; i < bind_info_count; ++i)
+            {
+                pooled_bind_infos[i] = bind_infos[i];
+                pooled_bind_infos[i].memoryOffset += GetPoolOffset(allocator_memory_datas[i]);
+            }
+
+            bind_infos = pooled_bind_infos.get();
+        }
+
         result = functions_.bind_image_memory2(device_, bind_info_count, bind_infos);
 
         if (result == VK_SUCCESS)
@@ -351,17 +482,42 @@ VkResult VulkanDefaultAllocator::MapMemory(VkDeviceMemory   memory,
                                            void**           data,
                                            MemoryData       allocator_data)
 {
-    VkResult result = VK_ERROR_INITIALIZATION_FAILED;
+    VkResult result            = VK_ERROR_INITIALIZATION_FAILED;
+    auto     memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
+
+    if ((data != nullptr) && (memory_alloc_info != nullptr) && (memory_alloc_info->pool_block != nullptr))
+    {
+        // Pooled blocks are mapped in their entirety when first mapped, and remain mapped until they are freed.
+        MemoryBlock* block = memory_alloc_info->pool_block;
+
+        result = VK_SUCCESS;
+
+        if (block->mapped_pointer == nullptr)
+        {
+            void* block_data = nullptr;
+
+            result = functions_.map_memory(device_, block->memory, 0, VK_WHOLE_SIZE, flags, &block_data);
+
+            if (result >= 0)
+            {
+                block->mapped_pointer = static_cast<uint8_t*>(block_data);
+            }
+        }
 
-    if (data != nullptr)
+        if (result >= 0)
+        {
+            (*data)                           = block->mapped_pointer + memory_alloc_info->pool_offset + offset;
+            memory_alloc_info->mapped_pointer = static_cast<uint8_t*>(*data);
+        }
+    }
+    else if (data != nullptr)
     {
         result = functions_.map_memory(device_, memory, offset, size, flags, data);
 
         if (result >= 0)
         {
-            if (allocator_data != 0)
+            if (memory_alloc_info != nullptr)
             {
-                auto memory_alloc_info            = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
                 memory_alloc_info->mapped_pointer = static_cast<uint8_t*>(*data);
             }
             else
@@ -376,29 +532,39 @@ VkResult VulkanDefaultAllocator::MapMemory(VkDeviceMemory   memory,
 
 void VulkanDefaultAllocator::UnmapMemory(VkDeviceMemory memory, MemoryData allocator_data)
 {
+    bool is_pooled = false;
+
     if (allocator_data != 0)
     {
         auto memory_alloc_info            = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
         memory_alloc_info->mapped_pointer = nullptr;
+        is_pooled                         = (memory_alloc_info->pool_block != nullptr);
     }
 
-    functions_.unmap_memory(device_, memory);
+    if (!is_pooled)
+    {
+        functions_.unmap_memory(device_, memory);
+    }
 }
 
 VkResult VulkanDefaultAllocator::FlushMappedMemoryRanges(uint32_t                   memory_range_count,
                                                          const VkMappedMemoryRange* memory_ranges,
                                                          const MemoryData*          allocator_datas)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(allocator_datas);
-    return functions_.flush_memory_ranges(device_, memory_range_count, memory_ranges);
+    auto pooled_ranges = GetPooledMemoryRanges(memory_range_count, memory_ranges, allocator_datas);
+
+    return functions_.flush_memory_ranges(
+        device_, memory_range_count, (pooled_ranges != nullptr) ? pooled_ranges.get() : memory_ranges);
 }
 
 VkResult VulkanDefaultAllocator::InvalidateMappedMemoryRanges(uint32_t                   memory_range_count,
                                                               const VkMappedMemoryRange* memory_ranges,
                                                               const MemoryData*          allocator_datas)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(allocator_datas);
-    return functions_.invalidate_memory_ranges(device_, memory_range_count, memory_ranges);
+    auto pooled_ranges = GetPooledMemoryRanges(memory_range_count, memory_ranges, allocator_datas);
+
+    return functions_.invalidate_memory_ranges(
+        device_, memory_range_count, (pooled_ranges != nullptr) ? pooled_ranges.get() : memory_ranges);
 }
 
 VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator_data,
@@ -586,22 +752,267 @@ VkResult VulkanDefaultAllocator::Allocate(const VkMemoryAllocateInfo*  allocate_
 {
     assert((allocate_info != nullptr) && (allocator_data != nullptr));
 
-    VkResult result = functions_.allocate_memory(device_, allocate_info, allocation_callbacks, memory);
+    VkResult result            = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    auto     memory_alloc_info = new MemoryAllocInfo;
+
+    if (IsPoolable(allocate_info, capture_id))
+    {
+        result = AllocateFromPool(allocate_info, memory, memory_alloc_info);
+    }
+
+    if (memory_alloc_info->pool_block == nullptr)
+    {
+        // Allocations that are not pooled, or that could not be pooled because a new block could not be allocated,
+        // are allocated directly.
+        result = functions_.allocate_memory(device_, allocate_info, allocation_callbacks, memory);
+    }
 
     if (result >= 0)
     {
         assert(allocate_info->memoryTypeIndex < memory_properties_.memoryTypeCount);
 
-        auto memory_alloc_info               = new MemoryAllocInfo;
         memory_alloc_info->capture_id        = capture_id;
         memory_alloc_info->memory_type_index = allocate_info->memoryTypeIndex;
         memory_alloc_info->property_flags =
             memory_properties_.memoryTypes[allocate_info->memoryTypeIndex].propertyFlags;
         (*allocator_data) = reinterpret_cast<MemoryData>(memory_alloc_info);
     }
+    else
+    {
+        delete memory_alloc_info;
+    }
+
+    return result;
+}
+
+bool VulkanDefaultAllocator::IsPoolable(const VkMemoryAllocateInfo* allocate_info, format::HandleId capture_id) const
+{
+    assert(allocate_info != nullptr);
+
+    // Direct allocations for replay staging resources are not pooled, and neither are allocations with extension
+    // structures, which may request dedicated allocations, external memory, or device addresses that are specific to
+    // the VkDeviceMemory object.
+    if ((pool_block_size_ == 0) || pooling_disabled_ || (capture_id == format::kNullHandleId) ||
+        (allocate_info->pNext != nullptr) || (allocate_info->memoryTypeIndex >= memory_pools_.size()) ||
+        ((unpooled_memory_types_ & (1u << allocate_info->memoryTypeIndex)) != 0) ||
+        (allocate_info->allocationSize > (pool_block_size_ / kMaxPooledAllocationDivisor)))
+    {
+        return false;
+    }
+
+    VkMemoryPropertyFlags property_flags = memory_properties_.memoryTypes[allocate_info->memoryTypeIndex].propertyFlags;
+
+    return ((property_flags & (VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT | VK_MEMORY_PROPERTY_PROTECTED_BIT)) == 0);
+}
+
+void VulkanDefaultAllocator::DisableMemoryPooling(const char* resource_type)
+{
+    pooling_disabled_ = true;
+
+    // Sparse binds are not processed by the allocator, so they would be made at the capture offsets of a shared block.
+    GFXRECON_LOG_WARNING("Memory pooling has been disabled for the remainder of replay because a %s object was created "
+                         "with sparse binding",
+                         resource_type);
+
+    bool has_pooled_allocations =
+        std::any_of(memory_pools_.begin(), memory_pools_.end(), [](const MemoryPool& pool) { return !pool.empty(); });
+
+    if (has_pooled_allocations)
+    {
+        GFXRECON_LOG_WARNING("Sparse resources that are bound to memory allocated before pooling was disabled may not "
+                             "replay correctly; replay without the pooling option");
+    }
+}
+
+void VulkanDefaultAllocator::UpdatePoolableMemoryTypes(const VkMemoryRequirements& requirements)
+{
+    // Resources are bound at their capture offsets relative to the start of the pooled range, which is only guaranteed
+    // to satisfy alignments up to the pool alignment.  Allocations for the memory types that the resource may be bound
+    // to are made directly from now on.
+    uint32_t new_memory_types = requirements.memoryTypeBits & ~unpooled_memory_types_;
+
+    if ((requirements.alignment > pool_alignment_) && (new_memory_types != 0))
+    {
+        GFXRECON_LOG_WARNING("Resource memory alignment of %" PRIu64
+                             " is larger than the memory pool alignment of %" PRIu64
+                             "; allocations from memory types 0x%x will not be pooled",
+                             requirements.alignment,
+                             pool_alignment_,
+                             new_memory_types);
+
+        unpooled_memory_types_ |= new_memory_types;
+    }
+}
+
+VkResult VulkanDefaultAllocator::AllocateFromPool(const VkMemoryAllocateInfo* allocate_info,
+                                                  VkDeviceMemory*             memory,
+                                                  MemoryAllocInfo*            memory_alloc_info)
+{
+    assert((allocate_info != nullptr) && (memory != nullptr) && (memory_alloc_info != nullptr));
+
+    VkResult     result = VK_SUCCESS;
+    VkDeviceSize size   = AlignSize(allocate_info->allocationSize, pool_alignment_);
+    MemoryPool&  pool   = memory_pools_[allocate_info->memoryTypeIndex];
+    MemoryBlock* block  = nullptr;
+
+    // First fit search of the existing blocks.  Free range offsets and sizes are multiples of the pool alignment.
+    auto range = std::map<VkDeviceSize, VkDeviceSize>::iterator();
+
+    for (const auto& entry : pool)
+    {
+        range = std::find_if(entry->free_ranges.begin(),
+                             entry->free_ranges.end(),
+                             [size](const std::pair<const VkDeviceSize, VkDeviceSize>& free_range) {
+                                 return free_range.second >= size;
+                             });
+
+        if (range != entry->free_ranges.end())
+        {
+            block = entry.get();
+            break;
+        }
+    }
+
+    if (block == nullptr)
+    {
+        VkMemoryAllocateInfo block_allocate_info = *allocate_info;
+        block_allocate_info.allocationSize       = pool_block_size_;
+
+        auto new_block = std::make_unique<MemoryBlock>();
+
+        result = functions_.allocate_memory(device_, &block_allocate_info, nullptr, &new_block->memory);
+
+        if (result >= 0)
+        {
+            new_block->size = pool_block_size_;
+            new_block->free_ranges.emplace(0, pool_block_size_);
+
+            block = new_block.get();
+            range = block->free_ranges.begin();
+
+            pool.emplace_back(std::move(new_block));
+        }
+    }
+
+    if (block != nullptr)
+    {
+        VkDeviceSize offset     = range->first;
+        VkDeviceSize range_size = range->second;
+
+        block->free_ranges.erase(range);
+
+        if (range_size > size)
+        {
+            block->free_ranges.emplace(offset + size, range_size - size);
+        }
+
+        ++block->allocation_count;
+
+        memory_alloc_info->pool_block  = block;
+        memory_alloc_info->pool_offset = offset;
+        memory_alloc_info->pool_size   = size;
+
+        (*memory) = block->memory;
+    }
 
     return result;
 }
 
+void VulkanDefaultAllocator::FreeToPool(const MemoryAllocInfo* memory_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (memory_alloc_info->pool_block != nullptr));
+
+    MemoryBlock* block       = memory_alloc_info->pool_block;
+    auto&        free_ranges = block->free_ranges;
+    auto         range       = free_ranges.emplace(memory_alloc_info->pool_offset, memory_alloc_info->pool_size).first;
+
+    // Merge with the following and preceding free ranges.
+    auto next = std::next(range);
+    if ((next != free_ranges.end()) && ((range->first + range->second) == next->first))
+    {
+        range->second += next->second;
+        free_ranges.erase(next);
+    }
+
+    if (range != free_ranges.begin())
+    {
+        auto prev = std::prev(range);
+        if ((prev->first + prev->second) == range->first)
+        {
+            prev->second += range->second;
+            free_ranges.erase(range);
+        }
+    }
+
+    assert(block->allocation_count > 0);
+    --block->allocation_count;
+
+    if (block->allocation_count == 0)
+    {
+        // Empty blocks are released, unless they are the only block for the memory type, to avoid repeatedly
+        // allocating and freeing a block when an application frequently allocates and frees a small allocation.
+        MemoryPool& pool = memory_pools_[memory_alloc_info->memory_type_index];
+
+        if (pool.size() > 1)
+        {
+            if (block->mapped_pointer != nullptr)
+            {
+                functions_.unmap_memory(device_, block->memory);
+            }
+
+            functions_.free_memory(device_, block->memory, nullptr);
+
+            pool.erase(std::find_if(pool.begin(), pool.end(), [block](const std::unique_ptr<MemoryBlock>& entry) {
+                return entry.get() == block;
+            }));
+        }
+    }
+}
+
+std::unique_ptr<VkMappedMemoryRange[]>
+VulkanDefaultAllocator::GetPooledMemoryRanges(uint32_t                   memory_range_count,
+                                              const VkMappedMemoryRange* memory_ranges,
+                                              const MemoryData*          allocator_datas) const
+{
+    std::unique_ptr<VkMappedMemoryRange[]> pooled_ranges;
+
+    if ((pool_block_size_ > 0) && (memory_ranges != nullptr) && (allocator_datas != nullptr))
+    {
+        for (uint32_t i = 0; i < memory_range_count; ++i)
+        {
+            auto memory_alloc_info = GetMemoryAllocInfo(allocator_datas[i]);
+
+            if ((memory_alloc_info != nullptr) && (memory_alloc_info->pool_block != nullptr) &&
+                (memory_ranges[i].offset < memory_alloc_info->pool_size))
+            {
+                if (pooled_ranges == nullptr)
+                {
+                    pooled_ranges = std::make_unique<VkMappedMemoryRange[]>(memory_range_count);
+                    std::copy(memory_ranges, memory_ranges + memory_range_count, pooled_ranges.get());
+                }
+
+                // A range that ends at the end of the captured allocation may not be a multiple of the non-coherent
+                // atom size, which is only valid at the end of the block, so sizes are rounded up to a multiple of
+                // the atom size.  The pooled range size is a multiple of the atom size.
+                VkMappedMemoryRange& range          = pooled_ranges[i];
+                VkDeviceSize         remaining_size = memory_alloc_info->pool_size - range.offset;
+
+                if (range.size == VK_WHOLE_SIZE)
+                {
+                    range.size = remaining_size;
+                }
+                else
+                {
+                    range.size = std::min(AlignSize(range.size, non_coherent_atom_size_), remaining_size);
+                }
+
+                range.offset += memory_alloc_info->pool_offset;
+            }
+        }
+    }
+
+    return pooled_ranges;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -27,6 +27,9 @@
 #include "util/defines.h"
 
 #include <limits>
+#include <map>
+#include <memory>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -251,6 +254,17 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
 
     virtual bool SupportsOpaqueDeviceAddresses() override { return true; }
 
+    // Enables pooled suballocation, where captured memory allocations are carved out of larger VkDeviceMemory blocks
+    // of the specified size that are allocated per memory type.  Each captured allocation occupies a contiguous range
+    // of a block, so resources are bound at their capture offsets relative to the start of that range.  Allocations
+    // with extension structures, and allocations larger than a quarter of the block size, are not pooled.  Pooling is
+    // disabled when a sparse resource is created, and is disabled for the memory types of resources that require an
+    // alignment larger than the pool alignment.  Must be called before Initialize().
+    void SetMemoryPoolBlockSize(VkDeviceSize block_size) { pool_block_size_ = block_size; }
+
+  public:
+    static const VkDeviceSize kDefaultMemoryPoolBlockSize = 64 * 1024 * 1024;
+
   protected:
     struct ResourceAllocInfo
     {
@@ -259,12 +273,26 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
         VkDeviceSize     bound_offset{ 0 };
     };
 
+    struct MemoryBlock
+    {
+        VkDeviceMemory memory{ VK_NULL_HANDLE };
+        VkDeviceSize   size{ 0 };
+        uint8_t*       mapped_pointer{ nullptr };
+        uint32_t       allocation_count{ 0 };
+
+        // Unused ranges of the block, mapping offset to size.  Adjacent ranges are merged when allocations are freed.
+        std::map<VkDeviceSize, VkDeviceSize> free_ranges;
+    };
+
     struct MemoryAllocInfo
     {
         format::HandleId      capture_id{ format::kNullHandleId };
         uint32_t              memory_type_index{ std::numeric_limits<uint32_t>::max() };
         VkMemoryPropertyFlags property_flags{ 0 };
         uint8_t*              mapped_pointer{ nullptr };
+        MemoryBlock*          pool_block{ nullptr };
+        VkDeviceSize          pool_offset{ 0 };
+        VkDeviceSize          pool_size{ 0 };
     };
 
   protected:
@@ -289,11 +317,46 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
                                    const MemoryData*           allocator_memory_datas,
                                    uint32_t                    resource_count);
 
+    bool IsPoolable(const VkMemoryAllocateInfo* allocate_info, format::HandleId capture_id) const;
+
+    // Stops pooling new allocations when a sparse resource is created.
+    void DisableMemoryPooling(const char* resource_type);
+
+    // Stops pooling allocations for memory types that may be bound to a resource with an alignment that is larger than
+    // the pool alignment.
+    void UpdatePoolableMemoryTypes(const VkMemoryRequirements& requirements);
+
+    VkResult AllocateFromPool(const VkMemoryAllocateInfo* allocate_info,
+                              VkDeviceMemory*             memory,
+                              MemoryAllocInfo*            memory_alloc_info);
+
+    void FreeToPool(const MemoryAllocInfo* memory_alloc_info);
+
+    VkDeviceSize GetPoolOffset(MemoryData allocator_data) const
+    {
+        auto memory_alloc_info = GetMemoryAllocInfo(allocator_data);
+        return (memory_alloc_info != nullptr) ? memory_alloc_info->pool_offset : 0;
+    }
+
+    // Converts mapped memory ranges for pooled allocations to ranges of the memory block.  Returns nullptr when no
+    // ranges reference pooled allocations.
+    std::unique_ptr<VkMappedMemoryRange[]> GetPooledMemoryRanges(uint32_t                   memory_range_count,
+                                                                 const VkMappedMemoryRange* memory_ranges,
+                                                                 const MemoryData*          allocator_datas) const;
+
   private:
+    typedef std::vector<std::unique_ptr<MemoryBlock>> MemoryPool;
+
     VkDevice                         device_;
     Functions                        functions_;
     VkPhysicalDeviceMemoryProperties memory_properties_;
     std::string                      custom_error_string_;
+    VkDeviceSize                     pool_block_size_;
+    VkDeviceSize                     pool_alignment_;
+    VkDeviceSize                     non_coherent_atom_size_;
+    uint32_t                         unpooled_memory_types_;
+    bool                             pooling_disabled_;
+    std::vector<MemoryPool>          memory_pools_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,242 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_export_consumer_base.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const char kExportFileMagic[] = "GFXRCOL1";
+
+// Column schema, which must match the order in which WriteRowGroup() writes the columns.
+struct ExportColumnInfo
+{
+    const char*                          name;
+    VulkanExportConsumerBase::ColumnType type;
+};
+
+const ExportColumnInfo kExportColumns[] = {
+    { "index", VulkanExportConsumerBase::kColumnTypeUInt64 },
+    { "thread_id", VulkanExportConsumerBase::kColumnTypeUInt64 },
+    { "api_call_id", VulkanExportConsumerBase::kColumnTypeUInt32 },
+    { "has_return_value", VulkanExportConsumerBase::kColumnTypeUInt8 },
+    { "return_value", VulkanExportConsumerBase::kColumnTypeInt64 },
+    { "dispatch_handle_id", VulkanExportConsumerBase::kColumnTypeUInt64 },
+    { "object_handle_id", VulkanExportConsumerBase::kColumnTypeUInt64 },
+    { "parameter_size", VulkanExportConsumerBase::kColumnTypeUInt64 },
+    { "block_size", VulkanExportConsumerBase::kColumnTypeUInt64 },
+};
+
+VulkanExportConsumerBase::VulkanExportConsumerBase() : file_(nullptr), bytes_written_(0), total_row_count_(0) {}
+
+VulkanExportConsumerBase::~VulkanExportConsumerBase()
+{
+    Destroy();
+}
+
+bool VulkanExportConsumerBase::Initialize(FILE* file)
+{
+    assert(file);
+
+    file_            = file;
+    bytes_written_   = 0;
+    total_row_count_ = 0;
+    row_groups_.clear();
+
+    WriteBytes(kExportFileMagic, strlen(kExportFileMagic));
+
+    return !ferror(file_);
+}
+
+void VulkanExportConsumerBase::Destroy()
+{
+    if (file_ != nullptr)
+    {
+        WriteRowGroup();
+        WriteFooter();
+
+        if (ferror(file_))
+        {
+            GFXRECON_LOG_ERROR("Failed to write columnar export data");
+        }
+
+        file_ = nullptr;
+    }
+}
+
+void VulkanExportConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(
+    const ApiCallInfo&               call_info,
+    format::HandleId                 commandBuffer,
+    format::HandleId                 descriptorUpdateTemplate,
+    format::HandleId                 layout,
+    uint32_t                         set,
+    DescriptorUpdateTemplateDecoder* pData)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(layout);
+    GFXRECON_UNREFERENCED_PARAMETER(set);
+    GFXRECON_UNREFERENCED_PARAMETER(pData);
+
+    AddApiCall(call_info,
+               format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR,
+               false,
+               0,
+               commandBuffer,
+               descriptorUpdateTemplate);
+}
+
+void VulkanExportConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(const ApiCallInfo& call_info,
+                                                                         format::HandleId   device,
+                                                                         format::HandleId   descriptorSet,
+                                                                         format::HandleId   descriptorUpdateTemplate,
+                                                                         DescriptorUpdateTemplateDecoder* pData)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
+    GFXRECON_UNREFERENCED_PARAMETER(pData);
+
+    AddApiCall(
+        call_info, format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate, false, 0, device, descriptorSet);
+}
+
+void VulkanExportConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(
+    const ApiCallInfo&               call_info,
+    format::HandleId                 device,
+    format::HandleId                 descriptorSet,
+    format::HandleId                 descriptorUpdateTemplate,
+    DescriptorUpdateTemplateDecoder* pData)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
+    GFXRECON_UNREFERENCED_PARAMETER(pData);
+
+    AddApiCall(
+        call_info, format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR, false, 0, device, descriptorSet);
+}
+
+void VulkanExportConsumerBase::AddApiCall(const ApiCallInfo& call_info,
+                                          format::ApiCallId  call_id,
+                                          bool               has_return_value,
+                                          int64_t            return_value,
+                                          format::HandleId   dispatch_handle_id,
+                                          format::HandleId   object_handle_id)
+{
+    if (file_ != nullptr)
+    {
+        index_column_.push_back(call_info.index);
+        thread_id_column_.push_back(call_info.thread_id);
+        api_call_id_column_.push_back(static_cast<uint32_t>(call_id));
+        has_return_value_column_.push_back(has_return_value ? 1 : 0);
+        return_value_column_.push_back(return_value);
+        dispatch_handle_id_column_.push_back(dispatch_handle_id);
+        object_handle_id_column_.push_back(object_handle_id);
+        parameter_size_column_.push_back(call_info.parameter_size);
+        block_size_column_.push_back(call_info.block_size);
+
+        if (index_column_.size() >= kRowGroupSize)
+        {
+            WriteRowGroup();
+        }
+    }
+}
+
+template <typename T>
+void VulkanExportConsumerBase::WriteColumn(const std::vector<T>& column)
+{
+    WriteBytes(column.data(), column.size() * sizeof(T));
+}
+
+void VulkanExportConsumerBase::WriteBytes(const void* data, size_t size)
+{
+    if (size > 0)
+    {
+        bytes_written_ += util::platform::FileWrite(data, 1, size, file_);
+    }
+}
+
+void VulkanExportConsumerBase::WriteRowGroup()
+{
+    uint64_t row_count = index_column_.size();
+
+    if (row_count > 0)
+    {
+        row_groups_.push_back({ bytes_written_, row_count });
+        total_row_count_ += row_count;
+
+        WriteColumn(index_column_);
+        WriteColumn(thread_id_column_);
+        WriteColumn(api_call_id_column_);
+        WriteColumn(has_return_value_column_);
+        WriteColumn(return_value_column_);
+        WriteColumn(dispatch_handle_id_column_);
+        WriteColumn(object_handle_id_column_);
+        WriteColumn(parameter_size_column_);
+        WriteColumn(block_size_column_);
+
+        index_column_.clear();
+        thread_id_column_.clear();
+        api_call_id_column_.clear();
+        has_return_value_column_.clear();
+        return_value_column_.clear();
+        dispatch_handle_id_column_.clear();
+        object_handle_id_column_.clear();
+        parameter_size_column_.clear();
+        block_size_column_.clear();
+    }
+}
+
+void VulkanExportConsumerBase::WriteFooter()
+{
+    uint64_t footer_offset = bytes_written_;
+    uint32_t column_count  = static_cast<uint32_t>(sizeof(kExportColumns) / sizeof(kExportColumns[0]));
+
+    WriteBytes(&column_count, sizeof(column_count));
+
+    for (const auto& column : kExportColumns)
+    {
+        uint32_t type        = column.type;
+        uint32_t name_length = static_cast<uint32_t>(strlen(column.name));
+
+        WriteBytes(&type, sizeof(type));
+        WriteBytes(&name_length, sizeof(name_length));
+        WriteBytes(column.name, name_length);
+    }
+
+    uint32_t row_group_count = static_cast<uint32_t>(row_groups_.size());
+
+    WriteBytes(&row_group_count, sizeof(row_group_count));
+
+    for (const auto& row_group : row_groups_)
+    {
+        WriteBytes(&row_group.file_offset, sizeof(row_group.file_offset));
+        WriteBytes(&row_group.row_count, sizeof(row_group.row_count));
+    }
+
+    WriteBytes(&footer_offset, sizeof(footer_offset));
+    WriteBytes(kExportFileMagic, strlen(kExportFileMagic));
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,154 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_EXPORT_CONSUMER_BASE_H
+#define GFXRECON_DECODE_VULKAN_EXPORT_CONSUMER_BASE_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "format/platform_types.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdio>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Writes one row per decoded API call to a self-contained columnar file, for bulk analysis of capture files without
+// parsing text output.  The file is written in native byte order with the following layout:
+//
+//   Magic            "GFXRCOL1"
+//   Row group 0..N   For each column, in schema order, a packed array of row_count values of the column's type.
+//   Footer           uint32_t column_count
+//                    column_count x { uint32_t ColumnType, uint32_t name_length, char name[name_length] }
+//                    uint32_t row_group_count
+//                    row_group_count x { uint64_t file_offset, uint64_t row_count }
+//   Trailer          uint64_t footer_offset, "GFXRCOL1"
+//
+// Readers locate the footer from the trailer at the end of the file, so rows can be streamed while decoding.
+class VulkanExportConsumerBase : public VulkanConsumer
+{
+  public:
+    enum ColumnType : uint32_t
+    {
+        kColumnTypeUInt8  = 1,
+        kColumnTypeUInt32 = 2,
+        kColumnTypeUInt64 = 3,
+        kColumnTypeInt64  = 4
+    };
+
+  public:
+    VulkanExportConsumerBase();
+
+    virtual ~VulkanExportConsumerBase() override;
+
+    bool Initialize(FILE* file);
+
+    // Writes any buffered rows and the file footer.
+    void Destroy();
+
+    bool IsValid() const { return (file_ != nullptr); }
+
+    uint64_t GetRowCount() const { return total_row_count_; }
+
+    virtual void Process_vkCmdPushDescriptorSetWithTemplateKHR(const ApiCallInfo& call_info,
+                                                               format::HandleId   commandBuffer,
+                                                               format::HandleId   descriptorUpdateTemplate,
+                                                               format::HandleId   layout,
+                                                               uint32_t           set,
+                                                               DescriptorUpdateTemplateDecoder* pData) override;
+
+    virtual void Process_vkUpdateDescriptorSetWithTemplate(const ApiCallInfo&               call_info,
+                                                           format::HandleId                 device,
+                                                           format::HandleId                 descriptorSet,
+                                                           format::HandleId                 descriptorUpdateTemplate,
+                                                           DescriptorUpdateTemplateDecoder* pData) override;
+
+    virtual void Process_vkUpdateDescriptorSetWithTemplateKHR(const ApiCallInfo&               call_info,
+                                                              format::HandleId                 device,
+                                                              format::HandleId                 descriptorSet,
+                                                              format::HandleId                 descriptorUpdateTemplate,
+                                                              DescriptorUpdateTemplateDecoder* pData) override;
+
+  protected:
+    void AddApiCall(const ApiCallInfo& call_info,
+                    format::ApiCallId  call_id,
+                    bool               has_return_value,
+                    int64_t            return_value,
+                    format::HandleId   dispatch_handle_id,
+                    format::HandleId   object_handle_id);
+
+    template <typename T>
+    static format::HandleId GetFirstHandleId(const HandlePointerDecoder<T>* handles)
+    {
+        if ((handles != nullptr) && !handles->IsNull() && (handles->GetLength() > 0))
+        {
+            return handles->GetPointer()[0];
+        }
+
+        return format::kNullHandleId;
+    }
+
+  private:
+    struct RowGroupInfo
+    {
+        uint64_t file_offset;
+        uint64_t row_count;
+    };
+
+    template <typename T>
+    void WriteColumn(const std::vector<T>& column);
+
+    void WriteBytes(const void* data, size_t size);
+
+    void WriteRowGroup();
+
+    void WriteFooter();
+
+  private:
+    static const size_t kRowGroupSize = 64 * 1024;
+
+    FILE*                     file_;
+    uint64_t                  bytes_written_;
+    uint64_t                  total_row_count_;
+    std::vector<RowGroupInfo> row_groups_;
+
+    // Column data for the current row group.
+    std::vector<uint64_t> index_column_;
+    std::vector<uint64_t> thread_id_column_;
+    std::vector<uint32_t> api_call_id_column_;
+    std::vector<uint8_t>  has_return_value_column_;
+    std::vector<int64_t>  return_value_column_;
+    std::vector<uint64_t> dispatch_handle_id_column_;
+    std::vector<uint64_t> object_handle_id_column_;
+    std::vector<uint64_t> parameter_size_column_;
+    std::vector<uint64_t> block_size_column_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_EXPORT_CONSUMER_BASE_H
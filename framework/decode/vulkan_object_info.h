@@ -33,6 +33,7 @@
 
 #include "vulkan/vulkan.h"
 
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -263,6 +264,7 @@ struct DeviceInfo : public VulkanObjectInfo<VkDevice>
 struct QueueInfo : public VulkanObjectInfo<VkQueue>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
+    uint32_t                             family_index{ 0 };
 };
 
 struct SemaphoreInfo : public VulkanObjectInfo<VkSemaphore>
@@ -330,11 +332,19 @@ struct ImageInfo : public VulkanObjectInfo<VkImage>
 struct PipelineCacheInfo : public VulkanObjectInfo<VkPipelineCache>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
+
+    // Created with VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT, so pipeline creation calls that use the cache
+    // must not run concurrently.
+    bool externally_synchronized{ false };
 };
 
 struct PipelineInfo : public VulkanObjectInfo<VkPipeline>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
+
+    // Valid for pipelines that are created on a worker thread.  The handle is set by the worker thread, and must not be
+    // accessed until the pending creation is ready.
+    std::shared_future<void> pending_creation;
 };
 
 struct DescriptorPoolInfo : public VulkanPoolInfo<VkDescriptorPool>
@@ -32,6 +32,35 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class VulkanObjectInfoTable : public VulkanObjectInfoTableBase2
 {
   public:
+    // Adds the info for a pipeline that is being created on a worker thread, returning the table entry that the worker
+    // thread will write the pipeline handle to.
+    PipelineInfo* AddPendingPipelineInfo(PipelineInfo&& info)
+    {
+        assert((info.capture_id != format::kNullHandleId) && info.pending_creation.valid());
+
+        // An existing entry for the same ID may still be written by an earlier pending creation.
+        GetPipelineInfo(info.capture_id);
+
+        PipelineInfo& entry = pipeline_map_[info.capture_id];
+        entry               = std::move(info);
+        return &entry;
+    }
+
+    // Pipeline lookups wait for pending pipeline creation to complete, so that the returned info has a valid handle.
+    const PipelineInfo* GetPipelineInfo(format::HandleId id) const
+    {
+        const PipelineInfo* info = VulkanObjectInfoTableBase2::GetPipelineInfo(id);
+        WaitPendingCreation(info);
+        return info;
+    }
+
+    PipelineInfo* GetPipelineInfo(format::HandleId id)
+    {
+        PipelineInfo* info = VulkanObjectInfoTableBase2::GetPipelineInfo(id);
+        WaitPendingCreation(info);
+        return info;
+    }
+
     void ReplaceSemaphore(VkSemaphore target, VkSemaphore replacement)
     {
         for (auto& entry : semaphore_map_)
@@ -55,6 +84,15 @@ class VulkanObjectInfoTable : public VulkanObjectInfoTableBase2
             }
         }
     }
+
+  private:
+    static void WaitPendingCreation(const PipelineInfo* info)
+    {
+        if ((info != nullptr) && info->pending_creation.valid())
+        {
+            info->pending_creation.wait();
+        }
+    }
 };
 
 GFXRECON_END_NAMESPACE(decode)
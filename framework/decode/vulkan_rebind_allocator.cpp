@@ -207,7 +207,7 @@ void VulkanRebindAllocator::DestroyBuffer(VkBuffer                     buffer,
 
         if (memory_alloc_info != nullptr)
         {
-            memory_alloc_info->original_buffers.erase(buffer);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -270,7 +270,7 @@ void VulkanRebindAllocator::DestroyImage(VkImage                      image,
 
         if (memory_alloc_info != nullptr)
         {
-            memory_alloc_info->original_images.erase(image);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -358,12 +358,7 @@ void VulkanRebindAllocator::FreeMemory(VkDeviceMemory               memory,
         // Clear references from resources to the allocation info and cleanup allocation info memory.
         auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
 
-        for (const auto& entry : memory_alloc_info->original_buffers)
-        {
-            entry.second->memory_info = nullptr;
-        }
-
-        for (const auto& entry : memory_alloc_info->original_images)
+        for (const auto& entry : memory_alloc_info->bound_resources)
         {
             entry.second->memory_info = nullptr;
         }
@@ -439,18 +434,14 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer               buffer,
                     resource_alloc_info->is_host_visible = true;
                 }
 
-                if (memory_alloc_info->original_content != nullptr)
+                if (!memory_alloc_info->original_content.IsEmpty())
                 {
                     // Memory has been mapped and written prior to bind.  Copy the original content to the new
                     // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
+                    WriteOriginalContentToResource(memory_alloc_info, resource_alloc_info);
                 }
 
-                memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                 (*bind_memory_properties) = property_flags;
             }
@@ -525,18 +516,14 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
+                        if (!memory_alloc_info->original_content.IsEmpty())
                         {
                             // Memory has been mapped and written prior to bind.  Copy the original content to the new
                             // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
+                            WriteOriginalContentToResource(memory_alloc_info, resource_alloc_info);
                         }
 
-                        memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -606,18 +593,14 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage                image,
                     resource_alloc_info->is_host_visible = true;
                 }
 
-                if (memory_alloc_info->original_content != nullptr)
+                if (!memory_alloc_info->original_content.IsEmpty())
                 {
                     // Memory has been mapped and written prior to bind.  Copy the original content to the new
                     // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
+                    WriteOriginalContentToResource(memory_alloc_info, resource_alloc_info);
                 }
 
-                memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                 (*bind_memory_properties) = property_flags;
             }
@@ -693,18 +676,14 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
+                        if (!memory_alloc_info->original_content.IsEmpty())
                         {
                             // Memory has been mapped and written prior to bind.  Copy the original content to the new
                             // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
+                            WriteOriginalContentToResource(memory_alloc_info, resource_alloc_info);
                         }
 
-                        memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -780,34 +759,20 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
 
         if (memory_alloc_info->is_mapped)
         {
-            if (memory_alloc_info->original_content == nullptr)
-            {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_alloc_info->allocation_size);
-                size_t allocation_size = static_cast<size_t>(memory_alloc_info->allocation_size);
-
-                memory_alloc_info->original_content = std::make_unique<uint8_t[]>(allocation_size);
-            }
+            VkDeviceSize write_start = memory_alloc_info->mapped_offset + offset;
+            VkDeviceSize write_end   = write_start + size;
 
             // Update the reconstructed memory, which is written to memory allocations created at resource bind to
             // ensure they contain the correct data.
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
-            size_t   copy_size = static_cast<size_t>(size);
-            uint8_t* copy_dst  = memory_alloc_info->original_content.get() + memory_alloc_info->mapped_offset + offset;
-
-            util::platform::MemoryCopy(copy_dst, copy_size, data, copy_size);
-
-            VkDeviceSize write_start = memory_alloc_info->mapped_offset + offset;
-            VkDeviceSize write_end   = write_start + size;
+            WriteOriginalContent(memory_alloc_info, write_start, size, data);
 
             // Copy to the resources that were bound to this range at capture.
-            for (const auto& entry : memory_alloc_info->original_buffers)
+            auto& bound_resources = memory_alloc_info->bound_resources;
+            for (auto entry = FindBoundResources(memory_alloc_info, write_start);
+                 (entry != bound_resources.end()) && (entry->first < write_end);
+                 ++entry)
             {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
-
-            for (const auto& entry : memory_alloc_info->original_images)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
+                UpdateBoundResource(entry->second, write_start, write_end, data);
             }
 
             result = VK_SUCCESS;
@@ -870,6 +835,87 @@ void VulkanRebindAllocator::ReportBindImage2Incompatibility(uint32_t
     ReportBindIncompatibility(allocator_resource_datas, bind_info_count);
 }
 
+void VulkanRebindAllocator::AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    memory_alloc_info->bound_resources.emplace(resource_alloc_info->original_offset, resource_alloc_info);
+    memory_alloc_info->max_bound_resource_size =
+        std::max(memory_alloc_info->max_bound_resource_size, resource_alloc_info->size);
+}
+
+void VulkanRebindAllocator::RemoveBoundResource(MemoryAllocInfo*         memory_alloc_info,
+                                                const ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    auto range = memory_alloc_info->bound_resources.equal_range(resource_alloc_info->original_offset);
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        if (entry->second == resource_alloc_info)
+        {
+            memory_alloc_info->bound_resources.erase(entry);
+            break;
+        }
+    }
+}
+
+VulkanRebindAllocator::BoundResourceMap::iterator
+VulkanRebindAllocator::FindBoundResources(MemoryAllocInfo* memory_alloc_info, VkDeviceSize range_start)
+{
+    assert(memory_alloc_info != nullptr);
+
+    // A resource can only overlap the range if it starts less than the size of the largest bound resource before the
+    // start of the range.  The maximum size is not reduced when resources are removed, which only makes the search
+    // more conservative.
+    VkDeviceSize max_size = memory_alloc_info->max_bound_resource_size;
+
+    if (range_start < max_size)
+    {
+        return memory_alloc_info->bound_resources.begin();
+    }
+
+    return memory_alloc_info->bound_resources.lower_bound((range_start - max_size) + 1);
+}
+
+void VulkanRebindAllocator::WriteOriginalContent(MemoryAllocInfo* memory_alloc_info,
+                                                 VkDeviceSize     offset,
+                                                 VkDeviceSize     size,
+                                                 const uint8_t*   data)
+{
+    assert(memory_alloc_info != nullptr);
+
+    // Unwritten pages read as zero, matching the content of a newly allocated shadow copy.
+    memory_alloc_info->original_content.Write(offset, size, data);
+}
+
+void VulkanRebindAllocator::WriteOriginalContentToResource(const MemoryAllocInfo* memory_alloc_info,
+                                                           ResourceAllocInfo*     resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    VkDeviceSize resource_start = resource_alloc_info->original_offset;
+    VkDeviceSize resource_end =
+        std::min(resource_start + resource_alloc_info->size, memory_alloc_info->allocation_size);
+
+    if ((resource_start >= resource_end) ||
+        !memory_alloc_info->original_content.HasPages(resource_start, resource_end - resource_start))
+    {
+        // No content has been written to the range of the allocation that is bound to the resource.
+        return;
+    }
+
+    // Gather the written pages into a single buffer, with the ranges that have not been written read as zero, so that
+    // the resource is updated with one write.
+    VkDeviceSize content_size = resource_end - resource_start;
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, content_size);
+    std::unique_ptr<uint8_t[]> content(new uint8_t[static_cast<size_t>(content_size)]);
+
+    memory_alloc_info->original_content.Read(resource_start, content_size, content.get());
+
+    WriteBoundResource(resource_alloc_info, 0, 0, content_size, content.get());
+}
+
 void VulkanRebindAllocator::WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                                                VkDeviceSize       src_offset,
                                                VkDeviceSize       dst_offset,
@@ -1082,17 +1128,12 @@ VkResult VulkanRebindAllocator::UpdateMappedMemoryRanges(
                 VkDeviceSize range_start = memory_ranges[i].offset;
                 VkDeviceSize range_end   = range_start + size;
 
-                for (const auto& entry : memory_alloc_info->original_buffers)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
-
-                for (const auto& entry : memory_alloc_info->original_images)
+                auto& bound_resources = memory_alloc_info->bound_resources;
+                for (auto entry = FindBoundResources(memory_alloc_info, range_start);
+                     (entry != bound_resources.end()) && (entry->first < range_end);
+                     ++entry)
                 {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
+                    if (UpdateMappedMemoryRange(entry->second, range_start, range_end, update_func) != VK_SUCCESS)
                     {
                         result = VK_ERROR_MEMORY_MAP_FAILED;
                     }
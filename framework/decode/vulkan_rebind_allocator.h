@@ -25,14 +25,15 @@
 
 #include "decode/vulkan_resource_allocator.h"
 #include "util/defines.h"
+#include "util/sparse_page_buffer.h"
 
 #include "vk_mem_alloc.h"
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
-#include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -285,18 +286,37 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         std::vector<SubresourceLayouts> layouts;
     };
 
+    // Resources bound to a memory allocation, ordered by their offset in the original allocation.
+    typedef std::multimap<VkDeviceSize, ResourceAllocInfo*> BoundResourceMap;
+
     struct MemoryAllocInfo
     {
-        VkDeviceSize                                     allocation_size{ 0 };
-        uint32_t                                         original_index{ std::numeric_limits<uint32_t>::max() };
-        bool                                             is_mapped{ false };
-        VkDeviceSize                                     mapped_offset{ 0 };
-        std::unique_ptr<uint8_t[]>                       original_content;
-        std::unordered_map<VkBuffer, ResourceAllocInfo*> original_buffers;
-        std::unordered_map<VkImage, ResourceAllocInfo*>  original_images;
+        VkDeviceSize           allocation_size{ 0 };
+        uint32_t               original_index{ std::numeric_limits<uint32_t>::max() };
+        bool                   is_mapped{ false };
+        VkDeviceSize           mapped_offset{ 0 };
+        util::SparsePageBuffer original_content; // Content written to the mapped allocation, allocated when written.
+        BoundResourceMap       bound_resources;
+        VkDeviceSize           max_bound_resource_size{ 0 };
     };
 
   private:
+    void AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
+    void RemoveBoundResource(MemoryAllocInfo* memory_alloc_info, const ResourceAllocInfo* resource_alloc_info);
+
+    // Returns the first resource, in order of original offset, that may overlap a range starting at range_start.
+    BoundResourceMap::iterator FindBoundResources(MemoryAllocInfo* memory_alloc_info, VkDeviceSize range_start);
+
+    void WriteOriginalContent(MemoryAllocInfo* memory_alloc_info,
+                              VkDeviceSize     offset,
+                              VkDeviceSize     size,
+                              const uint8_t*   data);
+
+    // Copies the content that was written to the original memory allocation before the resource was bound.
+    void WriteOriginalContentToResource(const MemoryAllocInfo* memory_alloc_info,
+                                        ResourceAllocInfo*     resource_alloc_info);
+
     void WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                             VkDeviceSize       src_offset,
                             VkDeviceSize       dst_offset,
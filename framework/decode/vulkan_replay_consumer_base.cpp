@@ -23,6 +23,7 @@
 
 #include "decode/vulkan_replay_consumer_base.h"
 #include "decode/custom_vulkan_struct_handle_mappers.h"
+#include "decode/decode_allocator.h"
 #include "decode/descriptor_update_template_decoder.h"
 #include "decode/resource_util.h"
 #include "decode/vulkan_enum_util.h"
@@ -38,8 +39,12 @@
 
 #include "generated/generated_vulkan_enum_to_string.h"
 
+#include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <limits>
+#include <map>
 #include <unordered_set>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -143,7 +148,8 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(std::shared_ptr<application::
                                                    const VulkanReplayOptions&                options) :
     loader_handle_(nullptr),
     get_instance_proc_addr_(nullptr), create_instance_proc_(nullptr), application_(application), options_(options),
-    loading_trim_state_(false), have_imported_semaphores_(false), create_surface_count_(0), fps_info_(nullptr)
+    loading_trim_state_(false), have_imported_semaphores_(false), create_surface_count_(0), fps_info_(nullptr),
+    frame_statistics_(nullptr), profiler_(nullptr)
 {
     assert(application_ != nullptr);
     assert(options.create_resource_allocator != nullptr);
@@ -152,6 +158,17 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(std::shared_ptr<application::
     {
         InitializeScreenshotHandler();
     }
+
+    if (options.async_pipeline_creation)
+    {
+        // A thread count of 0 creates one worker thread per CPU core.
+        pipeline_creation_pool_ = std::make_unique<util::ThreadPool>(0);
+    }
+
+    if (!options.replace_dir.empty())
+    {
+        LoadShaderManifest();
+    }
 }
 
 VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
@@ -164,6 +181,8 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
                              create_surface_count_);
     }
 
+    WaitPipelineCreation();
+
     // Idle all devices before destroying other resources, and cleanup screenshot resources before destroying device.
     object_info_table_.VisitDeviceInfo([this](const DeviceInfo* info) {
         assert(info != nullptr);
@@ -202,6 +221,50 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
     }
 }
 
+void VulkanReplayConsumerBase::BeginLoopRangeObjectCheck()
+{
+    loop_range_object_ids_.clear();
+    object_info_table_.VisitObjectIds(
+        [this](const char* type_name, format::HandleId id) { loop_range_object_ids_.insert(id); });
+}
+
+bool VulkanReplayConsumerBase::EndLoopRangeObjectCheck()
+{
+    std::map<std::string, size_t> alive_counts;
+    size_t                        alive_count = 0;
+
+    object_info_table_.VisitObjectIds([&](const char* type_name, format::HandleId id) {
+        // Queues and physical devices are retrieved from their parents, and are never destroyed.
+        if ((loop_range_object_ids_.find(id) == loop_range_object_ids_.end()) && (strcmp(type_name, "VkQueue") != 0) &&
+            (strcmp(type_name, "VkPhysicalDevice") != 0))
+        {
+            ++alive_counts[type_name];
+            ++alive_count;
+        }
+    });
+
+    loop_range_object_ids_.clear();
+
+    if (alive_count > 0)
+    {
+        std::string alive_types;
+
+        for (const auto& entry : alive_counts)
+        {
+            alive_types += (alive_types.empty() ? "" : ", ") + std::to_string(entry.second) + " " + entry.first;
+        }
+
+        GFXRECON_LOG_WARNING("The looped frame range created %" PRIu64
+                             " objects that it did not destroy (%s), and is not a steady-state section of the "
+                             "capture; the range will not be replayed again",
+                             static_cast<uint64_t>(alive_count),
+                             alive_types.c_str());
+        return false;
+    }
+
+    return true;
+}
+
 void VulkanReplayConsumerBase::ProcessStateBeginMarker(uint64_t frame_number)
 {
     GFXRECON_LOG_INFO("Loading state for captured frame %" PRId64, frame_number);
@@ -1277,6 +1340,15 @@ void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId de
 
     if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
     {
+        VkResult result = device_info->resource_initializer->Flush();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING(
+                "State snapshot staging buffer copies failed to complete for VkDevice object (ID = %" PRIu64 ")",
+                device_id);
+        }
+
         device_info->resource_initializer.reset();
     }
 }
@@ -2319,11 +2391,19 @@ void VulkanReplayConsumerBase::InitializeScreenshotHandler()
         screenshot_file_prefix_ = util::filepath::Join(options_.screenshot_dir, screenshot_file_prefix_);
     }
 
-    screenshot_handler_ = std::make_unique<ScreenshotHandler>(options_.screenshot_format, options_.screenshot_ranges);
+    screenshot_handler_ = std::make_unique<ScreenshotHandler>(options_.screenshot_format,
+                                                              options_.screenshot_ranges,
+                                                              options_.screenshot_async,
+                                                              screenshot_file_prefix_ + kScreenshotHashManifestSuffix);
 }
 
-void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const
+void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info,
+                                                const QueueInfo*                queue_info,
+                                                uint32_t                        wait_semaphore_count,
+                                                const VkSemaphore*              wait_semaphores) const
 {
+    assert(queue_info != nullptr);
+
     if ((meta_info != nullptr) && (meta_info->decoded_value != nullptr) && !meta_info->pSwapchains.IsNull())
     {
         auto present_info  = meta_info->decoded_value;
@@ -2363,10 +2443,131 @@ void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR*
                                                 swapchain_info->images[image_index],
                                                 swapchain_info->format,
                                                 swapchain_info->width,
-                                                swapchain_info->height);
+                                                swapchain_info->height,
+                                                queue_info->handle,
+                                                queue_info->family_index,
+                                                wait_semaphore_count,
+                                                wait_semaphores);
+            }
+        }
+    }
+}
+
+void VulkanReplayConsumerBase::CreatePipelinesAsync(const char*                          func_name,
+                                                    VkResult                             original_result,
+                                                    format::HandleId                     device_id,
+                                                    uint32_t                             pipeline_count,
+                                                    HandlePointerDecoder<VkPipeline>*    pPipelines,
+                                                    std::function<VkResult(VkPipeline*)> create_func)
+{
+    assert((pipeline_creation_pool_ != nullptr) && (pPipelines != nullptr));
+
+    ReleaseCompletedPipelineCreationData();
+
+    auto                     promise    = std::make_shared<std::promise<void>>();
+    std::shared_future<void> completion = promise->get_future().share();
+
+    const format::HandleId*    pipeline_ids = pPipelines->GetPointer();
+    size_t                     id_count     = std::min(static_cast<size_t>(pipeline_count), pPipelines->GetLength());
+    std::vector<PipelineInfo*> pipeline_infos(pipeline_count, nullptr);
+
+    for (size_t i = 0; i < id_count; ++i)
+    {
+        if (pipeline_ids[i] != format::kNullHandleId)
+        {
+            PipelineInfo info;
+            info.capture_id       = pipeline_ids[i];
+            info.parent_id        = device_id;
+            info.pending_creation = completion;
+
+            pipeline_infos[i] = object_info_table_.AddPendingPipelineInfo(std::move(info));
+        }
+    }
+
+    // The create info structures were decoded to memory that is released when the API call completes, so the decoder
+    // allocations are kept until the worker thread has finished with them.
+    PendingPipelineCreation pending;
+    pending.completion         = completion;
+    pending.decode_allocations = DecodeAllocator::DetachAllocations();
+    pending_pipeline_creations_.emplace_back(std::move(pending));
+
+    pipeline_creation_pool_->Submit([func_name, original_result, pipeline_infos, create_func, promise]() {
+        std::vector<VkPipeline> pipelines(pipeline_infos.size(), VK_NULL_HANDLE);
+
+        VkResult result = create_func(pipelines.data());
+
+        if ((result != original_result) && (result < 0))
+        {
+            GFXRECON_LOG_ERROR("API call %s returned error value %s that does not match the result from the capture "
+                               "file: %s.  The pipelines will not be available.",
+                               func_name,
+                               util::ToString<VkResult>(result).c_str(),
+                               util::ToString<VkResult>(original_result).c_str());
+        }
+        else if (result != original_result)
+        {
+            GFXRECON_LOG_WARNING(
+                "API call %s returned value %s that does not match return value from capture file: %s.",
+                func_name,
+                util::ToString<VkResult>(result).c_str(),
+                util::ToString<VkResult>(original_result).c_str());
+        }
+
+        for (size_t i = 0; i < pipeline_infos.size(); ++i)
+        {
+            if (pipeline_infos[i] != nullptr)
+            {
+                pipeline_infos[i]->handle = pipelines[i];
             }
         }
+
+        promise->set_value();
+    });
+}
+
+bool VulkanReplayConsumerBase::IsPipelineCacheExternallySynchronized(const PipelineCacheInfo* pipeline_cache_info)
+{
+    if ((pipeline_cache_info != nullptr) && pipeline_cache_info->externally_synchronized)
+    {
+        // The pipelines are created on the current thread, after any pending creation calls that use the cache.
+        WaitPipelineCreation();
+        return true;
     }
+
+    return false;
+}
+
+void VulkanReplayConsumerBase::WaitPipelineCreation()
+{
+    if (pipeline_creation_pool_ != nullptr)
+    {
+        pipeline_creation_pool_->Wait();
+
+        for (auto& pending : pending_pipeline_creations_)
+        {
+            DecodeAllocator::ReleaseDetachedAllocations(std::move(pending.decode_allocations));
+        }
+
+        pending_pipeline_creations_.clear();
+    }
+}
+
+void VulkanReplayConsumerBase::ReleaseCompletedPipelineCreationData()
+{
+    auto completed = std::partition(
+        pending_pipeline_creations_.begin(),
+        pending_pipeline_creations_.end(),
+        [](const PendingPipelineCreation& pending) {
+            return pending.completion.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+        });
+
+    // The decoder allocations of completed calls are returned to the decode allocator to be reused.
+    for (auto entry = completed; entry != pending_pipeline_creations_.end(); ++entry)
+    {
+        DecodeAllocator::ReleaseDetachedAllocations(std::move(entry->decode_allocations));
+    }
+
+    pending_pipeline_creations_.erase(completed, pending_pipeline_creations_.end());
 }
 
 VkResult
@@ -2637,6 +2838,9 @@ void VulkanReplayConsumerBase::OverrideDestroyDevice(
     {
         device = device_info->handle;
 
+        // Pipeline creation calls on worker threads may still be using the device.
+        WaitPipelineCreation();
+
         if (screenshot_handler_ != nullptr)
         {
             screenshot_handler_->DestroyDeviceResources(device, GetDeviceTable(device));
@@ -3021,7 +3225,9 @@ VkResult VulkanReplayConsumerBase::OverrideWaitForFences(PFN_vkWaitForFences
     {
         // Ensure that wait for fences waits until the fences have been signaled (or error occurs) by changing the
         // timeout to UINT64_MAX.
+        BeginProfiledWait();
         result = func(device, modified_fence_count, modified_fences, waitAll, std::numeric_limits<uint64_t>::max());
+        EndProfiledWait();
     }
     else if (original_result == VK_TIMEOUT)
     {
@@ -3049,10 +3255,12 @@ VkResult VulkanReplayConsumerBase::OverrideGetFenceStatus(PFN_vkGetFenceStatus f
 
     // If you find this loop to be infinite consider adding a limit in the same way
     // it is done for GetEventStatus and GetQueryPoolResults.
+    BeginProfiledWait();
     do
     {
         result = func(device, fence);
     } while ((original_result == VK_SUCCESS) && (result == VK_NOT_READY));
+    EndProfiledWait();
 
     return result;
 }
@@ -3108,6 +3316,44 @@ VkResult VulkanReplayConsumerBase::OverrideGetQueryPoolResults(PFN_vkGetQueryPoo
     return result;
 }
 
+void VulkanReplayConsumerBase::OverrideGetDeviceQueue(PFN_vkGetDeviceQueue           func,
+                                                      const DeviceInfo*              device_info,
+                                                      uint32_t                       queueFamilyIndex,
+                                                      uint32_t                       queueIndex,
+                                                      HandlePointerDecoder<VkQueue>* pQueue)
+{
+    assert((device_info != nullptr) && (pQueue != nullptr) && !pQueue->IsNull() &&
+           (pQueue->GetHandlePointer() != nullptr));
+
+    func(device_info->handle, queueFamilyIndex, queueIndex, pQueue->GetHandlePointer());
+
+    // Store the queue family for operations that record command buffers for the queue.
+    auto queue_info = reinterpret_cast<QueueInfo*>(pQueue->GetConsumerData(0));
+    assert(queue_info != nullptr);
+
+    queue_info->family_index = queueFamilyIndex;
+}
+
+void VulkanReplayConsumerBase::OverrideGetDeviceQueue2(
+    PFN_vkGetDeviceQueue2                                   func,
+    const DeviceInfo*                                       device_info,
+    const StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+    HandlePointerDecoder<VkQueue>*                          pQueue)
+{
+    assert((device_info != nullptr) && (pQueueInfo != nullptr) && !pQueueInfo->IsNull() && (pQueue != nullptr) &&
+           !pQueue->IsNull() && (pQueue->GetHandlePointer() != nullptr));
+
+    const VkDeviceQueueInfo2* queue_info2 = pQueueInfo->GetPointer();
+
+    func(device_info->handle, queue_info2, pQueue->GetHandlePointer());
+
+    // Store the queue family for operations that record command buffers for the queue.
+    auto queue_info = reinterpret_cast<QueueInfo*>(pQueue->GetConsumerData(0));
+    assert(queue_info != nullptr);
+
+    queue_info->family_index = queue_info2->queueFamilyIndex;
+}
+
 VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit func,
                                                        VkResult          original_result,
                                                        const QueueInfo*  queue_info,
@@ -3229,7 +3475,9 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit func,
 
     if ((options_.sync_queue_submissions) && (result == VK_SUCCESS))
     {
+        BeginProfiledWait();
         GetDeviceTable(queue_info->handle)->QueueWaitIdle(queue_info->handle);
+        EndProfiledWait();
     }
 
     return result;
@@ -4399,13 +4647,23 @@ VkResult VulkanReplayConsumerBase::OverrideCreateShaderModule(
 
     VkShaderModuleCreateInfo override_info = *original_info;
 
-    // Replace shader in 'override_info'
+    // Replace shader in 'override_info'.  Shaders listed in the manifest written by gfxrecon-extract are found by
+    // handle ID, and other shaders are found by the checksum of their code.
     std::unique_ptr<char[]> file_code;
-    const uint32_t*         orig_code = original_info->pCode;
-    size_t                  orig_size = original_info->codeSize;
-    uint32_t                check_sum = util::hash::CheckSum(orig_code, orig_size);
-    std::string             file_name = "sh" + std::to_string(check_sum);
-    std::string             file_path = util::filepath::Join(options_.replace_dir, file_name);
+    std::string             file_name;
+    auto                    manifest_entry = shader_manifest_.find(*pShaderModule->GetPointer());
+
+    if (manifest_entry != shader_manifest_.end())
+    {
+        file_name = manifest_entry->second;
+    }
+    else
+    {
+        uint32_t check_sum = util::hash::CheckSum(original_info->pCode, original_info->codeSize);
+        file_name          = "sh" + std::to_string(check_sum);
+    }
+
+    std::string file_path = util::filepath::Join(options_.replace_dir, file_name);
 
     FILE*   fp     = nullptr;
     int32_t result = util::platform::FileOpen(&fp, file_path.c_str(), "rb");
@@ -4425,6 +4683,27 @@ VkResult VulkanReplayConsumerBase::OverrideCreateShaderModule(
         device_info->handle, &override_info, GetAllocationCallbacks(pAllocator), pShaderModule->GetHandlePointer());
 }
 
+void VulkanReplayConsumerBase::LoadShaderManifest()
+{
+    // The manifest is optional, and contains one line for each shader module with its handle ID and file name.
+    std::string   manifest_path = util::filepath::Join(options_.replace_dir, kShaderManifestFileName);
+    std::ifstream manifest(manifest_path);
+
+    if (manifest)
+    {
+        format::HandleId handle_id = format::kNullHandleId;
+        std::string      file_name;
+
+        while (manifest >> handle_id >> file_name)
+        {
+            shader_manifest_[handle_id] = file_name;
+        }
+
+        GFXRECON_LOG_INFO(
+            "Loaded %" PRIuPTR " shader replacements from %s", shader_manifest_.size(), manifest_path.c_str());
+    }
+}
+
 VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelineCacheData func,
                                                                 VkResult                   original_result,
                                                                 const DeviceInfo*          device_info,
@@ -4438,6 +4717,9 @@ VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelin
     }
     else
     {
+        // Include the data for pipelines that are being created on worker threads.
+        WaitPipelineCreation();
+
         return func(
             device_info->handle, pipeline_cache_info->handle, pDataSize->GetOutputPointer(), pData->GetOutputPointer());
     }
@@ -4457,6 +4739,13 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
            (pPipelineCache->GetHandlePointer() != nullptr));
 
     auto replay_create_info = pCreateInfo->GetPointer();
+    auto cache_info         = reinterpret_cast<PipelineCacheInfo*>(pPipelineCache->GetConsumerData(0));
+
+    if ((cache_info != nullptr) && (replay_create_info != nullptr))
+    {
+        cache_info->externally_synchronized =
+            ((replay_create_info->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT) != 0);
+    }
 
     if (options_.omit_pipeline_cache_data && (replay_create_info != nullptr))
     {
@@ -4479,6 +4768,190 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
     }
 }
 
+void VulkanReplayConsumerBase::OverrideDestroyPipelineCache(
+    PFN_vkDestroyPipelineCache                                 func,
+    const DeviceInfo*                                          device_info,
+    const PipelineCacheInfo*                                   pipeline_cache_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkDevice        device         = device_info->handle;
+    VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+
+    if (pipeline_cache_info != nullptr)
+    {
+        pipeline_cache = pipeline_cache_info->handle;
+    }
+
+    WaitPipelineCreation();
+
+    func(device, pipeline_cache, GetAllocationCallbacks(pAllocator));
+}
+
+VkResult
+VulkanReplayConsumerBase::OverrideMergePipelineCaches(PFN_vkMergePipelineCaches                    func,
+                                                      VkResult                                     original_result,
+                                                      const DeviceInfo*                            device_info,
+                                                      const PipelineCacheInfo*                     dst_cache_info,
+                                                      uint32_t                                     srcCacheCount,
+                                                      const HandlePointerDecoder<VkPipelineCache>* pSrcCaches)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (pSrcCaches != nullptr));
+
+    VkPipelineCache dst_cache = (dst_cache_info != nullptr) ? dst_cache_info->handle : VK_NULL_HANDLE;
+
+    // Include the data for pipelines that are being created on worker threads, which may also be using the caches.
+    WaitPipelineCreation();
+
+    return func(device_info->handle, dst_cache, srcCacheCount, pSrcCaches->GetHandlePointer());
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
+    PFN_vkCreateGraphicsPipelines                                     func,
+    VkResult                                                          original_result,
+    const DeviceInfo*                                                 device_info,
+    const PipelineCacheInfo*                                          pipeline_cache_info,
+    uint32_t                                                          createInfoCount,
+    const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                 pPipelines)
+{
+    assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr) &&
+           (pPipelines->GetHandlePointer() != nullptr));
+
+    VkDevice                            device         = device_info->handle;
+    VkPipelineCache                     pipeline_cache = VK_NULL_HANDLE;
+    const VkGraphicsPipelineCreateInfo* create_infos   = pCreateInfos->GetPointer();
+    const VkAllocationCallbacks*        allocator      = GetAllocationCallbacks(pAllocator);
+
+    if (pipeline_cache_info != nullptr)
+    {
+        pipeline_cache = pipeline_cache_info->handle;
+    }
+
+    if ((pipeline_creation_pool_ == nullptr) || IsPipelineCacheExternallySynchronized(pipeline_cache_info))
+    {
+        return func(device, pipeline_cache, createInfoCount, create_infos, allocator, pPipelines->GetHandlePointer());
+    }
+
+    CreatePipelinesAsync("vkCreateGraphicsPipelines",
+                         original_result,
+                         device_info->capture_id,
+                         createInfoCount,
+                         pPipelines,
+                         [=](VkPipeline* pipelines) {
+                             return func(device, pipeline_cache, createInfoCount, create_infos, allocator, pipelines);
+                         });
+
+    return original_result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
+    PFN_vkCreateComputePipelines                                     func,
+    VkResult                                                         original_result,
+    const DeviceInfo*                                                device_info,
+    const PipelineCacheInfo*                                         pipeline_cache_info,
+    uint32_t                                                         createInfoCount,
+    const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                pPipelines)
+{
+    assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr) &&
+           (pPipelines->GetHandlePointer() != nullptr));
+
+    VkDevice                           device         = device_info->handle;
+    VkPipelineCache                    pipeline_cache = VK_NULL_HANDLE;
+    const VkComputePipelineCreateInfo* create_infos   = pCreateInfos->GetPointer();
+    const VkAllocationCallbacks*       allocator      = GetAllocationCallbacks(pAllocator);
+
+    if (pipeline_cache_info != nullptr)
+    {
+        pipeline_cache = pipeline_cache_info->handle;
+    }
+
+    if ((pipeline_creation_pool_ == nullptr) || IsPipelineCacheExternallySynchronized(pipeline_cache_info))
+    {
+        return func(device, pipeline_cache, createInfoCount, create_infos, allocator, pPipelines->GetHandlePointer());
+    }
+
+    CreatePipelinesAsync("vkCreateComputePipelines",
+                         original_result,
+                         device_info->capture_id,
+                         createInfoCount,
+                         pPipelines,
+                         [=](VkPipeline* pipelines) {
+                             return func(device, pipeline_cache, createInfoCount, create_infos, allocator, pipelines);
+                         });
+
+    return original_result;
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyShaderModule(
+    PFN_vkDestroyShaderModule                                  func,
+    const DeviceInfo*                                          device_info,
+    const ShaderModuleInfo*                                    shader_module_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkDevice       device        = device_info->handle;
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+
+    if (shader_module_info != nullptr)
+    {
+        shader_module = shader_module_info->handle;
+    }
+
+    WaitPipelineCreation();
+
+    func(device, shader_module, GetAllocationCallbacks(pAllocator));
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyPipelineLayout(
+    PFN_vkDestroyPipelineLayout                                func,
+    const DeviceInfo*                                          device_info,
+    const PipelineLayoutInfo*                                  pipeline_layout_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkDevice         device          = device_info->handle;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+
+    if (pipeline_layout_info != nullptr)
+    {
+        pipeline_layout = pipeline_layout_info->handle;
+    }
+
+    WaitPipelineCreation();
+
+    func(device, pipeline_layout, GetAllocationCallbacks(pAllocator));
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyRenderPass(
+    PFN_vkDestroyRenderPass                                    func,
+    const DeviceInfo*                                          device_info,
+    const RenderPassInfo*                                      render_pass_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkDevice     device      = device_info->handle;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+
+    if (render_pass_info != nullptr)
+    {
+        render_pass = render_pass_info->handle;
+    }
+
+    WaitPipelineCreation();
+
+    func(device, render_pass, GetAllocationCallbacks(pAllocator));
+}
+
 VkResult VulkanReplayConsumerBase::OverrideResetDescriptorPool(PFN_vkResetDescriptorPool  func,
                                                                VkResult                   original_result,
                                                                const DeviceInfo*          device_info,
@@ -5024,14 +5497,7 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
     std::vector<VkPresentTimeGOOGLE>  modified_times;
     std::vector<const SemaphoreInfo*> removed_semaphores;
     std::unordered_set<uint32_t>      removed_swapchain_indices;
-
-    if ((screenshot_handler_ != nullptr) && (screenshot_handler_->IsScreenshotFrame()))
-    {
-        auto meta_info = pPresentInfo->GetMetaStructPointer();
-        assert((meta_info != nullptr) && !meta_info->pSwapchains.IsNull());
-
-        WriteScreenshots(meta_info);
-    }
+    std::vector<VkSemaphore>          semaphore_memory;
 
     // If rendering is restricted to a specific surface, need to check for dummy swapchains at present.
     if (options_.surface_index != -1)
@@ -5168,12 +5634,7 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         modified_present_info.pImageIndices = modified_image_indices.data();
     }
 
-    // Only attempt to find imported or shadow semaphores if we know at least one around.
-    if ((!have_imported_semaphores_) && (shadow_semaphores_.empty()) && (modified_present_info.swapchainCount != 0))
-    {
-        result = func(queue_info->handle, &modified_present_info);
-    }
-    else if (modified_present_info.swapchainCount == 0)
+    if (modified_present_info.swapchainCount == 0)
     {
         // No need to progress farther if there is no valid swapchain to present.
         dispatched_command = false;
@@ -5182,23 +5643,19 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         // here.
         GetShadowSemaphores(present_info_data->pWaitSemaphores, &removed_semaphores);
     }
-    else
+    else if (have_imported_semaphores_ || !shadow_semaphores_.empty())
     {
-        // Check for imported semaphores in the present info, creating a vector of imported semaphore info structures.
+        // Only attempt to find imported or shadow semaphores if we know at least one around.  Check for imported
+        // semaphores in the present info, creating a vector of imported semaphore info structures.
         if (present_info_data != nullptr)
         {
             GetImportedSemaphores(present_info_data->pWaitSemaphores, &removed_semaphores);
             GetShadowSemaphores(present_info_data->pWaitSemaphores, &removed_semaphores);
         }
 
-        if (removed_semaphores.empty())
-        {
-            result = func(queue_info->handle, &modified_present_info);
-        }
-        else
+        if (!removed_semaphores.empty())
         {
-            std::vector<VkSemaphore> semaphore_memory;
-            auto                     semaphore_iter = removed_semaphores.begin();
+            auto semaphore_iter = removed_semaphores.begin();
 
             for (uint32_t i = 0; i < modified_present_info.waitSemaphoreCount; ++i)
             {
@@ -5217,11 +5674,33 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
 
             modified_present_info.waitSemaphoreCount = static_cast<uint32_t>(semaphore_memory.size());
             modified_present_info.pWaitSemaphores    = semaphore_memory.data();
+        }
+    }
+
+    if ((screenshot_handler_ != nullptr) && (screenshot_handler_->IsScreenshotFrame()))
+    {
+        auto meta_info = pPresentInfo->GetMetaStructPointer();
+        assert((meta_info != nullptr) && !meta_info->pSwapchains.IsNull());
 
-            result = func(queue_info->handle, &modified_present_info);
+        // The screenshot copy waits on the semaphores that the present will wait on, after the semaphores that are
+        // never signaled during replay have been removed.  When the present is skipped, the copy waits for the device
+        // to become idle instead.
+        if (dispatched_command)
+        {
+            WriteScreenshots(
+                meta_info, queue_info, modified_present_info.waitSemaphoreCount, modified_present_info.pWaitSemaphores);
+        }
+        else
+        {
+            WriteScreenshots(meta_info, queue_info, 0, nullptr);
         }
     }
 
+    if (dispatched_command)
+    {
+        result = func(queue_info->handle, &modified_present_info);
+    }
+
     // If running with surface-index on, need to track forward progress of semaphore that have been submitted
     if (options_.surface_index != -1)
     {
@@ -5253,6 +5732,11 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         screenshot_handler_->EndFrame();
     }
 
+    if (frame_statistics_ != nullptr)
+    {
+        frame_statistics_->EndFrame();
+    }
+
     return result;
 }
 
@@ -6091,6 +6575,8 @@ void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(const A
                                                                          format::HandleId   descriptorUpdateTemplate,
                                                                          DescriptorUpdateTemplateDecoder* pData)
 {
+    BeginProfiledCall("vkUpdateDescriptorSetWithTemplate");
+
     assert(pData != nullptr);
 
     VkDevice        in_device = MapHandle<DeviceInfo>(device, &VulkanObjectInfoTable::GetDeviceInfo);
@@ -6106,8 +6592,10 @@ void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(const A
         in_descriptorUpdateTemplate = update_template_info->handle;
     }
 
+    BeginProfiledDriverCall();
     GetDeviceTable(in_device)->UpdateDescriptorSetWithTemplate(
         in_device, in_descriptorSet, in_descriptorUpdateTemplate, pData->GetPointer());
+    EndProfiledDriverCall();
 }
 
 void VulkanReplayConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(const ApiCallInfo& call_info,
@@ -6117,6 +6605,8 @@ void VulkanReplayConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(con
                                                                              uint32_t         set,
                                                                              DescriptorUpdateTemplateDecoder* pData)
 {
+    BeginProfiledCall("vkCmdPushDescriptorSetWithTemplateKHR");
+
     assert(pData != nullptr);
 
     VkCommandBuffer in_commandBuffer =
@@ -6132,9 +6622,11 @@ void VulkanReplayConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(con
         in_descriptorUpdateTemplate = update_template_info->handle;
     }
 
+    BeginProfiledDriverCall();
     GetDeviceTable(in_commandBuffer)
         ->CmdPushDescriptorSetWithTemplateKHR(
             in_commandBuffer, in_descriptorUpdateTemplate, in_layout, set, pData->GetPointer());
+    EndProfiledDriverCall();
 }
 
 void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(const ApiCallInfo& call_info,
@@ -6143,6 +6635,8 @@ void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(cons
                                                                             format::HandleId   descriptorUpdateTemplate,
                                                                             DescriptorUpdateTemplateDecoder* pData)
 {
+    BeginProfiledCall("vkUpdateDescriptorSetWithTemplateKHR");
+
     assert(pData != nullptr);
 
     VkDevice        in_device = MapHandle<DeviceInfo>(device, &VulkanObjectInfoTable::GetDeviceInfo);
@@ -6158,8 +6652,10 @@ void VulkanReplayConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(cons
         in_descriptorUpdateTemplate = update_template_info->handle;
     }
 
+    BeginProfiledDriverCall();
     GetDeviceTable(in_device)->UpdateDescriptorSetWithTemplateKHR(
         in_device, in_descriptorSet, in_descriptorUpdateTemplate, pData->GetPointer());
+    EndProfiledDriverCall();
 }
 
 GFXRECON_END_NAMESPACE(decode)
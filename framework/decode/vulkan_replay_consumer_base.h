@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_REPLAY_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_REPLAY_CONSUMER_BASE_H
 
+#include "decode/api_call_profiler.h"
 #include "decode/handle_pointer_decoder.h"
 #include "decode/pointer_decoder.h"
 #include "decode/screenshot_handler.h"
@@ -43,6 +44,8 @@
 #include "graphics/fps_info.h"
 #include "util/defines.h"
 #include "util/logging.h"
+#include "util/monotonic_allocator.h"
+#include "util/thread_pool.h"
 
 #include "application/application.h"
 
@@ -51,6 +54,7 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -74,7 +78,21 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFatalErrorHandler(std::function<void(const char*)> handler) { fatal_error_handler_ = handler; }
 
-    void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
+    void SetFpsInfo(graphics::FpsInfo* fps_info)
+    {
+        fps_info_         = fps_info;
+        frame_statistics_ = ((fps_info != nullptr) && fps_info->IsRecordingFrameStatistics()) ? fps_info : nullptr;
+    }
+
+    void SetApiCallProfiler(ApiCallProfiler* profiler) { profiler_ = profiler; }
+
+    // Records the objects that exist before the first replay of a looped frame range.
+    void BeginLoopRangeObjectCheck();
+
+    // Returns false and logs a warning if the first replay of a looped frame range created objects that it did not
+    // destroy.  Each additional replay of the range would create these objects again, so the range is not a
+    // steady-state section of the capture and must not be looped.
+    bool EndLoopRangeObjectCheck();
 
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
 
@@ -190,6 +208,57 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void CheckResult(const char* func_name, VkResult original, VkResult replay);
 
+    void BeginProfiledCall(const char* func_name)
+    {
+        if (profiler_ != nullptr)
+        {
+            profiler_->BeginConsumerCall(func_name);
+        }
+    }
+
+    void BeginProfiledDriverCall()
+    {
+        if (profiler_ != nullptr)
+        {
+            profiler_->BeginDriverCall();
+        }
+
+        if (frame_statistics_ != nullptr)
+        {
+            frame_statistics_->BeginDriverCall();
+        }
+    }
+
+    void EndProfiledDriverCall()
+    {
+        if (frame_statistics_ != nullptr)
+        {
+            frame_statistics_->EndDriverCall();
+        }
+
+        if (profiler_ != nullptr)
+        {
+            profiler_->EndDriverCall();
+        }
+    }
+
+    // Marks driver calls that block until GPU work has completed, for the per-frame statistics.
+    void BeginProfiledWait()
+    {
+        if (frame_statistics_ != nullptr)
+        {
+            frame_statistics_->BeginWait();
+        }
+    }
+
+    void EndProfiledWait()
+    {
+        if (frame_statistics_ != nullptr)
+        {
+            frame_statistics_->EndWait();
+        }
+    }
+
     template <typename T>
     typename T::HandleType MapHandle(format::HandleId id,
                                      const T* (VulkanObjectInfoTable::*MapFunc)(format::HandleId) const) const
@@ -497,6 +566,17 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          VkDeviceSize              stride,
                                          VkQueryResultFlags        flags);
 
+    void OverrideGetDeviceQueue(PFN_vkGetDeviceQueue           func,
+                                const DeviceInfo*              device_info,
+                                uint32_t                       queueFamilyIndex,
+                                uint32_t                       queueIndex,
+                                HandlePointerDecoder<VkQueue>* pQueue);
+
+    void OverrideGetDeviceQueue2(PFN_vkGetDeviceQueue2                                   func,
+                                 const DeviceInfo*                                       device_info,
+                                 const StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+                                 HandlePointerDecoder<VkQueue>*                          pQueue);
+
     VkResult OverrideQueueSubmit(PFN_vkQueueSubmit                                 func,
                                  VkResult                                          original_result,
                                  const QueueInfo*                                  queue_info,
@@ -663,6 +743,53 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          const StructPointerDecoder<Decoded_VkAllocationCallbacks>*     pAllocator,
                                          HandlePointerDecoder<VkPipelineCache>*                         pPipelineCache);
 
+    void OverrideDestroyPipelineCache(PFN_vkDestroyPipelineCache                                 func,
+                                      const DeviceInfo*                                          device_info,
+                                      const PipelineCacheInfo*                                   pipeline_cache_info,
+                                      const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    VkResult OverrideMergePipelineCaches(PFN_vkMergePipelineCaches                    func,
+                                         VkResult                                     original_result,
+                                         const DeviceInfo*                            device_info,
+                                         const PipelineCacheInfo*                     dst_cache_info,
+                                         uint32_t                                     srcCacheCount,
+                                         const HandlePointerDecoder<VkPipelineCache>* pSrcCaches);
+
+    VkResult OverrideCreateGraphicsPipelines(
+        PFN_vkCreateGraphicsPipelines                                     func,
+        VkResult                                                          original_result,
+        const DeviceInfo*                                                 device_info,
+        const PipelineCacheInfo*                                          pipeline_cache_info,
+        uint32_t                                                          createInfoCount,
+        const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                 pPipelines);
+
+    VkResult OverrideCreateComputePipelines(
+        PFN_vkCreateComputePipelines                                     func,
+        VkResult                                                         original_result,
+        const DeviceInfo*                                                device_info,
+        const PipelineCacheInfo*                                         pipeline_cache_info,
+        uint32_t                                                         createInfoCount,
+        const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                pPipelines);
+
+    void OverrideDestroyShaderModule(PFN_vkDestroyShaderModule                                  func,
+                                     const DeviceInfo*                                          device_info,
+                                     const ShaderModuleInfo*                                    shader_module_info,
+                                     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    void OverrideDestroyPipelineLayout(PFN_vkDestroyPipelineLayout                                func,
+                                       const DeviceInfo*                                          device_info,
+                                       const PipelineLayoutInfo*                                  pipeline_layout_info,
+                                       const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    void OverrideDestroyRenderPass(PFN_vkDestroyRenderPass                                    func,
+                                   const DeviceInfo*                                          device_info,
+                                   const RenderPassInfo*                                      render_pass_info,
+                                   const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
     VkResult OverrideResetDescriptorPool(PFN_vkResetDescriptorPool  func,
                                          VkResult                   original_result,
                                          const DeviceInfo*          device_info,
@@ -960,7 +1087,33 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void InitializeScreenshotHandler();
 
-    void WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const;
+    // Loads the shader manifest from the shader replacement directory, if the directory contains one.
+    void LoadShaderManifest();
+
+    void WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info,
+                          const QueueInfo*                queue_info,
+                          uint32_t                        wait_semaphore_count,
+                          const VkSemaphore*              wait_semaphores) const;
+
+    // Submits a pipeline creation call to a worker thread.  Infos for the pipelines are added to the object info table
+    // immediately, and lookups of the pipelines wait for the creation to complete.  The decoded parameters for the
+    // current API call are kept alive until the creation has completed.
+    void CreatePipelinesAsync(const char*                          func_name,
+                              VkResult                             original_result,
+                              format::HandleId                     device_id,
+                              uint32_t                             pipeline_count,
+                              HandlePointerDecoder<VkPipeline>*    pPipelines,
+                              std::function<VkResult(VkPipeline*)> create_func);
+
+    // Returns true if the pipeline cache must not be used by concurrent pipeline creation calls, after waiting for the
+    // pending creation calls to complete.
+    bool IsPipelineCacheExternallySynchronized(const PipelineCacheInfo* pipeline_cache_info);
+
+    // Waits for all pipeline creation calls that were submitted to worker threads, which must be done before destroying
+    // any object that a pending pipeline creation call may reference.
+    void WaitPipelineCreation();
+
+    void ReleaseCompletedPipelineCreationData();
 
   private:
     typedef std::unordered_set<Window*> ActiveWindows;
@@ -990,6 +1143,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     typedef std::unordered_map<uint64_t, HardwareBufferInfo>               HardwareBufferMap;
     typedef std::unordered_map<format::HandleId, HardwareBufferMemoryInfo> HardwareBufferMemoryMap;
 
+    struct PendingPipelineCreation
+    {
+        std::shared_future<void>                  completion;
+        std::unique_ptr<util::MonotonicAllocator> decode_allocations;
+    };
+
   private:
     util::platform::LibraryHandle                                    loader_handle_;
     PFN_vkGetInstanceProcAddr                                        get_instance_proc_addr_;
@@ -1012,6 +1171,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     std::string                                                      screenshot_file_prefix_;
     int32_t                                                          create_surface_count_;
     graphics::FpsInfo*                                               fps_info_;
+    graphics::FpsInfo*                                               frame_statistics_;
+    ApiCallProfiler*                                                 profiler_;
+    std::unique_ptr<util::ThreadPool>                                pipeline_creation_pool_;
+    std::vector<PendingPipelineCreation>                             pending_pipeline_creations_;
+    std::unordered_map<format::HandleId, std::string>                shader_manifest_; // Replacement shader file names.
+    std::unordered_set<format::HandleId>                             loop_range_object_ids_;
 
     // Used to track if any shadow sync objects are active to avoid checking if not needed
     std::unordered_set<VkSemaphore> shadow_semaphores_;
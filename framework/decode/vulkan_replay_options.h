@@ -41,6 +41,9 @@ typedef std::function<VulkanResourceAllocator*()> CreateResourceAllocator;
 // Default log level to use prior to loading settings.
 const util::Log::Severity kDefaultLogLevel = util::Log::Severity::kInfoSeverity;
 
+// Name of the file in the shader replacement directory that maps shader module handle IDs to shader file names.
+static constexpr char kShaderManifestFileName[] = "shaders.manifest";
+
 struct VulkanReplayOptions : public ReplayOptions
 {
     bool                         enable_vulkan{ true };
@@ -54,6 +57,8 @@ struct VulkanReplayOptions : public ReplayOptions
     std::vector<ScreenshotRange> screenshot_ranges;
     std::string                  screenshot_dir;
     std::string                  screenshot_file_prefix{ kDefaultScreenshotFilePrefix };
+    bool                         screenshot_async{ false };
+    bool                         async_pipeline_creation{ false };
     std::string                  replace_dir;
 };
 
@@ -23,6 +23,7 @@
 #include "decode/vulkan_resource_initializer.h"
 
 #include "decode/copy_shaders.h"
+#include "util/logging.h"
 #include "util/platform.h"
 
 #include <algorithm>
@@ -32,6 +33,13 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Size of the staging buffer for each batch.  Resources with more data are uploaded individually.
+const VkDeviceSize kStagingBatchSize = 32 * 1024 * 1024;
+
+// Data is written to a staging batch at offsets that are multiples of 4 and of every texel block size (1, 2, 3, 4, 6,
+// 8, 12, 16, 24, and 32 bytes), as required by buffer to image copies.
+const VkDeviceSize kStagingBatchAlignment = 768;
+
 VulkanResourceInitializer::VulkanResourceInitializer(VkDevice                                device,
                                                      VkDeviceSize                            max_copy_size,
                                                      const VkPhysicalDeviceMemoryProperties& memory_properties,
@@ -42,7 +50,7 @@ VulkanResourceInitializer::VulkanResourceInitializer(VkDevice
     staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
     draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
     draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
-    resource_allocator_(resource_allocator), device_table_(device_table)
+    resource_allocator_(resource_allocator), device_table_(device_table), current_batch_(0), batching_disabled_(false)
 {
     assert((device != VK_NULL_HANDLE) && (memory_properties.memoryTypeCount > 0) &&
            (memory_properties.memoryHeapCount > 0) && (resource_allocator != nullptr) && (device_table != nullptr));
@@ -59,8 +67,16 @@ VulkanResourceInitializer::VulkanResourceInitializer(VkDevice
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    Flush();
+    DestroyStagingBatches();
+
     for (const auto& entry : command_exec_objects_)
     {
+        for (uint32_t i = 0; i < kStagingBatchCount; ++i)
+        {
+            device_table_->DestroyFence(device_, entry.second.batch_fences[i], nullptr);
+        }
+
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
     }
 
@@ -108,33 +124,68 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkResult     result         = VK_SUCCESS;
+    VkDeviceSize staging_offset = 0;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    if (AcquireBatchStagingSpace(data_size, &staging_offset) == VK_SUCCESS)
+    {
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    if (result == VK_SUCCESS)
+        result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            const StagingBatch& batch = staging_batches_[current_batch_];
+
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(batch.mapped_data + staging_offset, copy_size, data, copy_size);
+
+            std::vector<VkBufferCopy> batch_regions(regions, regions + region_count);
+            for (auto& region : batch_regions)
+            {
+                region.srcOffset += staging_offset;
+            }
+
+            device_table_->CmdCopyBuffer(command_buffer, batch.buffer, buffer, region_count, batch_regions.data());
+        }
+    }
+    else
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        // The data does not fit in a staging batch, and is uploaded individually after the pending batches complete.
+        result = Flush();
+
+        VkQueue                               queue               = VK_NULL_HANDLE;
+        VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        if (result == VK_SUCCESS)
+        {
+            result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+        }
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
 
             if (result == VK_SUCCESS)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
+                result = BeginCommandBuffer(command_buffer);
 
-                result = ExecuteCommandBuffer(queue, command_buffer);
-            }
+                if (result == VK_SUCCESS)
+                {
+                    device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
+                    device_table_->EndCommandBuffer(command_buffer);
 
-            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+                    result = ExecuteCommandBuffer(queue, command_buffer);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            }
         }
     }
 
@@ -157,65 +208,110 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                                     uint32_t                 level_count,
                                                     const VkBufferImageCopy* level_copies)
 {
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
-
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
-
-    if (result == VK_SUCCESS)
+    bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                        (sample_count == VK_SAMPLE_COUNT_1_BIT);
+    bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                           (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+    bool use_depth_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+    bool use_stencil_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+    bool use_draw =
+        !use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D);
+
+    VkResult     result         = VK_SUCCESS;
+    VkDeviceSize staging_offset = 0;
+
+    if (!use_draw && (AcquireBatchStagingSpace(data_size, &staging_offset) == VK_SUCCESS))
     {
-        result = LoadData(data_size, data, staging_buffer_data);
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+
+        result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
+            const StagingBatch& batch = staging_batches_[current_batch_];
+
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(batch.mapped_data + staging_offset, copy_size, data, copy_size);
+
+            std::vector<VkBufferImageCopy> batch_copies(level_copies, level_copies + level_count);
+            for (auto& copy : batch_copies)
             {
-                result = PixelShaderImageCopy(queue_family_index,
-                                              staging_buffer,
-                                              image,
-                                              type,
-                                              format,
-                                              extent,
-                                              aspect,
-                                              sample_count,
-                                              initial_layout,
-                                              final_layout,
-                                              layer_count,
-                                              level_count,
-                                              level_copies);
+                copy.bufferOffset += staging_offset;
             }
-            else
+
+            RecordBufferToImageCopy(command_buffer,
+                                    batch.buffer,
+                                    image,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    batch_copies.data());
+        }
+    }
+    else
+    {
+        // Images that are initialized with a draw, or that do not fit in a staging batch, are uploaded individually
+        // after the pending batches complete.
+        result = Flush();
+
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = LoadData(data_size, data, staging_buffer_data);
+
+            if (result == VK_SUCCESS)
             {
-                result = BufferToImageCopy(queue_family_index,
-                                           staging_buffer,
-                                           image,
-                                           format,
-                                           aspect,
-                                           initial_layout,
-                                           final_layout,
-                                           layer_count,
-                                           level_count,
-                                           level_copies);
+                if (use_draw)
+                {
+                    result = PixelShaderImageCopy(queue_family_index,
+                                                  staging_buffer,
+                                                  image,
+                                                  type,
+                                                  format,
+                                                  extent,
+                                                  aspect,
+                                                  sample_count,
+                                                  initial_layout,
+                                                  final_layout,
+                                                  layer_count,
+                                                  level_count,
+                                                  level_copies);
+                }
+                else
+                {
+                    result = BufferToImageCopy(queue_family_index,
+                                               staging_buffer,
+                                               image,
+                                               format,
+                                               aspect,
+                                               initial_layout,
+                                               final_layout,
+                                               layer_count,
+                                               level_count,
+                                               level_copies);
+                }
             }
-        }
 
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+        }
     }
 
     return result;
@@ -230,50 +326,14 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
                                                     uint32_t              layer_count,
                                                     uint32_t              level_count)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
     if (result == VK_SUCCESS)
     {
-        result = BeginCommandBuffer(command_buffer);
-
-        if (result == VK_SUCCESS)
-        {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
-
-            device_table_->EndCommandBuffer(command_buffer);
-
-            result = ExecuteCommandBuffer(queue, command_buffer);
-        }
+        RecordImageTransition(
+            command_buffer, image, format, aspect, initial_layout, final_layout, layer_count, level_count);
     }
 
     return result;
@@ -306,23 +366,48 @@ VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue
 
         if (result == VK_SUCCESS)
         {
+            CommandExecObjects objects;
+            objects.command_pool = command_pool;
+
+            // One command buffer for resources that are uploaded individually, and one for each staging batch.
+            VkCommandBuffer command_buffers[kStagingBatchCount + 1];
+
             VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
             alloc_info.pNext                       = nullptr;
             alloc_info.commandPool                 = command_pool;
             alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-            alloc_info.commandBufferCount          = 1;
+            alloc_info.commandBufferCount          = kStagingBatchCount + 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &alloc_info, command_buffers);
+
+            VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_info.pNext             = nullptr;
+            fence_info.flags             = 0;
 
-            result = device_table_->AllocateCommandBuffers(device_, &alloc_info, command_buffer);
+            for (uint32_t i = 0; (i < kStagingBatchCount) && (result == VK_SUCCESS); ++i)
+            {
+                objects.batch_command_buffers[i] = command_buffers[i + 1];
+                result = device_table_->CreateFence(device_, &fence_info, nullptr, &objects.batch_fences[i]);
+            }
 
             if (result == VK_SUCCESS)
             {
                 device_table_->GetDeviceQueue(device_, queue_family_index, 0, queue);
 
-                command_exec_objects_.emplace(queue_family_index,
-                                              CommandExecObjects{ *queue, command_pool, *command_buffer });
+                objects.queue          = *queue;
+                objects.command_buffer = command_buffers[0];
+
+                (*command_buffer) = objects.command_buffer;
+
+                command_exec_objects_.emplace(queue_family_index, objects);
             }
             else
             {
+                for (uint32_t i = 0; i < kStagingBatchCount; ++i)
+                {
+                    device_table_->DestroyFence(device_, objects.batch_fences[i], nullptr);
+                }
+
                 device_table_->DestroyCommandPool(device_, command_pool, nullptr);
             }
         }
@@ -331,6 +416,294 @@ VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue
     return result;
 }
 
+VkResult VulkanResourceInitializer::CreateStagingBatches()
+{
+    VkResult result = VK_SUCCESS;
+
+    for (uint32_t i = 0; (i < kStagingBatchCount) && (result == VK_SUCCESS); ++i)
+    {
+        StagingBatch& batch = staging_batches_[i];
+
+        VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+        create_info.pNext                 = nullptr;
+        create_info.flags                 = 0;
+        create_info.size                  = kStagingBatchSize;
+        create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+        create_info.queueFamilyIndexCount = 0;
+        create_info.pQueueFamilyIndices   = nullptr;
+
+        result = resource_allocator_->CreateBufferDirect(&create_info, nullptr, &batch.buffer, &batch.buffer_data);
+
+        if (result == VK_SUCCESS)
+        {
+            VkMemoryRequirements memory_requirements;
+            device_table_->GetBufferMemoryRequirements(device_, batch.buffer, &memory_requirements);
+
+            // Coherent memory is preferred, as it does not need to be flushed before each batch is submitted.
+            uint32_t memory_type_index = GetMemoryTypeIndex(
+                memory_requirements.memoryTypeBits,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            batch.is_coherent = true;
+
+            if (memory_type_index == std::numeric_limits<uint32_t>::max())
+            {
+                memory_type_index =
+                    GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+                batch.is_coherent = false;
+            }
+
+            if (memory_type_index != std::numeric_limits<uint32_t>::max())
+            {
+                VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+                alloc_info.pNext                = nullptr;
+                alloc_info.allocationSize       = memory_requirements.size;
+                alloc_info.memoryTypeIndex      = memory_type_index;
+
+                result = resource_allocator_->AllocateMemoryDirect(
+                    &alloc_info, nullptr, &batch.memory, &batch.memory_data);
+            }
+            else
+            {
+                result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkMemoryPropertyFlags property_flags = 0;
+            result                               = resource_allocator_->BindBufferMemoryDirect(
+                batch.buffer, batch.memory, 0, batch.buffer_data, batch.memory_data, &property_flags);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            void* mapped_data = nullptr;
+            result =
+                resource_allocator_->MapResourceMemoryDirect(kStagingBatchSize, 0, &mapped_data, batch.buffer_data);
+            batch.mapped_data = reinterpret_cast<uint8_t*>(mapped_data);
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        DestroyStagingBatches();
+    }
+
+    return result;
+}
+
+void VulkanResourceInitializer::DestroyStagingBatches()
+{
+    for (uint32_t i = 0; i < kStagingBatchCount; ++i)
+    {
+        StagingBatch& batch = staging_batches_[i];
+
+        if (batch.mapped_data != nullptr)
+        {
+            resource_allocator_->UnmapResourceMemoryDirect(batch.buffer_data);
+        }
+
+        if (batch.buffer != VK_NULL_HANDLE)
+        {
+            resource_allocator_->DestroyBufferDirect(batch.buffer, nullptr, batch.buffer_data);
+        }
+
+        if (batch.memory != VK_NULL_HANDLE)
+        {
+            resource_allocator_->FreeMemoryDirect(batch.memory, nullptr, batch.memory_data);
+        }
+
+        batch = StagingBatch();
+    }
+}
+
+VkResult VulkanResourceInitializer::AcquireBatchStagingSpace(VkDeviceSize data_size, VkDeviceSize* offset)
+{
+    assert(offset != nullptr);
+
+    if (batching_disabled_ || (data_size > kStagingBatchSize))
+    {
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    VkResult result = VK_SUCCESS;
+
+    if (staging_batches_[current_batch_].buffer == VK_NULL_HANDLE)
+    {
+        result = CreateStagingBatches();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to create staging buffers for batched resource initialization; resources will "
+                                 "be uploaded individually");
+            batching_disabled_ = true;
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkDeviceSize batch_offset = ((staging_batches_[current_batch_].offset + kStagingBatchAlignment - 1) /
+                                     kStagingBatchAlignment) *
+                                    kStagingBatchAlignment;
+
+        if ((batch_offset + data_size) > kStagingBatchSize)
+        {
+            // Submit the full batch and switch to the next batch, which can be reused once the copies that were
+            // previously submitted from it have completed.
+            result         = SubmitBatch(current_batch_);
+            current_batch_ = (current_batch_ + 1) % kStagingBatchCount;
+
+            if (result == VK_SUCCESS)
+            {
+                result = WaitBatch(current_batch_);
+            }
+
+            batch_offset = 0;
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            (*offset)                               = batch_offset;
+            staging_batches_[current_batch_].offset = batch_offset + data_size;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer)
+{
+    assert(command_buffer != nullptr);
+
+    VkQueue         queue                     = VK_NULL_HANDLE;
+    VkCommandBuffer individual_command_buffer = VK_NULL_HANDLE;
+
+    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &individual_command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        CommandExecObjects& objects = command_exec_objects_[queue_family_index];
+
+        if (!objects.batch_recording[current_batch_])
+        {
+            result = BeginCommandBuffer(objects.batch_command_buffers[current_batch_]);
+
+            if (result == VK_SUCCESS)
+            {
+                objects.batch_recording[current_batch_] = true;
+            }
+        }
+
+        (*command_buffer) = objects.batch_command_buffers[current_batch_];
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitBatch(uint32_t batch_index)
+{
+    VkResult      result = VK_SUCCESS;
+    StagingBatch& batch  = staging_batches_[batch_index];
+
+    if (!batch.is_coherent && (batch.offset > 0))
+    {
+        VkMappedMemoryRange memory_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        memory_range.pNext               = nullptr;
+        memory_range.memory              = batch.memory;
+        memory_range.offset              = 0;
+        memory_range.size                = VK_WHOLE_SIZE;
+
+        result = resource_allocator_->FlushMappedMemoryRangesDirect(1, &memory_range, &batch.memory_data);
+    }
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& objects = entry.second;
+
+        if (objects.batch_recording[batch_index])
+        {
+            VkCommandBuffer command_buffer = objects.batch_command_buffers[batch_index];
+
+            device_table_->EndCommandBuffer(command_buffer);
+            objects.batch_recording[batch_index] = false;
+
+            VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submit_info.pNext                = nullptr;
+            submit_info.waitSemaphoreCount   = 0;
+            submit_info.pWaitSemaphores      = nullptr;
+            submit_info.pWaitDstStageMask    = nullptr;
+            submit_info.commandBufferCount   = 1;
+            submit_info.pCommandBuffers      = &command_buffer;
+            submit_info.signalSemaphoreCount = 0;
+            submit_info.pSignalSemaphores    = nullptr;
+
+            VkResult submit_result =
+                device_table_->QueueSubmit(objects.queue, 1, &submit_info, objects.batch_fences[batch_index]);
+
+            if (submit_result == VK_SUCCESS)
+            {
+                objects.batch_submitted[batch_index] = true;
+            }
+            else if (result == VK_SUCCESS)
+            {
+                result = submit_result;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::WaitBatch(uint32_t batch_index)
+{
+    VkResult result = VK_SUCCESS;
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& objects = entry.second;
+
+        if (objects.batch_submitted[batch_index])
+        {
+            VkResult wait_result = device_table_->WaitForFences(
+                device_, 1, &objects.batch_fences[batch_index], VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+            if (wait_result == VK_SUCCESS)
+            {
+                wait_result = device_table_->ResetFences(device_, 1, &objects.batch_fences[batch_index]);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                result = wait_result;
+            }
+
+            objects.batch_submitted[batch_index] = false;
+        }
+    }
+
+    staging_batches_[batch_index].offset = 0;
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::Flush()
+{
+    VkResult result = SubmitBatch(current_batch_);
+
+    for (uint32_t i = 0; i < kStagingBatchCount; ++i)
+    {
+        VkResult wait_result = WaitBatch(i);
+
+        if (result == VK_SUCCESS)
+        {
+            result = wait_result;
+        }
+    }
+
+    return result;
+}
+
 VkResult VulkanResourceInitializer::GetDrawDescriptorObjects(VkSampler*             sampler,
                                                              VkDescriptorSetLayout* set_layout,
                                                              VkDescriptorSet*       set)
@@ -1149,6 +1522,113 @@ uint32_t VulkanResourceInitializer::GetMemoryTypeIndex(uint32_t type_bits, VkMem
     return memory_type_index;
 }
 
+void VulkanResourceInitializer::RecordImageTransition(VkCommandBuffer       command_buffer,
+                                                      VkImage               image,
+                                                      VkFormat              format,
+                                                      VkImageAspectFlagBits aspect,
+                                                      VkImageLayout         initial_layout,
+                                                      VkImageLayout         final_layout,
+                                                      uint32_t              layer_count,
+                                                      uint32_t              level_count)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+    memory_barrier.dstAccessMask                   = 0;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = final_layout;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = image;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    // The barrier waits for all prior commands because a batch may contain earlier commands for the same image, such as
+    // the upload of the other aspect of a depth-stencil image.
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+}
+
+void VulkanResourceInitializer::RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                                        VkBuffer                 source,
+                                                        VkImage                  destination,
+                                                        VkFormat                 format,
+                                                        VkImageAspectFlagBits    aspect,
+                                                        VkImageLayout            initial_layout,
+                                                        VkImageLayout            final_layout,
+                                                        uint32_t                 layer_count,
+                                                        uint32_t                 level_count,
+                                                        const VkBufferImageCopy* level_copies)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+    memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = destination;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    // The barrier waits for all prior commands because a batch may contain earlier commands for the same image, such as
+    // the upload of the other aspect of a depth-stencil image.
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+
+    device_table_->CmdCopyBufferToImage(
+        command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+
+    if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+        (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+    {
+        memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask = 0;
+        memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        memory_barrier.newLayout     = final_layout;
+
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+    }
+}
+
 VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 queue_family_index,
                                                       VkBuffer                 source,
                                                       VkImage                  destination,
@@ -1167,62 +1647,20 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
 
     if (result == VK_SUCCESS)
     {
-        VkImageLayout      old_layout        = initial_layout;
-        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
         result = BeginCommandBuffer(command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = destination;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
-
-            device_table_->CmdCopyBufferToImage(
-                command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
-
-            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
-            {
-                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                memory_barrier.dstAccessMask = 0;
-                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                memory_barrier.newLayout     = final_layout;
-
-                device_table_->CmdPipelineBarrier(command_buffer,
-                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                  0,
-                                                  0,
-                                                  nullptr,
-                                                  0,
-                                                  nullptr,
-                                                  1,
-                                                  &memory_barrier);
-            }
+            RecordBufferToImageCopy(command_buffer,
+                                    source,
+                                    destination,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    level_copies);
 
             device_table_->EndCommandBuffer(command_buffer);
 
@@ -35,6 +35,11 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Uploads the resource content from a trimmed capture's state snapshot.  Buffer and image copies are recorded into
+// batches that share a persistently mapped staging buffer, and a batch is only submitted when its staging buffer is
+// full or Flush() is called.  Two batches are used, so that the next batch can be filled while the device processes
+// the copies from the previous batch.  Resources that do not fit in a staging batch, and images that are initialized
+// with a draw, are uploaded individually after the pending batches have completed.
 class VulkanResourceInitializer
 {
   public:
@@ -82,9 +87,74 @@ class VulkanResourceInitializer
                              uint32_t              layer_count,
                              uint32_t              level_count);
 
+    // Submits the pending batch of copies and waits for all batches to complete.
+    VkResult Flush();
+
+  private:
+    static const uint32_t kStagingBatchCount = 2;
+
+    struct CommandExecObjects
+    {
+        VkQueue         queue{ VK_NULL_HANDLE };
+        VkCommandPool   command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer command_buffer{ VK_NULL_HANDLE };
+        VkCommandBuffer batch_command_buffers[kStagingBatchCount]{};
+        VkFence         batch_fences[kStagingBatchCount]{};
+        bool            batch_recording[kStagingBatchCount]{};
+        bool            batch_submitted[kStagingBatchCount]{};
+    };
+
+    struct StagingBatch
+    {
+        VkDeviceMemory                        memory{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::MemoryData   memory_data{ 0 };
+        VkBuffer                              buffer{ VK_NULL_HANDLE };
+        VulkanResourceAllocator::ResourceData buffer_data{ 0 };
+        uint8_t*                              mapped_data{ nullptr };
+        VkDeviceSize                          offset{ 0 };
+        bool                                  is_coherent{ false };
+    };
+
+    // Map queue family index to command pool, command buffer, and queue objects for command processing.
+    typedef std::unordered_map<uint32_t, CommandExecObjects> CommandExecObjectMap;
+
   private:
     VkResult GetCommandExecObjects(uint32_t queue_family_index, VkQueue* queue, VkCommandBuffer* command_buffer);
 
+    VkResult CreateStagingBatches();
+
+    void DestroyStagingBatches();
+
+    // Reserves space for data_size bytes in the current staging batch, submitting the batch and switching to the next
+    // batch when the current batch is full.  Fails when the data is too large for a staging batch.
+    VkResult AcquireBatchStagingSpace(VkDeviceSize data_size, VkDeviceSize* offset);
+
+    VkResult GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
+    VkResult SubmitBatch(uint32_t batch_index);
+
+    VkResult WaitBatch(uint32_t batch_index);
+
+    void RecordImageTransition(VkCommandBuffer       command_buffer,
+                               VkImage               image,
+                               VkFormat              format,
+                               VkImageAspectFlagBits aspect,
+                               VkImageLayout         initial_layout,
+                               VkImageLayout         final_layout,
+                               uint32_t              layer_count,
+                               uint32_t              level_count);
+
+    void RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                 VkBuffer                 source,
+                                 VkImage                  destination,
+                                 VkFormat                 format,
+                                 VkImageAspectFlagBits    aspect,
+                                 VkImageLayout            initial_layout,
+                                 VkImageLayout            final_layout,
+                                 uint32_t                 layer_count,
+                                 uint32_t                 level_count,
+                                 const VkBufferImageCopy* level_copies);
+
     VkResult GetDrawDescriptorObjects(VkSampler* sampler, VkDescriptorSetLayout* set_layout, VkDescriptorSet* set);
 
     VkResult CreateDrawObjects(VkFormat              format,
@@ -174,17 +244,6 @@ class VulkanResourceInitializer
                                   uint32_t                 level_count,
                                   const VkBufferImageCopy* level_copies);
 
-  private:
-    struct CommandExecObjects
-    {
-        VkQueue         queue;
-        VkCommandPool   command_pool;
-        VkCommandBuffer command_buffer;
-    };
-
-    // Map queue family index to command pool, command buffer, and queue objects for command processing.
-    typedef std::unordered_map<uint32_t, CommandExecObjects> CommandExecObjectMap;
-
   private:
     VkDevice                              device_;
     CommandExecObjectMap                  command_exec_objects_;
@@ -201,6 +260,9 @@ class VulkanResourceInitializer
     bool                                  have_shader_stencil_write_;
     VulkanResourceAllocator*              resource_allocator_;
     const encode::DeviceTable*            device_table_;
+    StagingBatch                          staging_batches_[kStagingBatchCount];
+    uint32_t                              current_batch_;
+    bool                                  batching_disabled_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
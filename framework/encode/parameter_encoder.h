@@ -144,6 +144,20 @@ class ParameterEncoder
 
     // clang-format on
 
+    // Structs with a fixed memory layout contain only scalar values, with no padding, and have an encoded representation
+    // that matches their in-memory representation.
+    template <typename T>
+    void EncodeFixedLayoutStruct(const T& value)
+    {
+        output_stream_->Write(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void EncodeFixedLayoutStructArray(const T* value, size_t len)
+    {
+        output_stream_->Write(value, len * sizeof(T));
+    }
+
     void EncodeStructPtrPreamble(const void* ptr, bool omit_data = false, bool omit_addr = false)
     {
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsSingle |
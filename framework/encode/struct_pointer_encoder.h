@@ -44,6 +44,8 @@ void EncodeStructPtr(ParameterEncoder* encoder, const T* value, bool omit_data =
     }
 }
 
+// Structs with a fixed memory layout have generated EncodeStructArray() overloads that write the array with a single
+// copy, which are preferred over this template.
 template <typename T>
 void EncodeStructArray(
     ParameterEncoder* encoder, const T* value, size_t len, bool omit_data = false, bool omit_addr = false)
@@ -183,22 +183,21 @@ class VulkanCaptureManager : public CaptureManager
         EndApiCallCapture();
     }
 
-    // Single object destruction.
+    // Single object destruction. Destroy calls are tracked separately from parameter encoding, which is only performed
+    // when writing, as state tracking does not need the encoded parameters.
     template <typename Wrapper>
-    void EndDestroyApiCallCapture(typename Wrapper::HandleType handle)
+    void TrackDestroyApiCall(typename Wrapper::HandleType handle)
     {
         if ((GetCaptureMode() & kModeTrack) == kModeTrack)
         {
             assert(state_tracker_ != nullptr);
             state_tracker_->RemoveEntry<Wrapper>(handle);
         }
-
-        EndApiCallCapture();
     }
 
     // Multiple object destruction.
     template <typename Wrapper>
-    void EndDestroyApiCallCapture(uint32_t count, const typename Wrapper::HandleType* handles)
+    void TrackDestroyApiCall(uint32_t count, const typename Wrapper::HandleType* handles)
     {
         if (((GetCaptureMode() & kModeTrack) == kModeTrack) && (handles != nullptr))
         {
@@ -209,8 +208,6 @@ class VulkanCaptureManager : public CaptureManager
                 state_tracker_->RemoveEntry<Wrapper>(handles[i]);
             }
         }
-
-        EndApiCallCapture();
     }
 
     void EndCommandApiCallCapture(VkCommandBuffer command_buffer)
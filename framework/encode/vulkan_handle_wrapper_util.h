@@ -29,6 +29,7 @@
 #include "format/format_util.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/object_pool.h"
 
 #include <algorithm>
 #include <iterator>
@@ -40,6 +41,35 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 typedef format::HandleId (*PFN_GetHandleId)();
 
+// Wrappers are allocated from per-type slab pools, avoiding a system heap allocation for every created handle. The
+// pools are intentionally never destroyed, so that wrappers released during process teardown remain valid.
+template <typename Wrapper>
+util::ObjectPool<Wrapper>& GetWrapperPool()
+{
+    static util::ObjectPool<Wrapper>* pool = new util::ObjectPool<Wrapper>;
+    return *pool;
+}
+
+template <typename Wrapper>
+Wrapper* AllocateWrapper()
+{
+    return GetWrapperPool<Wrapper>().Create();
+}
+
+template <typename Wrapper>
+void FreeWrapper(Wrapper* wrapper)
+{
+    GetWrapperPool<Wrapper>().Destroy(wrapper);
+}
+
+// Free all of the wrappers stored as values in a child handle map with a single pool lock.
+template <typename Wrapper, typename Map>
+void FreeChildWrappers(const Map& children)
+{
+    GetWrapperPool<Wrapper>().Destroy(
+        children.begin(), children.end(), [](const typename Map::value_type& entry) { return entry.second; });
+}
+
 template <typename T>
 T GetWrappedHandle(const T& handle)
 {
@@ -112,7 +142,7 @@ void CreateWrappedDispatchHandle(typename ParentWrapper::HandleType parent,
     assert(handle != nullptr);
     if ((*handle) != VK_NULL_HANDLE)
     {
-        Wrapper* wrapper      = new Wrapper;
+        Wrapper* wrapper      = AllocateWrapper<Wrapper>();
         wrapper->dispatch_key = *reinterpret_cast<void**>(*handle);
         wrapper->handle       = (*handle);
         wrapper->handle_id    = get_id();
@@ -137,7 +167,7 @@ void CreateWrappedNonDispatchHandle(typename Wrapper::HandleType* handle, PFN_Ge
     assert(handle != nullptr);
     if ((*handle) != VK_NULL_HANDLE)
     {
-        Wrapper* wrapper   = new Wrapper;
+        Wrapper* wrapper   = AllocateWrapper<Wrapper>();
         wrapper->handle    = (*handle);
         wrapper->handle_id = get_id();
         (*handle)          = reinterpret_cast<typename Wrapper::HandleType>(wrapper);
@@ -426,7 +456,7 @@ void DestroyWrappedHandle(typename Wrapper::HandleType handle)
 {
     if (handle != VK_NULL_HANDLE)
     {
-        delete reinterpret_cast<Wrapper*>(handle);
+        FreeWrapper(reinterpret_cast<Wrapper*>(handle));
     }
 }
 
@@ -444,16 +474,16 @@ inline void DestroyWrappedHandle<InstanceWrapper>(VkInstance handle)
             {
                 for (auto display_mode_wrapper : display_wrapper->child_display_modes)
                 {
-                    delete display_mode_wrapper;
+                    FreeWrapper(display_mode_wrapper);
                 }
 
-                delete display_wrapper;
+                FreeWrapper(display_wrapper);
             }
 
-            delete physical_device_wrapper;
+            FreeWrapper(physical_device_wrapper);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -467,10 +497,10 @@ inline void DestroyWrappedHandle<DeviceWrapper>(VkDevice handle)
 
         for (auto queue_wrapper : wrapper->child_queues)
         {
-            delete queue_wrapper;
+            FreeWrapper(queue_wrapper);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -483,7 +513,7 @@ inline void DestroyWrappedHandle<CommandBufferWrapper>(VkCommandBuffer handle)
         auto wrapper = reinterpret_cast<CommandBufferWrapper*>(handle);
         wrapper->parent_pool->child_buffers.erase(wrapper->handle_id);
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -495,12 +525,9 @@ inline void DestroyWrappedHandle<CommandPoolWrapper>(VkCommandPool handle)
         // Destroy child wrappers.
         auto wrapper = reinterpret_cast<CommandPoolWrapper*>(handle);
 
-        for (const auto& buffer_wrapper : wrapper->child_buffers)
-        {
-            delete buffer_wrapper.second;
-        }
+        FreeChildWrappers<CommandBufferWrapper>(wrapper->child_buffers);
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -513,7 +540,7 @@ inline void DestroyWrappedHandle<DescriptorSetWrapper>(VkDescriptorSet handle)
         auto wrapper = reinterpret_cast<DescriptorSetWrapper*>(handle);
         wrapper->parent_pool->child_sets.erase(wrapper->handle_id);
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -525,12 +552,9 @@ inline void DestroyWrappedHandle<DescriptorPoolWrapper>(VkDescriptorPool handle)
         // Destroy child wrappers.
         auto wrapper = reinterpret_cast<DescriptorPoolWrapper*>(handle);
 
-        for (const auto& set_wrapper : wrapper->child_sets)
-        {
-            delete set_wrapper.second;
-        }
+        FreeChildWrappers<DescriptorSetWrapper>(wrapper->child_sets);
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -544,10 +568,10 @@ inline void DestroyWrappedHandle<SwapchainKHRWrapper>(VkSwapchainKHR handle)
 
         for (auto image_wrapper : wrapper->child_images)
         {
-            delete image_wrapper;
+            FreeWrapper(image_wrapper);
         }
 
-        delete wrapper;
+        FreeWrapper(wrapper);
     }
 }
 
@@ -569,10 +593,7 @@ inline void ResetDescriptorPoolWrapper(VkDescriptorPool handle)
 
     // Destroy child wrappers.
     auto wrapper = reinterpret_cast<DescriptorPoolWrapper*>(handle);
-    for (const auto& set_wrapper : wrapper->child_sets)
-    {
-        delete set_wrapper.second;
-    }
+    FreeChildWrappers<DescriptorSetWrapper>(wrapper->child_sets);
     wrapper->child_sets.clear();
 }
 
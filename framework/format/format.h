@@ -56,6 +56,7 @@ typedef uint64_t         ThreadId;
 const uint32_t kCompressedBlockTypeBit    = 0x80000000;
 const size_t   kUuidSize                  = 16;
 const size_t   kMaxPhysicalDeviceNameSize = 256;
+const size_t   kBlobDigestSize            = 32; // SHA-256 digest of blob data.
 const HandleId kNullHandleId              = 0;
 
 constexpr uint32_t MakeCompressedBlockType(uint32_t block_type)
@@ -73,6 +74,7 @@ enum BlockType : uint32_t
     kFunctionCallBlock           = 4,
     kAnnotation                  = 5,
     kMethodCallBlock             = 6,
+    kBlobReferenceBlock          = 7, // Function call or meta-data block with data stored in the blob table.
     kCompressedMetaDataBlock     = MakeCompressedBlockType(kMetaDataBlock),
     kCompressedFunctionCallBlock = MakeCompressedBlockType(kFunctionCallBlock),
     kCompressedMethodCallBlock   = MakeCompressedBlockType(kMethodCallBlock),
@@ -112,7 +114,9 @@ enum class MetaDataType : uint16_t
     kSetOpaqueAddressCommand                = 14,
     kSetRayTracingShaderGroupHandlesCommand = 15,
     kCreateHeapAllocationCommand            = 16,
-    kInitSubresourceCommand                 = 17
+    kInitSubresourceCommand                 = 17,
+    kFillMemoryReferenceCommand             = 18,
+    kStoreBlobCommand                       = 19
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -252,6 +256,24 @@ struct AnnotationHeader
     uint32_t       data_length;
 };
 
+// Function call or meta-data block with ranges of its data replaced by references to blobs that were added to the blob
+// table by earlier store blob commands.  The header is followed by reference_count BlobReference structs, and then by
+// the block data with the referenced ranges omitted.  Frame delimiter calls are never encoded as blob reference blocks.
+struct BlobReferenceBlockHeader
+{
+    BlockHeader block_header;
+    BlockType   inner_block_type; // Type of the block with blob data restored, which is never a compressed type.
+    uint64_t    inner_block_size; // Size of the block data with blob data restored.
+    uint32_t    reference_count;
+};
+
+struct BlobReference
+{
+    uint64_t offset; // Offset of the blob data from the start of the restored block data.
+    uint64_t size;
+    uint8_t  blob_digest[kBlobDigestSize];
+};
+
 // Metadata block headers and data types.
 struct MetaDataHeader
 {
@@ -270,6 +292,30 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Fill memory command with content identified by a content ID, which is the 64-bit FNV-1a hash of the fill data.  When
+// data_size is non-zero, the data is encoded after the header and is retained by the file processor for use by later
+// commands with the same content ID.  When data_size is zero, no data is encoded and the memory range is filled with
+// the data retained for the content ID.
+struct FillMemoryReferenceCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Size of the memory range to fill.
+    uint64_t         content_id;
+    uint64_t         data_size; // Uncompressed size of the data encoded after the header, or 0 for a content reference.
+};
+
+// Adds a blob to the blob table, keyed by the SHA-256 digest of its data, for use by later blob reference blocks.
+struct StoreBlobCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint8_t          blob_digest[kBlobDigestSize];
+    uint64_t         data_size; // Uncompressed size of the data encoded after the header.
+};
+
 struct DisplayMessageCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -28,6 +28,8 @@
 #include "util/zlib_compressor.h"
 #include "util/zstd_compressor.h"
 
+#include <cstdio>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(format)
 
@@ -103,5 +105,61 @@ std::string GetCompressionTypeName(CompressionType type)
     return "";
 }
 
+std::string GetMetaDataTypeName(MetaDataType type)
+{
+    switch (type)
+    {
+        case MetaDataType::kDisplayMessageCommand:
+            return "DisplayMessage";
+        case MetaDataType::kFillMemoryCommand:
+            return "FillMemory";
+        case MetaDataType::kResizeWindowCommand:
+            return "ResizeWindow";
+        case MetaDataType::kSetSwapchainImageStateCommand:
+            return "SetSwapchainImageState";
+        case MetaDataType::kBeginResourceInitCommand:
+            return "BeginResourceInit";
+        case MetaDataType::kEndResourceInitCommand:
+            return "EndResourceInit";
+        case MetaDataType::kInitBufferCommand:
+            return "InitBuffer";
+        case MetaDataType::kInitImageCommand:
+            return "InitImage";
+        case MetaDataType::kCreateHardwareBufferCommand:
+            return "CreateHardwareBuffer";
+        case MetaDataType::kDestroyHardwareBufferCommand:
+            return "DestroyHardwareBuffer";
+        case MetaDataType::kSetDevicePropertiesCommand:
+            return "SetDeviceProperties";
+        case MetaDataType::kSetDeviceMemoryPropertiesCommand:
+            return "SetDeviceMemoryProperties";
+        case MetaDataType::kResizeWindowCommand2:
+            return "ResizeWindow2";
+        case MetaDataType::kSetOpaqueAddressCommand:
+            return "SetOpaqueAddress";
+        case MetaDataType::kSetRayTracingShaderGroupHandlesCommand:
+            return "SetRayTracingShaderGroupHandles";
+        case MetaDataType::kCreateHeapAllocationCommand:
+            return "CreateHeapAllocation";
+        case MetaDataType::kInitSubresourceCommand:
+            return "InitSubresource";
+        case MetaDataType::kFillMemoryReferenceCommand:
+            return "FillMemoryReference";
+        case MetaDataType::kStoreBlobCommand:
+            return "StoreBlob";
+        default:
+            break;
+    }
+
+    return "";
+}
+
+std::string GetApiCallName(ApiCallId call_id)
+{
+    char call_name[32];
+    snprintf(call_name, sizeof(call_name), "ApiCall_0x%x", static_cast<uint32_t>(call_id));
+    return call_name;
+}
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -89,6 +89,11 @@ util::Compressor* CreateCompressor(CompressionType type);
 
 std::string GetCompressionTypeName(CompressionType type);
 
+std::string GetMetaDataTypeName(MetaDataType type);
+
+// Capture files identify API calls by ID only, so calls are named by the hexadecimal value of their ID.
+std::string GetApiCallName(ApiCallId call_id);
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -48,9 +48,81 @@ class BaseStructDecodersBodyGenerator():
             body += '    return bytes_read;\n'
             body += '}'
 
+            if self.is_fixed_layout_struct(struct):
+                body += '\n\n'
+                body += self.make_decode_struct_array(struct)
+
             write(body, file=self.outFile)
             first = False
 
+    def make_decode_struct_array(self, name):
+        """Generate an array decoder for a struct with a fixed memory layout, which copies the entire array from the
+        parameter buffer and then points the decoded struct wrappers at the copied structs."""
+        size, _, _ = self.get_fixed_layout_struct_info(name)
+        allocations, links = self.make_fixed_layout_wrapper_links(
+            name, 'wrappers[i].', 'values[i].', ''
+        )
+
+        body = 'size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_{name}* wrappers, {name}* values, size_t len)\n'.format(
+            name=name
+        )
+        body += '{\n'
+        body += '    assert((wrappers != nullptr) && (values != nullptr));\n'
+        body += '    static_assert(sizeof({name}) == {}, "Unexpected size for fixed layout struct {name}");\n'.format(
+            size, name=name
+        )
+        body += '\n'
+        body += '    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);\n'
+        body += '\n'
+        for allocation in allocations:
+            body += '    {}\n'.format(allocation)
+        if allocations:
+            body += '\n'
+        body += '    for (size_t i = 0; i < len; ++i)\n'
+        body += '    {\n'
+        body += '        wrappers[i].decoded_value = &values[i];\n'
+        for link in links:
+            body += '        {}\n'.format(link)
+        body += '    }\n'
+        body += '\n'
+        body += '    return bytes_read;\n'
+        body += '}'
+        return body
+
+    def make_fixed_layout_wrapper_links(
+        self, name, wrapper_prefix, value_prefix, array_prefix
+    ):
+        """Generate the allocations for the wrappers of struct members with a struct type, and the statements that
+        link each wrapper to its parent wrapper and decoded struct member."""
+        allocations = []
+        links = []
+
+        _, _, struct_members = self.get_fixed_layout_struct_info(name)
+        for member_name, member_type in struct_members:
+            array_name = '{}{}_wrappers'.format(array_prefix, member_name)
+            allocations.append(
+                'Decoded_{type}* {} = DecodeAllocator::Allocate<Decoded_{type}>(len);'
+                .format(array_name, type=member_type)
+            )
+            links.append(
+                '{}{} = &{}[i];'.format(wrapper_prefix, member_name, array_name)
+            )
+            links.append(
+                '{}{}->decoded_value = &({}{});'.format(
+                    wrapper_prefix, member_name, value_prefix, member_name
+                )
+            )
+
+            member_allocations, member_links = self.make_fixed_layout_wrapper_links(
+                member_type, '{}{}->'.format(wrapper_prefix, member_name),
+                '{}{}.'.format(value_prefix, member_name),
+                '{}{}_'.format(array_prefix, member_name)
+            )
+            allocations += member_allocations
+            links += member_links
+
+        return allocations, links
+
     def make_decode_struct_body(self, name, values):
         """Generate C++ code for the decoder method body."""
         body = ''
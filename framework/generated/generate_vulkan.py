@@ -57,6 +57,8 @@ generate_targets = [
     'generated_vulkan_decoder.cpp', 'generated_decode_pnext_struct.cpp',
     'generated_vulkan_consumer.h', 'generated_vulkan_ascii_consumer.h',
     'generated_vulkan_ascii_consumer.cpp',
+    'generated_vulkan_export_consumer.h',
+    'generated_vulkan_export_consumer.cpp',
     'generated_vulkan_replay_consumer.h',
     'generated_vulkan_replay_consumer.cpp',
     'generated_vulkan_referenced_resource_consumer.h',
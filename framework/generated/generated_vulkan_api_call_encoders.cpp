@@ -85,14 +85,16 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyInstance>::Dispatch(VulkanCaptureManager::Get(), instance, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyInstance);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyInstance);
     if (encoder)
     {
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<InstanceWrapper>(instance);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<InstanceWrapper>(instance);
+
     VkInstance instance_unwrapped = GetWrappedHandle<VkInstance>(instance);
 
     GetInstanceTable(instance)->DestroyInstance(instance_unwrapped, pAllocator);
@@ -344,14 +346,16 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDevice>::Dispatch(VulkanCaptureManager::Get(), device, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDevice);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDevice);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DeviceWrapper>(device);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DeviceWrapper>(device);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
 
     GetDeviceTable(device)->DestroyDevice(device_unwrapped, pAllocator);
@@ -514,15 +518,17 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkFreeMemory>::Dispatch(VulkanCaptureManager::Get(), device, memory, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkFreeMemory);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkFreeMemory);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(memory);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DeviceMemoryWrapper>(memory);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DeviceMemoryWrapper>(memory);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkDeviceMemory memory_unwrapped = GetWrappedHandle<VkDeviceMemory>(memory);
 
@@ -946,15 +952,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyFence>::Dispatch(VulkanCaptureManager::Get(), device, fence, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyFence);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyFence);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(fence);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<FenceWrapper>(fence);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<FenceWrapper>(fence);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkFence fence_unwrapped = GetWrappedHandle<VkFence>(fence);
 
@@ -1106,15 +1114,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroySemaphore>::Dispatch(VulkanCaptureManager::Get(), device, semaphore, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroySemaphore);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroySemaphore);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(semaphore);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<SemaphoreWrapper>(semaphore);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<SemaphoreWrapper>(semaphore);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkSemaphore semaphore_unwrapped = GetWrappedHandle<VkSemaphore>(semaphore);
 
@@ -1175,15 +1185,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyEvent>::Dispatch(VulkanCaptureManager::Get(), device, event, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyEvent);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyEvent);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(event);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<EventWrapper>(event);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<EventWrapper>(event);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkEvent event_unwrapped = GetWrappedHandle<VkEvent>(event);
 
@@ -1325,15 +1337,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyQueryPool>::Dispatch(VulkanCaptureManager::Get(), device, queryPool, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyQueryPool);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyQueryPool);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(queryPool);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<QueryPoolWrapper>(queryPool);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<QueryPoolWrapper>(queryPool);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkQueryPool queryPool_unwrapped = GetWrappedHandle<VkQueryPool>(queryPool);
 
@@ -1432,15 +1446,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyBuffer>::Dispatch(VulkanCaptureManager::Get(), device, buffer, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyBuffer);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyBuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(buffer);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<BufferWrapper>(buffer);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<BufferWrapper>(buffer);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkBuffer buffer_unwrapped = GetWrappedHandle<VkBuffer>(buffer);
 
@@ -1503,15 +1519,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyBufferView>::Dispatch(VulkanCaptureManager::Get(), device, bufferView, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyBufferView);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyBufferView);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(bufferView);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<BufferViewWrapper>(bufferView);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<BufferViewWrapper>(bufferView);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkBufferView bufferView_unwrapped = GetWrappedHandle<VkBufferView>(bufferView);
 
@@ -1574,15 +1592,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyImage>::Dispatch(VulkanCaptureManager::Get(), device, image, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyImage);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyImage);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(image);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<ImageWrapper>(image);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<ImageWrapper>(image);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkImage image_unwrapped = GetWrappedHandle<VkImage>(image);
 
@@ -1673,15 +1693,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyImageView>::Dispatch(VulkanCaptureManager::Get(), device, imageView, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyImageView);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyImageView);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(imageView);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<ImageViewWrapper>(imageView);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<ImageViewWrapper>(imageView);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkImageView imageView_unwrapped = GetWrappedHandle<VkImageView>(imageView);
 
@@ -1744,15 +1766,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyShaderModule>::Dispatch(VulkanCaptureManager::Get(), device, shaderModule, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyShaderModule);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyShaderModule);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(shaderModule);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<ShaderModuleWrapper>(shaderModule);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<ShaderModuleWrapper>(shaderModule);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkShaderModule shaderModule_unwrapped = GetWrappedHandle<VkShaderModule>(shaderModule);
 
@@ -1813,15 +1837,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyPipelineCache>::Dispatch(VulkanCaptureManager::Get(), device, pipelineCache, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPipelineCache);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPipelineCache);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(pipelineCache);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<PipelineCacheWrapper>(pipelineCache);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<PipelineCacheWrapper>(pipelineCache);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkPipelineCache pipelineCache_unwrapped = GetWrappedHandle<VkPipelineCache>(pipelineCache);
 
@@ -2007,15 +2033,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyPipeline>::Dispatch(VulkanCaptureManager::Get(), device, pipeline, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPipeline);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPipeline);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(pipeline);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<PipelineWrapper>(pipeline);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<PipelineWrapper>(pipeline);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkPipeline pipeline_unwrapped = GetWrappedHandle<VkPipeline>(pipeline);
 
@@ -2078,15 +2106,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyPipelineLayout>::Dispatch(VulkanCaptureManager::Get(), device, pipelineLayout, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPipelineLayout);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPipelineLayout);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(pipelineLayout);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<PipelineLayoutWrapper>(pipelineLayout);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<PipelineLayoutWrapper>(pipelineLayout);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkPipelineLayout pipelineLayout_unwrapped = GetWrappedHandle<VkPipelineLayout>(pipelineLayout);
 
@@ -2149,15 +2179,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroySampler>::Dispatch(VulkanCaptureManager::Get(), device, sampler, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroySampler);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroySampler);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(sampler);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<SamplerWrapper>(sampler);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<SamplerWrapper>(sampler);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkSampler sampler_unwrapped = GetWrappedHandle<VkSampler>(sampler);
 
@@ -2220,15 +2252,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout>::Dispatch(VulkanCaptureManager::Get(), device, descriptorSetLayout, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(descriptorSetLayout);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DescriptorSetLayoutWrapper>(descriptorSetLayout);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DescriptorSetLayoutWrapper>(descriptorSetLayout);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkDescriptorSetLayout descriptorSetLayout_unwrapped = GetWrappedHandle<VkDescriptorSetLayout>(descriptorSetLayout);
 
@@ -2289,15 +2323,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDescriptorPool>::Dispatch(VulkanCaptureManager::Get(), device, descriptorPool, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorPool);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorPool);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(descriptorPool);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DescriptorPoolWrapper>(descriptorPool);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DescriptorPoolWrapper>(descriptorPool);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkDescriptorPool descriptorPool_unwrapped = GetWrappedHandle<VkDescriptorPool>(descriptorPool);
 
@@ -2395,7 +2431,7 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
 
     VkResult result = GetDeviceTable(device)->FreeDescriptorSets(device_unwrapped, descriptorPool_unwrapped, descriptorSetCount, pDescriptorSets_unwrapped);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkFreeDescriptorSets);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkFreeDescriptorSets);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
@@ -2403,9 +2439,11 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
         encoder->EncodeUInt32Value(descriptorSetCount);
         encoder->EncodeHandleArray(pDescriptorSets, descriptorSetCount);
         encoder->EncodeEnumValue(result);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DescriptorSetWrapper>(descriptorSetCount, pDescriptorSets);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DescriptorSetWrapper>(descriptorSetCount, pDescriptorSets);
+
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkFreeDescriptorSets>::Dispatch(VulkanCaptureManager::Get(), result, device, descriptorPool, descriptorSetCount, pDescriptorSets);
 
     DestroyWrappedHandles<DescriptorSetWrapper>(pDescriptorSets, descriptorSetCount);
@@ -2497,15 +2535,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyFramebuffer>::Dispatch(VulkanCaptureManager::Get(), device, framebuffer, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyFramebuffer);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyFramebuffer);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(framebuffer);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<FramebufferWrapper>(framebuffer);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<FramebufferWrapper>(framebuffer);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkFramebuffer framebuffer_unwrapped = GetWrappedHandle<VkFramebuffer>(framebuffer);
 
@@ -2566,15 +2606,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyRenderPass>::Dispatch(VulkanCaptureManager::Get(), device, renderPass, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyRenderPass);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyRenderPass);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(renderPass);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<RenderPassWrapper>(renderPass);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<RenderPassWrapper>(renderPass);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkRenderPass renderPass_unwrapped = GetWrappedHandle<VkRenderPass>(renderPass);
 
@@ -2661,15 +2703,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyCommandPool>::Dispatch(VulkanCaptureManager::Get(), device, commandPool, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyCommandPool);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyCommandPool);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(commandPool);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<CommandPoolWrapper>(commandPool);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<CommandPoolWrapper>(commandPool);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkCommandPool commandPool_unwrapped = GetWrappedHandle<VkCommandPool>(commandPool);
 
@@ -2760,16 +2804,18 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkFreeCommandBuffers>::Dispatch(VulkanCaptureManager::Get(), device, commandPool, commandBufferCount, pCommandBuffers);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkFreeCommandBuffers);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkFreeCommandBuffers);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(commandPool);
         encoder->EncodeUInt32Value(commandBufferCount);
         encoder->EncodeHandleArray(pCommandBuffers, commandBufferCount);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<CommandBufferWrapper>(commandBufferCount, pCommandBuffers);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<CommandBufferWrapper>(commandBufferCount, pCommandBuffers);
+
     auto handle_unwrap_memory = VulkanCaptureManager::Get()->GetHandleUnwrapMemory();
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkCommandPool commandPool_unwrapped = GetWrappedHandle<VkCommandPool>(commandPool);
@@ -4706,15 +4752,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion>::Dispatch(VulkanCaptureManager::Get(), device, ycbcrConversion, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(ycbcrConversion);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<SamplerYcbcrConversionWrapper>(ycbcrConversion);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<SamplerYcbcrConversionWrapper>(ycbcrConversion);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkSamplerYcbcrConversion ycbcrConversion_unwrapped = GetWrappedHandle<VkSamplerYcbcrConversion>(ycbcrConversion);
 
@@ -4777,15 +4825,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate>::Dispatch(VulkanCaptureManager::Get(), device, descriptorUpdateTemplate, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(descriptorUpdateTemplate);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DescriptorUpdateTemplateWrapper>(descriptorUpdateTemplate);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DescriptorUpdateTemplateWrapper>(descriptorUpdateTemplate);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkDescriptorUpdateTemplate descriptorUpdateTemplate_unwrapped = GetWrappedHandle<VkDescriptorUpdateTemplate>(descriptorUpdateTemplate);
 
@@ -5373,15 +5423,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot>::Dispatch(VulkanCaptureManager::Get(), device, privateDataSlot, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(privateDataSlot);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<PrivateDataSlotWrapper>(privateDataSlot);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<PrivateDataSlotWrapper>(privateDataSlot);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkPrivateDataSlot privateDataSlot_unwrapped = GetWrappedHandle<VkPrivateDataSlot>(privateDataSlot);
 
@@ -6282,15 +6334,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroySurfaceKHR>::Dispatch(VulkanCaptureManager::Get(), instance, surface, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroySurfaceKHR);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroySurfaceKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(instance);
         encoder->EncodeHandleValue(surface);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<SurfaceKHRWrapper>(surface);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<SurfaceKHRWrapper>(surface);
+
     VkInstance instance_unwrapped = GetWrappedHandle<VkInstance>(instance);
     VkSurfaceKHR surface_unwrapped = GetWrappedHandle<VkSurfaceKHR>(surface);
 
@@ -6499,15 +6553,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroySwapchainKHR>::Dispatch(VulkanCaptureManager::Get(), device, swapchain, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroySwapchainKHR);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroySwapchainKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(swapchain);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<SwapchainKHRWrapper>(swapchain);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<SwapchainKHRWrapper>(swapchain);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkSwapchainKHR swapchain_unwrapped = GetWrappedHandle<VkSwapchainKHR>(swapchain);
 
@@ -8204,15 +8260,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR>::Dispatch(VulkanCaptureManager::Get(), device, descriptorUpdateTemplate, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(descriptorUpdateTemplate);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DescriptorUpdateTemplateWrapper>(descriptorUpdateTemplate);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DescriptorUpdateTemplateWrapper>(descriptorUpdateTemplate);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkDescriptorUpdateTemplate descriptorUpdateTemplate_unwrapped = GetWrappedHandle<VkDescriptorUpdateTemplate>(descriptorUpdateTemplate);
 
@@ -8992,15 +9050,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR>::Dispatch(VulkanCaptureManager::Get(), device, ycbcrConversion, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(ycbcrConversion);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<SamplerYcbcrConversionWrapper>(ycbcrConversion);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<SamplerYcbcrConversionWrapper>(ycbcrConversion);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkSamplerYcbcrConversion ycbcrConversion_unwrapped = GetWrappedHandle<VkSamplerYcbcrConversion>(ycbcrConversion);
 
@@ -9483,15 +9543,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR>::Dispatch(VulkanCaptureManager::Get(), device, operation, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(operation);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DeferredOperationKHRWrapper>(operation);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DeferredOperationKHRWrapper>(operation);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkDeferredOperationKHR operation_unwrapped = GetWrappedHandle<VkDeferredOperationKHR>(operation);
 
@@ -10205,15 +10267,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT>::Dispatch(VulkanCaptureManager::Get(), instance, callback, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(instance);
         encoder->EncodeHandleValue(callback);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DebugReportCallbackEXTWrapper>(callback);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DebugReportCallbackEXTWrapper>(callback);
+
     VkInstance instance_unwrapped = GetWrappedHandle<VkInstance>(instance);
     VkDebugReportCallbackEXT callback_unwrapped = GetWrappedHandle<VkDebugReportCallbackEXT>(callback);
 
@@ -11713,15 +11777,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT>::Dispatch(VulkanCaptureManager::Get(), instance, messenger, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(instance);
         encoder->EncodeHandleValue(messenger);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<DebugUtilsMessengerEXTWrapper>(messenger);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<DebugUtilsMessengerEXTWrapper>(messenger);
+
     VkInstance instance_unwrapped = GetWrappedHandle<VkInstance>(instance);
     VkDebugUtilsMessengerEXT messenger_unwrapped = GetWrappedHandle<VkDebugUtilsMessengerEXT>(messenger);
 
@@ -11962,15 +12028,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyValidationCacheEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT>::Dispatch(VulkanCaptureManager::Get(), device, validationCache, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(validationCache);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<ValidationCacheEXTWrapper>(validationCache);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<ValidationCacheEXTWrapper>(validationCache);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkValidationCacheEXT validationCache_unwrapped = GetWrappedHandle<VkValidationCacheEXT>(validationCache);
 
@@ -12183,15 +12251,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV>::Dispatch(VulkanCaptureManager::Get(), device, accelerationStructure, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(accelerationStructure);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<AccelerationStructureNVWrapper>(accelerationStructure);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<AccelerationStructureNVWrapper>(accelerationStructure);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkAccelerationStructureNV accelerationStructure_unwrapped = GetWrappedHandle<VkAccelerationStructureNV>(accelerationStructure);
 
@@ -13094,15 +13164,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
 
     VkResult result = GetDeviceTable(device)->ReleasePerformanceConfigurationINTEL(device_unwrapped, configuration_unwrapped);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(configuration);
         encoder->EncodeEnumValue(result);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<PerformanceConfigurationINTELWrapper>(configuration);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<PerformanceConfigurationINTELWrapper>(configuration);
+
     CustomEncoderPostCall<format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL>::Dispatch(VulkanCaptureManager::Get(), result, device, configuration);
 
     DestroyWrappedHandle<PerformanceConfigurationINTELWrapper>(configuration);
@@ -14088,15 +14160,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV>::Dispatch(VulkanCaptureManager::Get(), device, indirectCommandsLayout, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(indirectCommandsLayout);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<IndirectCommandsLayoutNVWrapper>(indirectCommandsLayout);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<IndirectCommandsLayoutNVWrapper>(indirectCommandsLayout);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkIndirectCommandsLayoutNV indirectCommandsLayout_unwrapped = GetWrappedHandle<VkIndirectCommandsLayoutNV>(indirectCommandsLayout);
 
@@ -14227,15 +14301,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT>::Dispatch(VulkanCaptureManager::Get(), device, privateDataSlot, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(privateDataSlot);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<PrivateDataSlotWrapper>(privateDataSlot);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<PrivateDataSlotWrapper>(privateDataSlot);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkPrivateDataSlot privateDataSlot_unwrapped = GetWrappedHandle<VkPrivateDataSlot>(privateDataSlot);
 
@@ -15040,15 +15116,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(
 
     CustomEncoderPreCall<format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR>::Dispatch(VulkanCaptureManager::Get(), device, accelerationStructure, pAllocator);
 
-    auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR);
+    auto encoder = VulkanCaptureManager::Get()->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR);
     if (encoder)
     {
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(accelerationStructure);
         EncodeStructPtr(encoder, pAllocator);
-        VulkanCaptureManager::Get()->EndDestroyApiCallCapture<AccelerationStructureKHRWrapper>(accelerationStructure);
+        VulkanCaptureManager::Get()->EndApiCallCapture();
     }
 
+    VulkanCaptureManager::Get()->TrackDestroyApiCall<AccelerationStructureKHRWrapper>(accelerationStructure);
+
     VkDevice device_unwrapped = GetWrappedHandle<VkDevice>(device);
     VkAccelerationStructureKHR accelerationStructure_unwrapped = GetWrappedHandle<VkAccelerationStructureKHR>(accelerationStructure);
 
@@ -0,0 +1,5061 @@
+/*
+** Copyright (c) 2018-2021 Valve Corporation
+** Copyright (c) 2018-2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+** This file is generated from the Khronos Vulkan XML API Registry.
+**
+*/
+
+#include "generated/generated_vulkan_export_consumer.h"
+#include "util/defines.h"
+#include "vulkan/vulkan.h"
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+void VulkanExportConsumer::Process_vkCreateInstance(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    StructPointerDecoder<Decoded_VkInstanceCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkInstance>*           pInstance)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateInstance, true, static_cast<int64_t>(returnValue), format::kNullHandleId, GetFirstHandleId(pInstance));
+}
+
+void VulkanExportConsumer::Process_vkDestroyInstance(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyInstance, false, 0, instance, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkEnumeratePhysicalDevices(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    PointerDecoder<uint32_t>*                   pPhysicalDeviceCount,
+    HandlePointerDecoder<VkPhysicalDevice>*     pPhysicalDevices)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pPhysicalDevices));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFeatures(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures>* pFeatures)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFormatProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    VkFormat                                    format,
+    StructPointerDecoder<Decoded_VkFormatProperties>* pFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    VkFormat                                    format,
+    VkImageType                                 type,
+    VkImageTiling                               tiling,
+    VkImageUsageFlags                           usage,
+    VkImageCreateFlags                          flags,
+    StructPointerDecoder<Decoded_VkImageFormatProperties>* pImageFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
+    StructPointerDecoder<Decoded_VkQueueFamilyProperties>* pQueueFamilyProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateDevice(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkDeviceCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDevice>*             pDevice)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDevice, true, static_cast<int64_t>(returnValue), physicalDevice, GetFirstHandleId(pDevice));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDevice(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDevice, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceQueue(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    uint32_t                                    queueFamilyIndex,
+    uint32_t                                    queueIndex,
+    HandlePointerDecoder<VkQueue>*              pQueue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceQueue, false, 0, device, GetFirstHandleId(pQueue));
+}
+
+void VulkanExportConsumer::Process_vkQueueSubmit(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue,
+    uint32_t                                    submitCount,
+    StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
+    format::HandleId                            fence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueSubmit, true, static_cast<int64_t>(returnValue), queue, fence);
+}
+
+void VulkanExportConsumer::Process_vkQueueWaitIdle(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueWaitIdle, true, static_cast<int64_t>(returnValue), queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkDeviceWaitIdle(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDeviceWaitIdle, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkAllocateMemory(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkMemoryAllocateInfo>* pAllocateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDeviceMemory>*       pMemory)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAllocateMemory, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pMemory));
+}
+
+void VulkanExportConsumer::Process_vkFreeMemory(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            memory,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkFreeMemory, false, 0, device, memory);
+}
+
+void VulkanExportConsumer::Process_vkMapMemory(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            memory,
+    VkDeviceSize                                offset,
+    VkDeviceSize                                size,
+    VkMemoryMapFlags                            flags,
+    PointerDecoder<uint64_t, void*>*            ppData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkMapMemory, true, static_cast<int64_t>(returnValue), device, memory);
+}
+
+void VulkanExportConsumer::Process_vkUnmapMemory(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            memory)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkUnmapMemory, false, 0, device, memory);
+}
+
+void VulkanExportConsumer::Process_vkFlushMappedMemoryRanges(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    memoryRangeCount,
+    StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkInvalidateMappedMemoryRanges(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    memoryRangeCount,
+    StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceMemoryCommitment(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            memory,
+    PointerDecoder<VkDeviceSize>*               pCommittedMemoryInBytes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment, false, 0, device, memory);
+}
+
+void VulkanExportConsumer::Process_vkBindBufferMemory(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            buffer,
+    format::HandleId                            memory,
+    VkDeviceSize                                memoryOffset)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindBufferMemory, true, static_cast<int64_t>(returnValue), device, buffer);
+}
+
+void VulkanExportConsumer::Process_vkBindImageMemory(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            image,
+    format::HandleId                            memory,
+    VkDeviceSize                                memoryOffset)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindImageMemory, true, static_cast<int64_t>(returnValue), device, image);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferMemoryRequirements(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            buffer,
+    StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements, false, 0, device, buffer);
+}
+
+void VulkanExportConsumer::Process_vkGetImageMemoryRequirements(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            image,
+    StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageMemoryRequirements, false, 0, device, image);
+}
+
+void VulkanExportConsumer::Process_vkGetImageSparseMemoryRequirements(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            image,
+    PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
+    StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements>* pSparseMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements, false, 0, device, image);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    VkFormat                                    format,
+    VkImageType                                 type,
+    VkSampleCountFlagBits                       samples,
+    VkImageUsageFlags                           usage,
+    VkImageTiling                               tiling,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkSparseImageFormatProperties>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkQueueBindSparse(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue,
+    uint32_t                                    bindInfoCount,
+    StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
+    format::HandleId                            fence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueBindSparse, true, static_cast<int64_t>(returnValue), queue, fence);
+}
+
+void VulkanExportConsumer::Process_vkCreateFence(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkFenceCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkFence>*              pFence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateFence, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pFence));
+}
+
+void VulkanExportConsumer::Process_vkDestroyFence(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            fence,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyFence, false, 0, device, fence);
+}
+
+void VulkanExportConsumer::Process_vkResetFences(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    fenceCount,
+    HandlePointerDecoder<VkFence>*              pFences)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetFences, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pFences));
+}
+
+void VulkanExportConsumer::Process_vkGetFenceStatus(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            fence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetFenceStatus, true, static_cast<int64_t>(returnValue), device, fence);
+}
+
+void VulkanExportConsumer::Process_vkWaitForFences(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    fenceCount,
+    HandlePointerDecoder<VkFence>*              pFences,
+    VkBool32                                    waitAll,
+    uint64_t                                    timeout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkWaitForFences, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pFences));
+}
+
+void VulkanExportConsumer::Process_vkCreateSemaphore(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSemaphore>*          pSemaphore)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateSemaphore, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pSemaphore));
+}
+
+void VulkanExportConsumer::Process_vkDestroySemaphore(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            semaphore,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroySemaphore, false, 0, device, semaphore);
+}
+
+void VulkanExportConsumer::Process_vkCreateEvent(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkEventCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkEvent>*              pEvent)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateEvent, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pEvent));
+}
+
+void VulkanExportConsumer::Process_vkDestroyEvent(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            event,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyEvent, false, 0, device, event);
+}
+
+void VulkanExportConsumer::Process_vkGetEventStatus(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            event)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetEventStatus, true, static_cast<int64_t>(returnValue), device, event);
+}
+
+void VulkanExportConsumer::Process_vkSetEvent(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            event)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetEvent, true, static_cast<int64_t>(returnValue), device, event);
+}
+
+void VulkanExportConsumer::Process_vkResetEvent(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            event)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetEvent, true, static_cast<int64_t>(returnValue), device, event);
+}
+
+void VulkanExportConsumer::Process_vkCreateQueryPool(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkQueryPoolCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkQueryPool>*          pQueryPool)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateQueryPool, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pQueryPool));
+}
+
+void VulkanExportConsumer::Process_vkDestroyQueryPool(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            queryPool,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyQueryPool, false, 0, device, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkGetQueryPoolResults(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount,
+    size_t                                      dataSize,
+    PointerDecoder<uint8_t>*                    pData,
+    VkDeviceSize                                stride,
+    VkQueryResultFlags                          flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetQueryPoolResults, true, static_cast<int64_t>(returnValue), device, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCreateBuffer(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkBuffer>*             pBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateBuffer, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pBuffer));
+}
+
+void VulkanExportConsumer::Process_vkDestroyBuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            buffer,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyBuffer, false, 0, device, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCreateBufferView(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferViewCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkBufferView>*         pView)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateBufferView, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pView));
+}
+
+void VulkanExportConsumer::Process_vkDestroyBufferView(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            bufferView,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyBufferView, false, 0, device, bufferView);
+}
+
+void VulkanExportConsumer::Process_vkCreateImage(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkImage>*              pImage)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateImage, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pImage));
+}
+
+void VulkanExportConsumer::Process_vkDestroyImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            image,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyImage, false, 0, device, image);
+}
+
+void VulkanExportConsumer::Process_vkGetImageSubresourceLayout(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            image,
+    StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
+    StructPointerDecoder<Decoded_VkSubresourceLayout>* pLayout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageSubresourceLayout, false, 0, device, image);
+}
+
+void VulkanExportConsumer::Process_vkCreateImageView(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageViewCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkImageView>*          pView)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateImageView, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pView));
+}
+
+void VulkanExportConsumer::Process_vkDestroyImageView(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            imageView,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyImageView, false, 0, device, imageView);
+}
+
+void VulkanExportConsumer::Process_vkCreateShaderModule(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkShaderModule>*       pShaderModule)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateShaderModule, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pShaderModule));
+}
+
+void VulkanExportConsumer::Process_vkDestroyShaderModule(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            shaderModule,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyShaderModule, false, 0, device, shaderModule);
+}
+
+void VulkanExportConsumer::Process_vkCreatePipelineCache(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPipelineCacheCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPipelineCache>*      pPipelineCache)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreatePipelineCache, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pPipelineCache));
+}
+
+void VulkanExportConsumer::Process_vkDestroyPipelineCache(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            pipelineCache,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyPipelineCache, false, 0, device, pipelineCache);
+}
+
+void VulkanExportConsumer::Process_vkGetPipelineCacheData(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipelineCache,
+    PointerDecoder<size_t>*                     pDataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPipelineCacheData, true, static_cast<int64_t>(returnValue), device, pipelineCache);
+}
+
+void VulkanExportConsumer::Process_vkMergePipelineCaches(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            dstCache,
+    uint32_t                                    srcCacheCount,
+    HandlePointerDecoder<VkPipelineCache>*      pSrcCaches)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkMergePipelineCaches, true, static_cast<int64_t>(returnValue), device, dstCache);
+}
+
+void VulkanExportConsumer::Process_vkCreateGraphicsPipelines(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipelineCache,
+    uint32_t                                    createInfoCount,
+    StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPipeline>*           pPipelines)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateGraphicsPipelines, true, static_cast<int64_t>(returnValue), device, pipelineCache);
+}
+
+void VulkanExportConsumer::Process_vkCreateComputePipelines(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipelineCache,
+    uint32_t                                    createInfoCount,
+    StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPipeline>*           pPipelines)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateComputePipelines, true, static_cast<int64_t>(returnValue), device, pipelineCache);
+}
+
+void VulkanExportConsumer::Process_vkDestroyPipeline(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyPipeline, false, 0, device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkCreatePipelineLayout(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPipelineLayoutCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPipelineLayout>*     pPipelineLayout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreatePipelineLayout, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pPipelineLayout));
+}
+
+void VulkanExportConsumer::Process_vkDestroyPipelineLayout(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            pipelineLayout,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyPipelineLayout, false, 0, device, pipelineLayout);
+}
+
+void VulkanExportConsumer::Process_vkCreateSampler(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSamplerCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSampler>*            pSampler)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateSampler, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pSampler));
+}
+
+void VulkanExportConsumer::Process_vkDestroySampler(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            sampler,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroySampler, false, 0, device, sampler);
+}
+
+void VulkanExportConsumer::Process_vkCreateDescriptorSetLayout(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDescriptorSetLayout>* pSetLayout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pSetLayout));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDescriptorSetLayout(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            descriptorSetLayout,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout, false, 0, device, descriptorSetLayout);
+}
+
+void VulkanExportConsumer::Process_vkCreateDescriptorPool(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorPoolCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDescriptorPool>*     pDescriptorPool)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDescriptorPool, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pDescriptorPool));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDescriptorPool(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            descriptorPool,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDescriptorPool, false, 0, device, descriptorPool);
+}
+
+void VulkanExportConsumer::Process_vkResetDescriptorPool(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            descriptorPool,
+    VkDescriptorPoolResetFlags                  flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetDescriptorPool, true, static_cast<int64_t>(returnValue), device, descriptorPool);
+}
+
+void VulkanExportConsumer::Process_vkAllocateDescriptorSets(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
+    HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAllocateDescriptorSets, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pDescriptorSets));
+}
+
+void VulkanExportConsumer::Process_vkFreeDescriptorSets(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            descriptorPool,
+    uint32_t                                    descriptorSetCount,
+    HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkFreeDescriptorSets, true, static_cast<int64_t>(returnValue), device, descriptorPool);
+}
+
+void VulkanExportConsumer::Process_vkUpdateDescriptorSets(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    uint32_t                                    descriptorWriteCount,
+    StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+    uint32_t                                    descriptorCopyCount,
+    StructPointerDecoder<Decoded_VkCopyDescriptorSet>* pDescriptorCopies)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkUpdateDescriptorSets, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateFramebuffer(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkFramebuffer>*        pFramebuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateFramebuffer, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pFramebuffer));
+}
+
+void VulkanExportConsumer::Process_vkDestroyFramebuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            framebuffer,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyFramebuffer, false, 0, device, framebuffer);
+}
+
+void VulkanExportConsumer::Process_vkCreateRenderPass(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkRenderPassCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkRenderPass>*         pRenderPass)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateRenderPass, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pRenderPass));
+}
+
+void VulkanExportConsumer::Process_vkDestroyRenderPass(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            renderPass,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyRenderPass, false, 0, device, renderPass);
+}
+
+void VulkanExportConsumer::Process_vkGetRenderAreaGranularity(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            renderPass,
+    StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRenderAreaGranularity, false, 0, device, renderPass);
+}
+
+void VulkanExportConsumer::Process_vkCreateCommandPool(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkCommandPoolCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkCommandPool>*        pCommandPool)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateCommandPool, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pCommandPool));
+}
+
+void VulkanExportConsumer::Process_vkDestroyCommandPool(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            commandPool,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyCommandPool, false, 0, device, commandPool);
+}
+
+void VulkanExportConsumer::Process_vkResetCommandPool(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            commandPool,
+    VkCommandPoolResetFlags                     flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetCommandPool, true, static_cast<int64_t>(returnValue), device, commandPool);
+}
+
+void VulkanExportConsumer::Process_vkAllocateCommandBuffers(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
+    HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAllocateCommandBuffers, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pCommandBuffers));
+}
+
+void VulkanExportConsumer::Process_vkFreeCommandBuffers(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            commandPool,
+    uint32_t                                    commandBufferCount,
+    HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkFreeCommandBuffers, false, 0, device, commandPool);
+}
+
+void VulkanExportConsumer::Process_vkBeginCommandBuffer(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBeginCommandBuffer, true, static_cast<int64_t>(returnValue), commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkEndCommandBuffer(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkEndCommandBuffer, true, static_cast<int64_t>(returnValue), commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkResetCommandBuffer(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            commandBuffer,
+    VkCommandBufferResetFlags                   flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetCommandBuffer, true, static_cast<int64_t>(returnValue), commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindPipeline(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    format::HandleId                            pipeline)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindPipeline, false, 0, commandBuffer, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetViewport(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    StructPointerDecoder<Decoded_VkViewport>*   pViewports)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetViewport, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetScissor(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstScissor,
+    uint32_t                                    scissorCount,
+    StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetScissor, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetLineWidth(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    float                                       lineWidth)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetLineWidth, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthBias(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    float                                       depthBiasConstantFactor,
+    float                                       depthBiasClamp,
+    float                                       depthBiasSlopeFactor)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthBias, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetBlendConstants(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    PointerDecoder<float>*                      blendConstants)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetBlendConstants, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthBounds(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    float                                       minDepthBounds,
+    float                                       maxDepthBounds)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthBounds, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilCompareMask(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    compareMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilWriteMask(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    writeMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilReference(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    reference)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilReference, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindDescriptorSets(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    format::HandleId                            layout,
+    uint32_t                                    firstSet,
+    uint32_t                                    descriptorSetCount,
+    HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets,
+    uint32_t                                    dynamicOffsetCount,
+    PointerDecoder<uint32_t>*                   pDynamicOffsets)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindDescriptorSets, false, 0, commandBuffer, layout);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindIndexBuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    VkIndexType                                 indexType)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindIndexBuffer, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindVertexBuffers(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    HandlePointerDecoder<VkBuffer>*             pBuffers,
+    PointerDecoder<VkDeviceSize>*               pOffsets)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindVertexBuffers, false, 0, commandBuffer, GetFirstHandleId(pBuffers));
+}
+
+void VulkanExportConsumer::Process_vkCmdDraw(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    vertexCount,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstVertex,
+    uint32_t                                    firstInstance)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDraw, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndexed(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    indexCount,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstIndex,
+    int32_t                                     vertexOffset,
+    uint32_t                                    firstInstance)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndexed, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndirect(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndirect, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndexedIndirect(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdDispatch(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDispatch, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDispatchIndirect(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDispatchIndirect, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyBuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            srcBuffer,
+    format::HandleId                            dstBuffer,
+    uint32_t                                    regionCount,
+    StructPointerDecoder<Decoded_VkBufferCopy>* pRegions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyBuffer, false, 0, commandBuffer, srcBuffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            srcImage,
+    VkImageLayout                               srcImageLayout,
+    format::HandleId                            dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    StructPointerDecoder<Decoded_VkImageCopy>*  pRegions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyImage, false, 0, commandBuffer, srcImage);
+}
+
+void VulkanExportConsumer::Process_vkCmdBlitImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            srcImage,
+    VkImageLayout                               srcImageLayout,
+    format::HandleId                            dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    StructPointerDecoder<Decoded_VkImageBlit>*  pRegions,
+    VkFilter                                    filter)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBlitImage, false, 0, commandBuffer, srcImage);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyBufferToImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            srcBuffer,
+    format::HandleId                            dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyBufferToImage, false, 0, commandBuffer, srcBuffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyImageToBuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            srcImage,
+    VkImageLayout                               srcImageLayout,
+    format::HandleId                            dstBuffer,
+    uint32_t                                    regionCount,
+    StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer, false, 0, commandBuffer, srcImage);
+}
+
+void VulkanExportConsumer::Process_vkCmdUpdateBuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                dataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdUpdateBuffer, false, 0, commandBuffer, dstBuffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdFillBuffer(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                size,
+    uint32_t                                    data)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdFillBuffer, false, 0, commandBuffer, dstBuffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdClearColorImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            image,
+    VkImageLayout                               imageLayout,
+    StructPointerDecoder<Decoded_VkClearColorValue>* pColor,
+    uint32_t                                    rangeCount,
+    StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdClearColorImage, false, 0, commandBuffer, image);
+}
+
+void VulkanExportConsumer::Process_vkCmdClearDepthStencilImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            image,
+    VkImageLayout                               imageLayout,
+    StructPointerDecoder<Decoded_VkClearDepthStencilValue>* pDepthStencil,
+    uint32_t                                    rangeCount,
+    StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage, false, 0, commandBuffer, image);
+}
+
+void VulkanExportConsumer::Process_vkCmdClearAttachments(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    attachmentCount,
+    StructPointerDecoder<Decoded_VkClearAttachment>* pAttachments,
+    uint32_t                                    rectCount,
+    StructPointerDecoder<Decoded_VkClearRect>*  pRects)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdClearAttachments, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdResolveImage(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            srcImage,
+    VkImageLayout                               srcImageLayout,
+    format::HandleId                            dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    StructPointerDecoder<Decoded_VkImageResolve>* pRegions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResolveImage, false, 0, commandBuffer, srcImage);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetEvent(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            event,
+    VkPipelineStageFlags                        stageMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetEvent, false, 0, commandBuffer, event);
+}
+
+void VulkanExportConsumer::Process_vkCmdResetEvent(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            event,
+    VkPipelineStageFlags                        stageMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResetEvent, false, 0, commandBuffer, event);
+}
+
+void VulkanExportConsumer::Process_vkCmdWaitEvents(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    eventCount,
+    HandlePointerDecoder<VkEvent>*              pEvents,
+    VkPipelineStageFlags                        srcStageMask,
+    VkPipelineStageFlags                        dstStageMask,
+    uint32_t                                    memoryBarrierCount,
+    StructPointerDecoder<Decoded_VkMemoryBarrier>* pMemoryBarriers,
+    uint32_t                                    bufferMemoryBarrierCount,
+    StructPointerDecoder<Decoded_VkBufferMemoryBarrier>* pBufferMemoryBarriers,
+    uint32_t                                    imageMemoryBarrierCount,
+    StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWaitEvents, false, 0, commandBuffer, GetFirstHandleId(pEvents));
+}
+
+void VulkanExportConsumer::Process_vkCmdPipelineBarrier(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineStageFlags                        srcStageMask,
+    VkPipelineStageFlags                        dstStageMask,
+    VkDependencyFlags                           dependencyFlags,
+    uint32_t                                    memoryBarrierCount,
+    StructPointerDecoder<Decoded_VkMemoryBarrier>* pMemoryBarriers,
+    uint32_t                                    bufferMemoryBarrierCount,
+    StructPointerDecoder<Decoded_VkBufferMemoryBarrier>* pBufferMemoryBarriers,
+    uint32_t                                    imageMemoryBarrierCount,
+    StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdPipelineBarrier, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginQuery(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            queryPool,
+    uint32_t                                    query,
+    VkQueryControlFlags                         flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginQuery, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndQuery(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            queryPool,
+    uint32_t                                    query)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndQuery, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdResetQueryPool(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResetQueryPool, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteTimestamp(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineStageFlagBits                     pipelineStage,
+    format::HandleId                            queryPool,
+    uint32_t                                    query)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteTimestamp, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyQueryPoolResults(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount,
+    format::HandleId                            dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                stride,
+    VkQueryResultFlags                          flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdPushConstants(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            layout,
+    VkShaderStageFlags                          stageFlags,
+    uint32_t                                    offset,
+    uint32_t                                    size,
+    PointerDecoder<uint8_t>*                    pValues)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdPushConstants, false, 0, commandBuffer, layout);
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginRenderPass(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+    VkSubpassContents                           contents)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginRenderPass, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdNextSubpass(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkSubpassContents                           contents)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdNextSubpass, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndRenderPass(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndRenderPass, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdExecuteCommands(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    commandBufferCount,
+    HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdExecuteCommands, false, 0, commandBuffer, GetFirstHandleId(pCommandBuffers));
+}
+
+void VulkanExportConsumer::Process_vkBindBufferMemory2(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    bindInfoCount,
+    StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindBufferMemory2, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkBindImageMemory2(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    bindInfoCount,
+    StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindImageMemory2, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    uint32_t                                    heapIndex,
+    uint32_t                                    localDeviceIndex,
+    uint32_t                                    remoteDeviceIndex,
+    PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDeviceMask(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    deviceMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDeviceMask, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDispatchBase(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    baseGroupX,
+    uint32_t                                    baseGroupY,
+    uint32_t                                    baseGroupZ,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDispatchBase, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkEnumeratePhysicalDeviceGroups(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups, true, static_cast<int64_t>(returnValue), instance, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetImageMemoryRequirements2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferMemoryRequirements2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetImageSparseMemoryRequirements2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageSparseMemoryRequirementsInfo2>* pInfo,
+    PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
+    StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFeatures2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceProperties2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    VkFormat                                    format,
+    StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
+    StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
+    StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceSparseImageFormatInfo2>* pFormatInfo,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkTrimCommandPool(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            commandPool,
+    VkCommandPoolTrimFlags                      flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkTrimCommandPool, false, 0, device, commandPool);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceQueue2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+    HandlePointerDecoder<VkQueue>*              pQueue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceQueue2, false, 0, device, GetFirstHandleId(pQueue));
+}
+
+void VulkanExportConsumer::Process_vkCreateSamplerYcbcrConversion(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSamplerYcbcrConversionCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pYcbcrConversion));
+}
+
+void VulkanExportConsumer::Process_vkDestroySamplerYcbcrConversion(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            ycbcrConversion,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion, false, 0, device, ycbcrConversion);
+}
+
+void VulkanExportConsumer::Process_vkCreateDescriptorUpdateTemplate(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorUpdateTemplateCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pDescriptorUpdateTemplate));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDescriptorUpdateTemplate(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            descriptorUpdateTemplate,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate, false, 0, device, descriptorUpdateTemplate);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalBufferProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
+    StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalFenceProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
+    StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
+    StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDescriptorSetLayoutSupport(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndirectCount(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndirectCount, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndexedIndirectCount(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCreateRenderPass2(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkRenderPassCreateInfo2>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkRenderPass>*         pRenderPass)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateRenderPass2, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pRenderPass));
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginRenderPass2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+    StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginRenderPass2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdNextSubpass2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
+    StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdNextSubpass2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndRenderPass2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndRenderPass2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkResetQueryPool(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetQueryPool, false, 0, device, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkGetSemaphoreCounterValue(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            semaphore,
+    PointerDecoder<uint64_t>*                   pValue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue, true, static_cast<int64_t>(returnValue), device, semaphore);
+}
+
+void VulkanExportConsumer::Process_vkWaitSemaphores(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
+    uint64_t                                    timeout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkWaitSemaphores, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkSignalSemaphore(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSignalSemaphore, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferDeviceAddress(
+    const ApiCallInfo&                          call_info,
+    VkDeviceAddress                             returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferDeviceAddress, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferOpaqueCaptureAddress(
+    const ApiCallInfo&                          call_info,
+    uint64_t                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
+    const ApiCallInfo&                          call_info,
+    uint64_t                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceToolProperties(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pToolCount,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolProperties, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreatePrivateDataSlot(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPrivateDataSlotCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreatePrivateDataSlot, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pPrivateDataSlot));
+}
+
+void VulkanExportConsumer::Process_vkDestroyPrivateDataSlot(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            privateDataSlot,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot, false, 0, device, privateDataSlot);
+}
+
+void VulkanExportConsumer::Process_vkSetPrivateData(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    format::HandleId                            privateDataSlot,
+    uint64_t                                    data)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetPrivateData, true, static_cast<int64_t>(returnValue), device, privateDataSlot);
+}
+
+void VulkanExportConsumer::Process_vkGetPrivateData(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    format::HandleId                            privateDataSlot,
+    PointerDecoder<uint64_t>*                   pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPrivateData, false, 0, device, privateDataSlot);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetEvent2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            event,
+    StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetEvent2, false, 0, commandBuffer, event);
+}
+
+void VulkanExportConsumer::Process_vkCmdResetEvent2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            event,
+    VkPipelineStageFlags2                       stageMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResetEvent2, false, 0, commandBuffer, event);
+}
+
+void VulkanExportConsumer::Process_vkCmdWaitEvents2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    eventCount,
+    HandlePointerDecoder<VkEvent>*              pEvents,
+    StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWaitEvents2, false, 0, commandBuffer, GetFirstHandleId(pEvents));
+}
+
+void VulkanExportConsumer::Process_vkCmdPipelineBarrier2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdPipelineBarrier2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteTimestamp2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineStageFlags2                       stage,
+    format::HandleId                            queryPool,
+    uint32_t                                    query)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteTimestamp2, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkQueueSubmit2(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue,
+    uint32_t                                    submitCount,
+    StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
+    format::HandleId                            fence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueSubmit2, true, static_cast<int64_t>(returnValue), queue, fence);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyBuffer2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyBuffer2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyImage2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyImage2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyBufferToImage2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyImageToBuffer2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBlitImage2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBlitImage2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdResolveImage2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResolveImage2, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginRendering(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginRendering, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndRendering(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndRendering, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetCullMode(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkCullModeFlags                             cullMode)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetCullMode, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetFrontFace(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkFrontFace                                 frontFace)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetFrontFace, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPrimitiveTopology(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPrimitiveTopology                         primitiveTopology)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopology, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetViewportWithCount(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    viewportCount,
+    StructPointerDecoder<Decoded_VkViewport>*   pViewports)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetViewportWithCount, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetScissorWithCount(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    scissorCount,
+    StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetScissorWithCount, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindVertexBuffers2(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    HandlePointerDecoder<VkBuffer>*             pBuffers,
+    PointerDecoder<VkDeviceSize>*               pOffsets,
+    PointerDecoder<VkDeviceSize>*               pSizes,
+    PointerDecoder<VkDeviceSize>*               pStrides)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2, false, 0, commandBuffer, GetFirstHandleId(pBuffers));
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthTestEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthTestEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthTestEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthWriteEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthWriteEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthCompareOp(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkCompareOp                                 depthCompareOp)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthCompareOp, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthBoundsTestEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthBoundsTestEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilTestEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    stencilTestEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilTestEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilOp(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    VkStencilOp                                 failOp,
+    VkStencilOp                                 passOp,
+    VkStencilOp                                 depthFailOp,
+    VkCompareOp                                 compareOp)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilOp, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetRasterizerDiscardEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    rasterizerDiscardEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthBiasEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthBiasEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPrimitiveRestartEnable(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    primitiveRestartEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnable, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceBufferMemoryRequirements(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceBufferMemoryRequirements, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceImageMemoryRequirements(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceImageMemoryRequirements, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceImageSparseMemoryRequirements(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
+    PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
+    StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceImageSparseMemoryRequirements, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkDestroySurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            instance,
+    format::HandleId                            surface,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroySurfaceKHR, false, 0, instance, surface);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    format::HandleId                            surface,
+    PointerDecoder<VkBool32>*                   pSupported)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR, true, static_cast<int64_t>(returnValue), physicalDevice, surface);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            surface,
+    StructPointerDecoder<Decoded_VkSurfaceCapabilitiesKHR>* pSurfaceCapabilities)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, surface);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            surface,
+    PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
+    StructPointerDecoder<Decoded_VkSurfaceFormatKHR>* pSurfaceFormats)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR, true, static_cast<int64_t>(returnValue), physicalDevice, surface);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            surface,
+    PointerDecoder<uint32_t>*                   pPresentModeCount,
+    PointerDecoder<VkPresentModeKHR>*           pPresentModes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, surface);
+}
+
+void VulkanExportConsumer::Process_vkCreateSwapchainKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSwapchainCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSwapchainKHR>*       pSwapchain)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateSwapchainKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pSwapchain));
+}
+
+void VulkanExportConsumer::Process_vkDestroySwapchainKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroySwapchainKHR, false, 0, device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkGetSwapchainImagesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    PointerDecoder<uint32_t>*                   pSwapchainImageCount,
+    HandlePointerDecoder<VkImage>*              pSwapchainImages)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSwapchainImagesKHR, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkAcquireNextImageKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    uint64_t                                    timeout,
+    format::HandleId                            semaphore,
+    format::HandleId                            fence,
+    PointerDecoder<uint32_t>*                   pImageIndex)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireNextImageKHR, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkQueuePresentKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue,
+    StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueuePresentKHR, true, static_cast<int64_t>(returnValue), queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceGroupPresentCapabilitiesKHR>* pDeviceGroupPresentCapabilities)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            surface,
+    PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR, true, static_cast<int64_t>(returnValue), device, surface);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            surface,
+    PointerDecoder<uint32_t>*                   pRectCount,
+    StructPointerDecoder<Decoded_VkRect2D>*     pRects)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, surface);
+}
+
+void VulkanExportConsumer::Process_vkAcquireNextImage2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
+    PointerDecoder<uint32_t>*                   pImageIndex)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireNextImage2KHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkDisplayPropertiesKHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkDisplayPlanePropertiesKHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    planeIndex,
+    PointerDecoder<uint32_t>*                   pDisplayCount,
+    HandlePointerDecoder<VkDisplayKHR>*         pDisplays)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR, true, static_cast<int64_t>(returnValue), physicalDevice, GetFirstHandleId(pDisplays));
+}
+
+void VulkanExportConsumer::Process_vkGetDisplayModePropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            display,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkDisplayModePropertiesKHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkCreateDisplayModeKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            display,
+    StructPointerDecoder<Decoded_VkDisplayModeCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDisplayModeKHR>*     pMode)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDisplayModeKHR, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            mode,
+    uint32_t                                    planeIndex,
+    StructPointerDecoder<Decoded_VkDisplayPlaneCapabilitiesKHR>* pCapabilities)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, mode);
+}
+
+void VulkanExportConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkDisplaySurfaceCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkCreateSharedSwapchainsKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    swapchainCount,
+    StructPointerDecoder<Decoded_VkSwapchainCreateInfoKHR>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pSwapchains));
+}
+
+void VulkanExportConsumer::Process_vkCreateXlibSurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkXlibSurfaceCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(
+    const ApiCallInfo&                          call_info,
+    VkBool32                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    uint64_t                                    dpy,
+    size_t                                      visualID)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateXcbSurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkXcbSurfaceCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(
+    const ApiCallInfo&                          call_info,
+    VkBool32                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    uint64_t                                    connection,
+    uint32_t                                    visual_id)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateWaylandSurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkWaylandSurfaceCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
+    const ApiCallInfo&                          call_info,
+    VkBool32                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    uint64_t                                    display)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateAndroidSurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkAndroidSurfaceCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkCreateWin32SurfaceKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkWin32SurfaceCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceWin32PresentationSupportKHR(
+    const ApiCallInfo&                          call_info,
+    VkBool32                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginRenderingKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginRenderingKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndRenderingKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndRenderingKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    VkFormat                                    format,
+    StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
+    StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
+    StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceSparseImageFormatInfo2>* pFormatInfo,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    uint32_t                                    heapIndex,
+    uint32_t                                    localDeviceIndex,
+    uint32_t                                    remoteDeviceIndex,
+    PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDeviceMaskKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    deviceMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDispatchBaseKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    baseGroupX,
+    uint32_t                                    baseGroupY,
+    uint32_t                                    baseGroupZ,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkTrimCommandPoolKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            commandPool,
+    VkCommandPoolTrimFlags                      flags)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkTrimCommandPoolKHR, false, 0, device, commandPool);
+}
+
+void VulkanExportConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR, true, static_cast<int64_t>(returnValue), instance, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
+    StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryWin32HandleKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkMemoryGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
+    PointerDecoder<uint64_t, void*>*            pHandle)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    uint64_t                                    handle,
+    StructPointerDecoder<Decoded_VkMemoryWin32HandlePropertiesKHR>* pMemoryWin32HandleProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryFdKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkMemoryGetFdInfoKHR>* pGetFdInfo,
+    PointerDecoder<int>*                        pFd)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryFdKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryFdPropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    int                                         fd,
+    StructPointerDecoder<Decoded_VkMemoryFdPropertiesKHR>* pMemoryFdProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
+    StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkImportSemaphoreWin32HandleKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetSemaphoreWin32HandleKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
+    PointerDecoder<uint64_t, void*>*            pHandle)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkImportSemaphoreFdKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetSemaphoreFdKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
+    PointerDecoder<int>*                        pFd)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdPushDescriptorSetKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    format::HandleId                            layout,
+    uint32_t                                    set,
+    uint32_t                                    descriptorWriteCount,
+    StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR, false, 0, commandBuffer, layout);
+}
+
+void VulkanExportConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorUpdateTemplateCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pDescriptorUpdateTemplate));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            descriptorUpdateTemplate,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR, false, 0, device, descriptorUpdateTemplate);
+}
+
+void VulkanExportConsumer::Process_vkCreateRenderPass2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkRenderPassCreateInfo2>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkRenderPass>*         pRenderPass)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateRenderPass2KHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pRenderPass));
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginRenderPass2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
+    StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdNextSubpass2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
+    StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndRenderPass2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetSwapchainStatusKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSwapchainStatusKHR, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
+    StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkImportFenceWin32HandleKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImportFenceWin32HandleInfoKHR>* pImportFenceWin32HandleInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetFenceWin32HandleKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkFenceGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
+    PointerDecoder<uint64_t, void*>*            pHandle)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkImportFenceFdKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImportFenceFdInfoKHR>* pImportFenceFdInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkImportFenceFdKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetFenceFdKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkFenceGetFdInfoKHR>* pGetFdInfo,
+    PointerDecoder<int>*                        pFd)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetFenceFdKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    PointerDecoder<uint32_t>*                   pCounterCount,
+    StructPointerDecoder<Decoded_VkPerformanceCounterKHR>* pCounters,
+    StructPointerDecoder<Decoded_VkPerformanceCounterDescriptionKHR>* pCounterDescriptions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkQueryPoolPerformanceCreateInfoKHR>* pPerformanceQueryCreateInfo,
+    PointerDecoder<uint32_t>*                   pNumPasses)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkAcquireProfilingLockKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAcquireProfilingLockInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkReleaseProfilingLockKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkReleaseProfilingLockKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
+    StructPointerDecoder<Decoded_VkSurfaceCapabilities2KHR>* pSurfaceCapabilities)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
+    PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
+    StructPointerDecoder<Decoded_VkSurfaceFormat2KHR>* pSurfaceFormats)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkDisplayProperties2KHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkDisplayPlaneProperties2KHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDisplayModeProperties2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            display,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkDisplayModeProperties2KHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkDisplayPlaneInfo2KHR>* pDisplayPlaneInfo,
+    StructPointerDecoder<Decoded_VkDisplayPlaneCapabilities2KHR>* pCapabilities)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetImageMemoryRequirements2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferMemoryRequirements2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageSparseMemoryRequirementsInfo2>* pInfo,
+    PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
+    StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSamplerYcbcrConversionCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pYcbcrConversion));
+}
+
+void VulkanExportConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            ycbcrConversion,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR, false, 0, device, ycbcrConversion);
+}
+
+void VulkanExportConsumer::Process_vkBindBufferMemory2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    bindInfoCount,
+    StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindBufferMemory2KHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkBindImageMemory2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    bindInfoCount,
+    StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindImageMemory2KHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndirectCountKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkGetSemaphoreCounterValueKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            semaphore,
+    PointerDecoder<uint64_t>*                   pValue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR, true, static_cast<int64_t>(returnValue), device, semaphore);
+}
+
+void VulkanExportConsumer::Process_vkWaitSemaphoresKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
+    uint64_t                                    timeout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkWaitSemaphoresKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkSignalSemaphoreKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSignalSemaphoreKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pFragmentShadingRateCount,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceFragmentShadingRateKHR>* pFragmentShadingRates)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceFragmentShadingRatesKHR, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetFragmentShadingRateKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkExtent2D>*   pFragmentSize,
+    PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkWaitForPresentKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    uint64_t                                    presentId,
+    uint64_t                                    timeout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkWaitForPresentKHR, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferDeviceAddressKHR(
+    const ApiCallInfo&                          call_info,
+    VkDeviceAddress                             returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
+    const ApiCallInfo&                          call_info,
+    uint64_t                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
+    const ApiCallInfo&                          call_info,
+    uint64_t                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateDeferredOperationKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDeferredOperationKHR>* pDeferredOperation)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pDeferredOperation));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDeferredOperationKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            operation,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR, false, 0, device, operation);
+}
+
+void VulkanExportConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
+    const ApiCallInfo&                          call_info,
+    uint32_t                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            operation)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR, true, static_cast<int64_t>(returnValue), device, operation);
+}
+
+void VulkanExportConsumer::Process_vkGetDeferredOperationResultKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            operation)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeferredOperationResultKHR, true, static_cast<int64_t>(returnValue), device, operation);
+}
+
+void VulkanExportConsumer::Process_vkDeferredOperationJoinKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            operation)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDeferredOperationJoinKHR, true, static_cast<int64_t>(returnValue), device, operation);
+}
+
+void VulkanExportConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPipelineInfoKHR>* pPipelineInfo,
+    PointerDecoder<uint32_t>*                   pExecutableCount,
+    StructPointerDecoder<Decoded_VkPipelineExecutablePropertiesKHR>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPipelineExecutableInfoKHR>* pExecutableInfo,
+    PointerDecoder<uint32_t>*                   pStatisticCount,
+    StructPointerDecoder<Decoded_VkPipelineExecutableStatisticKHR>* pStatistics)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPipelineExecutableInternalRepresentationsKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPipelineExecutableInfoKHR>* pExecutableInfo,
+    PointerDecoder<uint32_t>*                   pInternalRepresentationCount,
+    StructPointerDecoder<Decoded_VkPipelineExecutableInternalRepresentationKHR>* pInternalRepresentations)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetEvent2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            event,
+    StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetEvent2KHR, false, 0, commandBuffer, event);
+}
+
+void VulkanExportConsumer::Process_vkCmdResetEvent2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            event,
+    VkPipelineStageFlags2                       stageMask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResetEvent2KHR, false, 0, commandBuffer, event);
+}
+
+void VulkanExportConsumer::Process_vkCmdWaitEvents2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    eventCount,
+    HandlePointerDecoder<VkEvent>*              pEvents,
+    StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR, false, 0, commandBuffer, GetFirstHandleId(pEvents));
+}
+
+void VulkanExportConsumer::Process_vkCmdPipelineBarrier2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteTimestamp2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineStageFlags2                       stage,
+    format::HandleId                            queryPool,
+    uint32_t                                    query)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkQueueSubmit2KHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue,
+    uint32_t                                    submitCount,
+    StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
+    format::HandleId                            fence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueSubmit2KHR, true, static_cast<int64_t>(returnValue), queue, fence);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteBufferMarker2AMD(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineStageFlags2                       stage,
+    format::HandleId                            dstBuffer,
+    VkDeviceSize                                dstOffset,
+    uint32_t                                    marker)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD, false, 0, commandBuffer, dstBuffer);
+}
+
+void VulkanExportConsumer::Process_vkGetQueueCheckpointData2NV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            queue,
+    PointerDecoder<uint32_t>*                   pCheckpointDataCount,
+    StructPointerDecoder<Decoded_VkCheckpointData2NV>* pCheckpointData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetQueueCheckpointData2NV, false, 0, queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyBuffer2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyImage2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyImage2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyBufferToImage2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyImageToBuffer2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBlitImage2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBlitImage2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdResolveImage2KHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdResolveImage2KHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceBufferMemoryRequirementsKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceBufferMemoryRequirementsKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceImageMemoryRequirementsKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceImageMemoryRequirementsKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceImageSparseMemoryRequirementsKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
+    PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
+    StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceImageSparseMemoryRequirementsKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateDebugReportCallbackEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkDebugReportCallbackCreateInfoEXT>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDebugReportCallbackEXT>* pCallback)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pCallback));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDebugReportCallbackEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            instance,
+    format::HandleId                            callback,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT, false, 0, instance, callback);
+}
+
+void VulkanExportConsumer::Process_vkDebugReportMessageEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            instance,
+    VkDebugReportFlagsEXT                       flags,
+    VkDebugReportObjectTypeEXT                  objectType,
+    uint64_t                                    object,
+    size_t                                      location,
+    int32_t                                     messageCode,
+    StringDecoder*                              pLayerPrefix,
+    StringDecoder*                              pMessage)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDebugReportMessageEXT, false, 0, instance, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkDebugMarkerSetObjectTagEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDebugMarkerObjectTagInfoEXT>* pTagInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkDebugMarkerSetObjectNameEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDebugMarkerObjectNameInfoEXT>* pNameInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDebugMarkerBeginEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDebugMarkerEndEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDebugMarkerInsertEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    HandlePointerDecoder<VkBuffer>*             pBuffers,
+    PointerDecoder<VkDeviceSize>*               pOffsets,
+    PointerDecoder<VkDeviceSize>*               pSizes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT, false, 0, commandBuffer, GetFirstHandleId(pBuffers));
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginTransformFeedbackEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstCounterBuffer,
+    uint32_t                                    counterBufferCount,
+    HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
+    PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT, false, 0, commandBuffer, GetFirstHandleId(pCounterBuffers));
+}
+
+void VulkanExportConsumer::Process_vkCmdEndTransformFeedbackEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstCounterBuffer,
+    uint32_t                                    counterBufferCount,
+    HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
+    PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT, false, 0, commandBuffer, GetFirstHandleId(pCounterBuffers));
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginQueryIndexedEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            queryPool,
+    uint32_t                                    query,
+    VkQueryControlFlags                         flags,
+    uint32_t                                    index)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndQueryIndexedEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            queryPool,
+    uint32_t                                    query,
+    uint32_t                                    index)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndirectByteCountEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstInstance,
+    format::HandleId                            counterBuffer,
+    VkDeviceSize                                counterBufferOffset,
+    uint32_t                                    counterOffset,
+    uint32_t                                    vertexStride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT, false, 0, commandBuffer, counterBuffer);
+}
+
+void VulkanExportConsumer::Process_vkGetImageViewHandleNVX(
+    const ApiCallInfo&                          call_info,
+    uint32_t                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImageViewHandleInfoNVX>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageViewHandleNVX, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetImageViewAddressNVX(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            imageView,
+    StructPointerDecoder<Decoded_VkImageViewAddressPropertiesNVX>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageViewAddressNVX, true, static_cast<int64_t>(returnValue), device, imageView);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndirectCountAMD(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkGetShaderInfoAMD(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    VkShaderStageFlagBits                       shaderStage,
+    VkShaderInfoTypeAMD                         infoType,
+    PointerDecoder<size_t>*                     pInfoSize,
+    PointerDecoder<uint8_t>*                    pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetShaderInfoAMD, true, static_cast<int64_t>(returnValue), device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkStreamDescriptorSurfaceCreateInfoGGP>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    VkFormat                                    format,
+    VkImageType                                 type,
+    VkImageTiling                               tiling,
+    VkImageUsageFlags                           usage,
+    VkImageCreateFlags                          flags,
+    VkExternalMemoryHandleTypeFlagsNV           externalHandleType,
+    StructPointerDecoder<Decoded_VkExternalImageFormatPropertiesNV>* pExternalImageFormatProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryWin32HandleNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            memory,
+    VkExternalMemoryHandleTypeFlagsNV           handleType,
+    PointerDecoder<uint64_t, void*>*            pHandle)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryWin32HandleNV, true, static_cast<int64_t>(returnValue), device, memory);
+}
+
+void VulkanExportConsumer::Process_vkCreateViSurfaceNN(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkViSurfaceCreateInfoNN>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateViSurfaceNN, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginConditionalRenderingEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkConditionalRenderingBeginInfoEXT>* pConditionalRenderingBegin)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndConditionalRenderingEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetViewportWScalingNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    StructPointerDecoder<Decoded_VkViewportWScalingNV>* pViewportWScalings)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkReleaseDisplayEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            display)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkReleaseDisplayEXT, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkAcquireXlibDisplayEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint64_t                                    dpy,
+    format::HandleId                            display)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireXlibDisplayEXT, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkGetRandROutputDisplayEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint64_t                                    dpy,
+    size_t                                      rrOutput,
+    HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRandROutputDisplayEXT, true, static_cast<int64_t>(returnValue), physicalDevice, GetFirstHandleId(pDisplay));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            surface,
+    StructPointerDecoder<Decoded_VkSurfaceCapabilities2EXT>* pSurfaceCapabilities)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT, true, static_cast<int64_t>(returnValue), physicalDevice, surface);
+}
+
+void VulkanExportConsumer::Process_vkDisplayPowerControlEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            display,
+    StructPointerDecoder<Decoded_VkDisplayPowerInfoEXT>* pDisplayPowerInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDisplayPowerControlEXT, true, static_cast<int64_t>(returnValue), device, display);
+}
+
+void VulkanExportConsumer::Process_vkRegisterDeviceEventEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDeviceEventInfoEXT>* pDeviceEventInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkFence>*              pFence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pFence));
+}
+
+void VulkanExportConsumer::Process_vkRegisterDisplayEventEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            display,
+    StructPointerDecoder<Decoded_VkDisplayEventInfoEXT>* pDisplayEventInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkFence>*              pFence)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT, true, static_cast<int64_t>(returnValue), device, display);
+}
+
+void VulkanExportConsumer::Process_vkGetSwapchainCounterEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    VkSurfaceCounterFlagBitsEXT                 counter,
+    PointerDecoder<uint64_t>*                   pCounterValue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSwapchainCounterEXT, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkGetPastPresentationTimingGOOGLE(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain,
+    PointerDecoder<uint32_t>*                   pPresentationTimingCount,
+    StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDiscardRectangleEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstDiscardRectangle,
+    uint32_t                                    discardRectangleCount,
+    StructPointerDecoder<Decoded_VkRect2D>*     pDiscardRectangles)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkSetHdrMetadataEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    uint32_t                                    swapchainCount,
+    HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains,
+    StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetHdrMetadataEXT, false, 0, device, GetFirstHandleId(pSwapchains));
+}
+
+void VulkanExportConsumer::Process_vkCreateIOSSurfaceMVK(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkIOSSurfaceCreateInfoMVK>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkCreateMacOSSurfaceMVK(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkMacOSSurfaceCreateInfoMVK>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkSetDebugUtilsObjectNameEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDebugUtilsObjectNameInfoEXT>* pNameInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkSetDebugUtilsObjectTagEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkDebugUtilsObjectTagInfoEXT>* pTagInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            queue,
+    StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT, false, 0, queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkQueueEndDebugUtilsLabelEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            queue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT, false, 0, queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            queue,
+    StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT, false, 0, queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdEndDebugUtilsLabelEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateDebugUtilsMessengerEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkDebugUtilsMessengerCreateInfoEXT>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkDebugUtilsMessengerEXT>* pMessenger)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pMessenger));
+}
+
+void VulkanExportConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            instance,
+    format::HandleId                            messenger,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT, false, 0, instance, messenger);
+}
+
+void VulkanExportConsumer::Process_vkSubmitDebugUtilsMessageEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            instance,
+    VkDebugUtilsMessageSeverityFlagBitsEXT      messageSeverity,
+    VkDebugUtilsMessageTypeFlagsEXT             messageTypes,
+    StructPointerDecoder<Decoded_VkDebugUtilsMessengerCallbackDataEXT>* pCallbackData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT, false, 0, instance, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDROID(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint64_t                                    buffer,
+    StructPointerDecoder<Decoded_VkAndroidHardwareBufferPropertiesANDROID>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID>* pInfo,
+    PointerDecoder<uint64_t, void*>*            pBuffer)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetSampleLocationsEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkSampleLocationsInfoEXT>* pSampleLocationsInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            physicalDevice,
+    VkSampleCountFlagBits                       samples,
+    StructPointerDecoder<Decoded_VkMultisamplePropertiesEXT>* pMultisampleProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT, false, 0, physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            image,
+    StructPointerDecoder<Decoded_VkImageDrmFormatModifierPropertiesEXT>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT, true, static_cast<int64_t>(returnValue), device, image);
+}
+
+void VulkanExportConsumer::Process_vkCreateValidationCacheEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkValidationCacheCreateInfoEXT>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkValidationCacheEXT>* pValidationCache)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateValidationCacheEXT, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pValidationCache));
+}
+
+void VulkanExportConsumer::Process_vkDestroyValidationCacheEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            validationCache,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT, false, 0, device, validationCache);
+}
+
+void VulkanExportConsumer::Process_vkMergeValidationCachesEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            dstCache,
+    uint32_t                                    srcCacheCount,
+    HandlePointerDecoder<VkValidationCacheEXT>* pSrcCaches)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkMergeValidationCachesEXT, true, static_cast<int64_t>(returnValue), device, dstCache);
+}
+
+void VulkanExportConsumer::Process_vkGetValidationCacheDataEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            validationCache,
+    PointerDecoder<size_t>*                     pDataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetValidationCacheDataEXT, true, static_cast<int64_t>(returnValue), device, validationCache);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindShadingRateImageNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            imageView,
+    VkImageLayout                               imageLayout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV, false, 0, commandBuffer, imageView);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    StructPointerDecoder<Decoded_VkShadingRatePaletteNV>* pShadingRatePalettes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetCoarseSampleOrderNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkCoarseSampleOrderTypeNV                   sampleOrderType,
+    uint32_t                                    customSampleOrderCount,
+    StructPointerDecoder<Decoded_VkCoarseSampleOrderCustomNV>* pCustomSampleOrders)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateAccelerationStructureNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAccelerationStructureCreateInfoNV>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructure)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pAccelerationStructure));
+}
+
+void VulkanExportConsumer::Process_vkDestroyAccelerationStructureNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            accelerationStructure,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV, false, 0, device, accelerationStructure);
+}
+
+void VulkanExportConsumer::Process_vkGetAccelerationStructureMemoryRequirementsNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAccelerationStructureMemoryRequirementsInfoNV>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2KHR>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkBindAccelerationStructureMemoryNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    bindInfoCount,
+    StructPointerDecoder<Decoded_VkBindAccelerationStructureMemoryInfoNV>* pBindInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBuildAccelerationStructureNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkAccelerationStructureInfoNV>* pInfo,
+    format::HandleId                            instanceData,
+    VkDeviceSize                                instanceOffset,
+    VkBool32                                    update,
+    format::HandleId                            dst,
+    format::HandleId                            src,
+    format::HandleId                            scratch,
+    VkDeviceSize                                scratchOffset)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV, false, 0, commandBuffer, instanceData);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyAccelerationStructureNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            dst,
+    format::HandleId                            src,
+    VkCopyAccelerationStructureModeKHR          mode)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV, false, 0, commandBuffer, dst);
+}
+
+void VulkanExportConsumer::Process_vkCmdTraceRaysNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            raygenShaderBindingTableBuffer,
+    VkDeviceSize                                raygenShaderBindingOffset,
+    format::HandleId                            missShaderBindingTableBuffer,
+    VkDeviceSize                                missShaderBindingOffset,
+    VkDeviceSize                                missShaderBindingStride,
+    format::HandleId                            hitShaderBindingTableBuffer,
+    VkDeviceSize                                hitShaderBindingOffset,
+    VkDeviceSize                                hitShaderBindingStride,
+    format::HandleId                            callableShaderBindingTableBuffer,
+    VkDeviceSize                                callableShaderBindingOffset,
+    VkDeviceSize                                callableShaderBindingStride,
+    uint32_t                                    width,
+    uint32_t                                    height,
+    uint32_t                                    depth)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdTraceRaysNV, false, 0, commandBuffer, raygenShaderBindingTableBuffer);
+}
+
+void VulkanExportConsumer::Process_vkCreateRayTracingPipelinesNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipelineCache,
+    uint32_t                                    createInfoCount,
+    StructPointerDecoder<Decoded_VkRayTracingPipelineCreateInfoNV>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPipeline>*           pPipelines)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV, true, static_cast<int64_t>(returnValue), device, pipelineCache);
+}
+
+void VulkanExportConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    uint32_t                                    firstGroup,
+    uint32_t                                    groupCount,
+    size_t                                      dataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR, true, static_cast<int64_t>(returnValue), device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    uint32_t                                    firstGroup,
+    uint32_t                                    groupCount,
+    size_t                                      dataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV, true, static_cast<int64_t>(returnValue), device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkGetAccelerationStructureHandleNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            accelerationStructure,
+    size_t                                      dataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV, true, static_cast<int64_t>(returnValue), device, accelerationStructure);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    accelerationStructureCount,
+    HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructures,
+    VkQueryType                                 queryType,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCompileDeferredNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    uint32_t                                    shader)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCompileDeferredNV, true, static_cast<int64_t>(returnValue), device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    uint64_t                                    pHostPointer,
+    StructPointerDecoder<Decoded_VkMemoryHostPointerPropertiesEXT>* pMemoryHostPointerProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteBufferMarkerAMD(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineStageFlagBits                     pipelineStage,
+    format::HandleId                            dstBuffer,
+    VkDeviceSize                                dstOffset,
+    uint32_t                                    marker)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD, false, 0, commandBuffer, dstBuffer);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pTimeDomainCount,
+    PointerDecoder<VkTimeDomainEXT>*            pTimeDomains)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetCalibratedTimestampsEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    timestampCount,
+    StructPointerDecoder<Decoded_VkCalibratedTimestampInfoEXT>* pTimestampInfos,
+    PointerDecoder<uint64_t>*                   pTimestamps,
+    PointerDecoder<uint64_t>*                   pMaxDeviation)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawMeshTasksNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    taskCount,
+    uint32_t                                    firstTask)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            buffer,
+    VkDeviceSize                                offset,
+    format::HandleId                            countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV, false, 0, commandBuffer, buffer);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetExclusiveScissorNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstExclusiveScissor,
+    uint32_t                                    exclusiveScissorCount,
+    StructPointerDecoder<Decoded_VkRect2D>*     pExclusiveScissors)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetCheckpointNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint64_t                                    pCheckpointMarker)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetCheckpointNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetQueueCheckpointDataNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            queue,
+    PointerDecoder<uint32_t>*                   pCheckpointDataCount,
+    StructPointerDecoder<Decoded_VkCheckpointDataNV>* pCheckpointData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetQueueCheckpointDataNV, false, 0, queue, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkInitializePerformanceApiINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkInitializePerformanceApiInfoINTEL>* pInitializeInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkUninitializePerformanceApiINTEL(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkPerformanceMarkerInfoINTEL>* pMarkerInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL, true, static_cast<int64_t>(returnValue), commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkPerformanceStreamMarkerInfoINTEL>* pMarkerInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL, true, static_cast<int64_t>(returnValue), commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkPerformanceOverrideInfoINTEL>* pOverrideInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL, true, static_cast<int64_t>(returnValue), commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPerformanceConfigurationAcquireInfoINTEL>* pAcquireInfo,
+    HandlePointerDecoder<VkPerformanceConfigurationINTEL>* pConfiguration)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pConfiguration));
+}
+
+void VulkanExportConsumer::Process_vkReleasePerformanceConfigurationINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            configuration)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL, true, static_cast<int64_t>(returnValue), device, configuration);
+}
+
+void VulkanExportConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            queue,
+    format::HandleId                            configuration)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL, true, static_cast<int64_t>(returnValue), queue, configuration);
+}
+
+void VulkanExportConsumer::Process_vkGetPerformanceParameterINTEL(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkPerformanceParameterTypeINTEL             parameter,
+    StructPointerDecoder<Decoded_VkPerformanceValueINTEL>* pValue)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPerformanceParameterINTEL, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkSetLocalDimmingAMD(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            swapChain,
+    VkBool32                                    localDimmingEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetLocalDimmingAMD, false, 0, device, swapChain);
+}
+
+void VulkanExportConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkImagePipeSurfaceCreateInfoFUCHSIA>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkCreateMetalSurfaceEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkMetalSurfaceCreateInfoEXT>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetBufferDeviceAddressEXT(
+    const ApiCallInfo&                          call_info,
+    VkDeviceAddress                             returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pToolCount,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pPropertyCount,
+    StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesNV>* pProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    PointerDecoder<uint32_t>*                   pCombinationCount,
+    StructPointerDecoder<Decoded_VkFramebufferMixedSamplesCombinationNV>* pCombinations)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
+    PointerDecoder<uint32_t>*                   pPresentModeCount,
+    PointerDecoder<VkPresentModeKHR>*           pPresentModes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            swapchain)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT, true, static_cast<int64_t>(returnValue), device, swapchain);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
+    PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateHeadlessSurfaceEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkHeadlessSurfaceCreateInfoEXT>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkCmdSetLineStippleEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    lineStippleFactor,
+    uint16_t                                    lineStipplePattern)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkResetQueryPoolEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkResetQueryPoolEXT, false, 0, device, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetCullModeEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkCullModeFlags                             cullMode)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetCullModeEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetFrontFaceEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkFrontFace                                 frontFace)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPrimitiveTopology                         primitiveTopology)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetViewportWithCountEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    viewportCount,
+    StructPointerDecoder<Decoded_VkViewport>*   pViewports)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetScissorWithCountEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    scissorCount,
+    StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindVertexBuffers2EXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    HandlePointerDecoder<VkBuffer>*             pBuffers,
+    PointerDecoder<VkDeviceSize>*               pOffsets,
+    PointerDecoder<VkDeviceSize>*               pSizes,
+    PointerDecoder<VkDeviceSize>*               pStrides)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT, false, 0, commandBuffer, GetFirstHandleId(pBuffers));
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthTestEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthTestEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthWriteEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthWriteEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthCompareOpEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkCompareOp                                 depthCompareOp)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthBoundsTestEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilTestEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    stencilTestEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetStencilOpEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    VkStencilOp                                 failOp,
+    VkStencilOp                                 passOp,
+    VkStencilOp                                 depthFailOp,
+    VkCompareOp                                 compareOp)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV>* pInfo,
+    StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    isPreprocessed,
+    StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindPipelineShaderGroupNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    format::HandleId                            pipeline,
+    uint32_t                                    groupIndex)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV, false, 0, commandBuffer, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkCreateIndirectCommandsLayoutNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkIndirectCommandsLayoutCreateInfoNV>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkIndirectCommandsLayoutNV>* pIndirectCommandsLayout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pIndirectCommandsLayout));
+}
+
+void VulkanExportConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            indirectCommandsLayout,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV, false, 0, device, indirectCommandsLayout);
+}
+
+void VulkanExportConsumer::Process_vkAcquireDrmDisplayEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    int32_t                                     drmFd,
+    format::HandleId                            display)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireDrmDisplayEXT, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkGetDrmDisplayEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    int32_t                                     drmFd,
+    uint32_t                                    connectorId,
+    HandlePointerDecoder<VkDisplayKHR>*         display)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDrmDisplayEXT, true, static_cast<int64_t>(returnValue), physicalDevice, GetFirstHandleId(display));
+}
+
+void VulkanExportConsumer::Process_vkCreatePrivateDataSlotEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkPrivateDataSlotCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pPrivateDataSlot));
+}
+
+void VulkanExportConsumer::Process_vkDestroyPrivateDataSlotEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            privateDataSlot,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT, false, 0, device, privateDataSlot);
+}
+
+void VulkanExportConsumer::Process_vkSetPrivateDataEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    format::HandleId                            privateDataSlot,
+    uint64_t                                    data)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetPrivateDataEXT, true, static_cast<int64_t>(returnValue), device, privateDataSlot);
+}
+
+void VulkanExportConsumer::Process_vkGetPrivateDataEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    format::HandleId                            privateDataSlot,
+    PointerDecoder<uint64_t>*                   pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPrivateDataEXT, false, 0, device, privateDataSlot);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkFragmentShadingRateNV                     shadingRate,
+    PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkAcquireWinrtDisplayNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    format::HandleId                            display)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkAcquireWinrtDisplayNV, true, static_cast<int64_t>(returnValue), physicalDevice, display);
+}
+
+void VulkanExportConsumer::Process_vkGetWinrtDisplayNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    deviceRelativeId,
+    HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetWinrtDisplayNV, true, static_cast<int64_t>(returnValue), physicalDevice, GetFirstHandleId(pDisplay));
+}
+
+void VulkanExportConsumer::Process_vkCreateDirectFBSurfaceEXT(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkDirectFBSurfaceCreateInfoEXT>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(
+    const ApiCallInfo&                          call_info,
+    VkBool32                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    uint64_t                                    dfb)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetVertexInputEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    vertexBindingDescriptionCount,
+    StructPointerDecoder<Decoded_VkVertexInputBindingDescription2EXT>* pVertexBindingDescriptions,
+    uint32_t                                    vertexAttributeDescriptionCount,
+    StructPointerDecoder<Decoded_VkVertexInputAttributeDescription2EXT>* pVertexAttributeDescriptions)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkMemoryGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
+    PointerDecoder<uint32_t>*                   pZirconHandle)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryZirconHandleFUCHSIA, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    uint32_t                                    zirconHandle,
+    StructPointerDecoder<Decoded_VkMemoryZirconHandlePropertiesFUCHSIA>* pMemoryZirconHandleProperties)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryZirconHandlePropertiesFUCHSIA, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA>* pImportSemaphoreZirconHandleInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkImportSemaphoreZirconHandleFUCHSIA, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
+    PointerDecoder<uint32_t>*                   pZirconHandle)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetSemaphoreZirconHandleFUCHSIA, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBindInvocationMaskHUAWEI(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    format::HandleId                            imageView,
+    VkImageLayout                               imageLayout)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBindInvocationMaskHUAWEI, false, 0, commandBuffer, imageView);
+}
+
+void VulkanExportConsumer::Process_vkGetMemoryRemoteAddressNV(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkMemoryGetRemoteAddressInfoNV>* pMemoryGetRemoteAddressInfo,
+    PointerDecoder<uint64_t, void*>*            pAddress)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetMemoryRemoteAddressNV, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPatchControlPointsEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    patchControlPoints)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetRasterizerDiscardEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    rasterizerDiscardEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetDepthBiasEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    depthBiasEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetLogicOpEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkLogicOp                                   logicOp)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetPrimitiveRestartEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    VkBool32                                    primitiveRestartEnable)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateScreenSurfaceQNX(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            instance,
+    StructPointerDecoder<Decoded_VkScreenSurfaceCreateInfoQNX>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateScreenSurfaceQNX, true, static_cast<int64_t>(returnValue), instance, GetFirstHandleId(pSurface));
+}
+
+void VulkanExportConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupportQNX(
+    const ApiCallInfo&                          call_info,
+    VkBool32                                    returnValue,
+    format::HandleId                            physicalDevice,
+    uint32_t                                    queueFamilyIndex,
+    uint64_t                                    window)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetPhysicalDeviceScreenPresentationSupportQNX, true, static_cast<int64_t>(returnValue), physicalDevice, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetColorWriteEnableEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    attachmentCount,
+    PointerDecoder<VkBool32>*                   pColorWriteEnables)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawMultiEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    drawCount,
+    StructPointerDecoder<Decoded_VkMultiDrawInfoEXT>* pVertexInfo,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstInstance,
+    uint32_t                                    stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawMultiEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdDrawMultiIndexedEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    drawCount,
+    StructPointerDecoder<Decoded_VkMultiDrawIndexedInfoEXT>* pIndexInfo,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstInstance,
+    uint32_t                                    stride,
+    PointerDecoder<int32_t>*                    pVertexOffset)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkSetDeviceMemoryPriorityEXT(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            memory,
+    float                                       priority)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkSetDeviceMemoryPriorityEXT, false, 0, device, memory);
+}
+
+void VulkanExportConsumer::Process_vkCreateAccelerationStructureKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAccelerationStructureCreateInfoKHR>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructure)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pAccelerationStructure));
+}
+
+void VulkanExportConsumer::Process_vkDestroyAccelerationStructureKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    format::HandleId                            accelerationStructure,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR, false, 0, device, accelerationStructure);
+}
+
+void VulkanExportConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    infoCount,
+    StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
+    StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>* ppBuildRangeInfos)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdBuildAccelerationStructuresIndirectKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    infoCount,
+    StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
+    PointerDecoder<VkDeviceAddress>*            pIndirectDeviceAddresses,
+    PointerDecoder<uint32_t>*                   pIndirectStrides,
+    PointerDecoder<uint32_t*>*                  ppMaxPrimitiveCounts)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            deferredOperation,
+    StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR, true, static_cast<int64_t>(returnValue), device, deferredOperation);
+}
+
+void VulkanExportConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            deferredOperation,
+    StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR, true, static_cast<int64_t>(returnValue), device, deferredOperation);
+}
+
+void VulkanExportConsumer::Process_vkWriteAccelerationStructuresPropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    uint32_t                                    accelerationStructureCount,
+    HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructures,
+    VkQueryType                                 queryType,
+    size_t                                      dataSize,
+    PointerDecoder<uint8_t>*                    pData,
+    size_t                                      stride)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR, true, static_cast<int64_t>(returnValue), device, GetFirstHandleId(pAccelerationStructures));
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyAccelerationStructureKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyAccelerationStructureInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetAccelerationStructureDeviceAddressKHR(
+    const ApiCallInfo&                          call_info,
+    VkDeviceAddress                             returnValue,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR, true, static_cast<int64_t>(returnValue), device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    accelerationStructureCount,
+    HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructures,
+    VkQueryType                                 queryType,
+    format::HandleId                            queryPool,
+    uint32_t                                    firstQuery)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR, false, 0, commandBuffer, queryPool);
+}
+
+void VulkanExportConsumer::Process_vkGetDeviceAccelerationStructureCompatibilityKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    StructPointerDecoder<Decoded_VkAccelerationStructureVersionInfoKHR>* pVersionInfo,
+    PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            device,
+    VkAccelerationStructureBuildTypeKHR         buildType,
+    StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pBuildInfo,
+    PointerDecoder<uint32_t>*                   pMaxPrimitiveCounts,
+    StructPointerDecoder<Decoded_VkAccelerationStructureBuildSizesInfoKHR>* pSizeInfo)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetAccelerationStructureBuildSizesKHR, false, 0, device, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCmdTraceRaysKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pRaygenShaderBindingTable,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pMissShaderBindingTable,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pHitShaderBindingTable,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
+    uint32_t                                    width,
+    uint32_t                                    height,
+    uint32_t                                    depth)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdTraceRaysKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkCreateRayTracingPipelinesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            deferredOperation,
+    format::HandleId                            pipelineCache,
+    uint32_t                                    createInfoCount,
+    StructPointerDecoder<Decoded_VkRayTracingPipelineCreateInfoKHR>* pCreateInfos,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
+    HandlePointerDecoder<VkPipeline>*           pPipelines)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR, true, static_cast<int64_t>(returnValue), device, deferredOperation);
+}
+
+void VulkanExportConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(
+    const ApiCallInfo&                          call_info,
+    VkResult                                    returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    uint32_t                                    firstGroup,
+    uint32_t                                    groupCount,
+    size_t                                      dataSize,
+    PointerDecoder<uint8_t>*                    pData)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, true, static_cast<int64_t>(returnValue), device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkCmdTraceRaysIndirectKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pRaygenShaderBindingTable,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pMissShaderBindingTable,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pHitShaderBindingTable,
+    StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
+    VkDeviceAddress                             indirectDeviceAddress)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+
+void VulkanExportConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
+    const ApiCallInfo&                          call_info,
+    VkDeviceSize                                returnValue,
+    format::HandleId                            device,
+    format::HandleId                            pipeline,
+    uint32_t                                    group,
+    VkShaderGroupShaderKHR                      groupShader)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupStackSizeKHR, true, static_cast<int64_t>(returnValue), device, pipeline);
+}
+
+void VulkanExportConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
+    const ApiCallInfo&                          call_info,
+    format::HandleId                            commandBuffer,
+    uint32_t                                    pipelineStackSize)
+{
+    AddApiCall(call_info, format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR, false, 0, commandBuffer, format::kNullHandleId);
+}
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
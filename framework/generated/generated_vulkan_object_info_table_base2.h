@@ -251,6 +251,51 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void VisitSwapchainKHRInfo(std::function<void(const SwapchainKHRInfo*)> visitor) const {  for (const auto& entry : swapchainKHR_map_) { visitor(&entry.second); }  }
     void VisitValidationCacheEXTInfo(std::function<void(const ValidationCacheEXTInfo*)> visitor) const {  for (const auto& entry : validationCacheEXT_map_) { visitor(&entry.second); }  }
 
+    void VisitObjectIds(std::function<void(const char*, format::HandleId)> visitor) const
+    {
+        for (const auto& entry : accelerationStructureKHR_map_) { visitor("VkAccelerationStructureKHR", entry.first); }
+        for (const auto& entry : accelerationStructureNV_map_) { visitor("VkAccelerationStructureNV", entry.first); }
+        for (const auto& entry : buffer_map_) { visitor("VkBuffer", entry.first); }
+        for (const auto& entry : bufferView_map_) { visitor("VkBufferView", entry.first); }
+        for (const auto& entry : commandBuffer_map_) { visitor("VkCommandBuffer", entry.first); }
+        for (const auto& entry : commandPool_map_) { visitor("VkCommandPool", entry.first); }
+        for (const auto& entry : debugReportCallbackEXT_map_) { visitor("VkDebugReportCallbackEXT", entry.first); }
+        for (const auto& entry : debugUtilsMessengerEXT_map_) { visitor("VkDebugUtilsMessengerEXT", entry.first); }
+        for (const auto& entry : deferredOperationKHR_map_) { visitor("VkDeferredOperationKHR", entry.first); }
+        for (const auto& entry : descriptorPool_map_) { visitor("VkDescriptorPool", entry.first); }
+        for (const auto& entry : descriptorSet_map_) { visitor("VkDescriptorSet", entry.first); }
+        for (const auto& entry : descriptorSetLayout_map_) { visitor("VkDescriptorSetLayout", entry.first); }
+        for (const auto& entry : descriptorUpdateTemplate_map_) { visitor("VkDescriptorUpdateTemplate", entry.first); }
+        for (const auto& entry : device_map_) { visitor("VkDevice", entry.first); }
+        for (const auto& entry : deviceMemory_map_) { visitor("VkDeviceMemory", entry.first); }
+        for (const auto& entry : displayKHR_map_) { visitor("VkDisplayKHR", entry.first); }
+        for (const auto& entry : displayModeKHR_map_) { visitor("VkDisplayModeKHR", entry.first); }
+        for (const auto& entry : event_map_) { visitor("VkEvent", entry.first); }
+        for (const auto& entry : fence_map_) { visitor("VkFence", entry.first); }
+        for (const auto& entry : framebuffer_map_) { visitor("VkFramebuffer", entry.first); }
+        for (const auto& entry : image_map_) { visitor("VkImage", entry.first); }
+        for (const auto& entry : imageView_map_) { visitor("VkImageView", entry.first); }
+        for (const auto& entry : indirectCommandsLayoutNV_map_) { visitor("VkIndirectCommandsLayoutNV", entry.first); }
+        for (const auto& entry : instance_map_) { visitor("VkInstance", entry.first); }
+        for (const auto& entry : performanceConfigurationINTEL_map_) { visitor("VkPerformanceConfigurationINTEL", entry.first); }
+        for (const auto& entry : physicalDevice_map_) { visitor("VkPhysicalDevice", entry.first); }
+        for (const auto& entry : pipeline_map_) { visitor("VkPipeline", entry.first); }
+        for (const auto& entry : pipelineCache_map_) { visitor("VkPipelineCache", entry.first); }
+        for (const auto& entry : pipelineLayout_map_) { visitor("VkPipelineLayout", entry.first); }
+        for (const auto& entry : privateDataSlot_map_) { visitor("VkPrivateDataSlot", entry.first); }
+        for (const auto& entry : privateDataSlotEXT_map_) { visitor("VkPrivateDataSlotEXT", entry.first); }
+        for (const auto& entry : queryPool_map_) { visitor("VkQueryPool", entry.first); }
+        for (const auto& entry : queue_map_) { visitor("VkQueue", entry.first); }
+        for (const auto& entry : renderPass_map_) { visitor("VkRenderPass", entry.first); }
+        for (const auto& entry : sampler_map_) { visitor("VkSampler", entry.first); }
+        for (const auto& entry : samplerYcbcrConversion_map_) { visitor("VkSamplerYcbcrConversion", entry.first); }
+        for (const auto& entry : semaphore_map_) { visitor("VkSemaphore", entry.first); }
+        for (const auto& entry : shaderModule_map_) { visitor("VkShaderModule", entry.first); }
+        for (const auto& entry : surfaceKHR_map_) { visitor("VkSurfaceKHR", entry.first); }
+        for (const auto& entry : swapchainKHR_map_) { visitor("VkSwapchainKHR", entry.first); }
+        for (const auto& entry : validationCacheEXT_map_) { visitor("VkValidationCacheEXT", entry.first); }
+    }
+
   protected:
      std::unordered_map<format::HandleId, AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
      std::unordered_map<format::HandleId, AccelerationStructureNVInfo> accelerationStructureNV_map_;
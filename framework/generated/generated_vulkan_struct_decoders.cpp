@@ -51,6 +51,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkExtent2
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkExtent2D* wrappers, VkExtent2D* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkExtent2D) == 8, "Unexpected size for fixed layout struct VkExtent2D");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkExtent3D* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -65,6 +80,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkExtent3
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkExtent3D* wrappers, VkExtent3D* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkExtent3D) == 12, "Unexpected size for fixed layout struct VkExtent3D");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkOffset2D* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -78,6 +108,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkOffset2
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkOffset2D* wrappers, VkOffset2D* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkOffset2D) == 8, "Unexpected size for fixed layout struct VkOffset2D");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkOffset3D* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -92,6 +137,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkOffset3
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkOffset3D* wrappers, VkOffset3D* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkOffset3D) == 12, "Unexpected size for fixed layout struct VkOffset3D");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRect2D* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -109,6 +169,28 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRect2D*
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkRect2D* wrappers, VkRect2D* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkRect2D) == 16, "Unexpected size for fixed layout struct VkRect2D");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkOffset2D* offset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkExtent2D* extent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].offset = &offset_wrappers[i];
+        wrappers[i].offset->decoded_value = &(values[i].offset);
+        wrappers[i].extent = &extent_wrappers[i];
+        wrappers[i].extent->decoded_value = &(values[i].extent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBufferMemoryBarrier* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -145,6 +227,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDispatc
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDispatchIndirectCommand* wrappers, VkDispatchIndirectCommand* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDispatchIndirectCommand) == 12, "Unexpected size for fixed layout struct VkDispatchIndirectCommand");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawIndexedIndirectCommand* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -161,6 +258,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawInd
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawIndexedIndirectCommand* wrappers, VkDrawIndexedIndirectCommand* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDrawIndexedIndirectCommand) == 20, "Unexpected size for fixed layout struct VkDrawIndexedIndirectCommand");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawIndirectCommand* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -176,6 +288,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawInd
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawIndirectCommand* wrappers, VkDrawIndirectCommand* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDrawIndirectCommand) == 16, "Unexpected size for fixed layout struct VkDrawIndirectCommand");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSubresourceRange* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -192,6 +319,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSu
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSubresourceRange* wrappers, VkImageSubresourceRange* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkImageSubresourceRange) == 20, "Unexpected size for fixed layout struct VkImageSubresourceRange");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageMemoryBarrier* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -308,6 +450,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkFormatP
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkFormatProperties* wrappers, VkFormatProperties* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkFormatProperties) == 12, "Unexpected size for fixed layout struct VkFormatProperties");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageFormatProperties* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -326,6 +483,25 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageFo
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageFormatProperties* wrappers, VkImageFormatProperties* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkImageFormatProperties) == 32, "Unexpected size for fixed layout struct VkImageFormatProperties");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkExtent3D* maxExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].maxExtent = &maxExtent_wrappers[i];
+        wrappers[i].maxExtent->decoded_value = &(values[i].maxExtent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkInstanceCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -376,6 +552,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkMemoryT
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkMemoryType* wrappers, VkMemoryType* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkMemoryType) == 8, "Unexpected size for fixed layout struct VkMemoryType");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceFeatures* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -442,6 +633,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysica
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceFeatures* wrappers, VkPhysicalDeviceFeatures* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkPhysicalDeviceFeatures) == 220, "Unexpected size for fixed layout struct VkPhysicalDeviceFeatures");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceLimits* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -600,6 +806,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysica
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceSparseProperties* wrappers, VkPhysicalDeviceSparseProperties* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkPhysicalDeviceSparseProperties) == 20, "Unexpected size for fixed layout struct VkPhysicalDeviceSparseProperties");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceProperties* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -643,6 +864,25 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkQueueFa
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkQueueFamilyProperties* wrappers, VkQueueFamilyProperties* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkQueueFamilyProperties) == 24, "Unexpected size for fixed layout struct VkQueueFamilyProperties");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkExtent3D* minImageTransferGranularity_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].minImageTransferGranularity = &minImageTransferGranularity_wrappers[i];
+        wrappers[i].minImageTransferGranularity->decoded_value = &(values[i].minImageTransferGranularity);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDeviceQueueCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -859,6 +1099,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSu
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSubresource* wrappers, VkImageSubresource* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkImageSubresource) == 12, "Unexpected size for fixed layout struct VkImageSubresource");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSparseImageMemoryBind* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -948,6 +1203,25 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSparseI
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSparseImageFormatProperties* wrappers, VkSparseImageFormatProperties* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSparseImageFormatProperties) == 20, "Unexpected size for fixed layout struct VkSparseImageFormatProperties");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkExtent3D* imageGranularity_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].imageGranularity = &imageGranularity_wrappers[i];
+        wrappers[i].imageGranularity->decoded_value = &(values[i].imageGranularity);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSparseImageMemoryRequirements* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -966,6 +1240,28 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSparseI
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSparseImageMemoryRequirements* wrappers, VkSparseImageMemoryRequirements* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSparseImageMemoryRequirements) == 48, "Unexpected size for fixed layout struct VkSparseImageMemoryRequirements");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkSparseImageFormatProperties* formatProperties_wrappers = DecodeAllocator::Allocate<Decoded_VkSparseImageFormatProperties>(len);
+    Decoded_VkExtent3D* formatProperties_imageGranularity_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].formatProperties = &formatProperties_wrappers[i];
+        wrappers[i].formatProperties->decoded_value = &(values[i].formatProperties);
+        wrappers[i].formatProperties->imageGranularity = &formatProperties_imageGranularity_wrappers[i];
+        wrappers[i].formatProperties->imageGranularity->decoded_value = &(values[i].formatProperties.imageGranularity);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkFenceCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1116,6 +1412,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSubreso
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSubresourceLayout* wrappers, VkSubresourceLayout* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSubresourceLayout) == 40, "Unexpected size for fixed layout struct VkSubresourceLayout");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkComponentMapping* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1131,6 +1442,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkCompone
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkComponentMapping* wrappers, VkComponentMapping* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkComponentMapping) == 16, "Unexpected size for fixed layout struct VkComponentMapping");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageViewCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1284,6 +1610,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexI
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexInputBindingDescription* wrappers, VkVertexInputBindingDescription* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkVertexInputBindingDescription) == 12, "Unexpected size for fixed layout struct VkVertexInputBindingDescription");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexInputAttributeDescription* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1299,6 +1640,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexI
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexInputAttributeDescription* wrappers, VkVertexInputAttributeDescription* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkVertexInputAttributeDescription) == 16, "Unexpected size for fixed layout struct VkVertexInputAttributeDescription");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineVertexInputStateCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1372,6 +1728,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkViewpor
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkViewport* wrappers, VkViewport* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkViewport) == 24, "Unexpected size for fixed layout struct VkViewport");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineViewportStateCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1460,6 +1831,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkStencil
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkStencilOpState* wrappers, VkStencilOpState* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkStencilOpState) == 28, "Unexpected size for fixed layout struct VkStencilOpState");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineDepthStencilStateCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1507,6 +1893,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelin
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineColorBlendAttachmentState* wrappers, VkPipelineColorBlendAttachmentState* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkPipelineColorBlendAttachmentState) == 32, "Unexpected size for fixed layout struct VkPipelineColorBlendAttachmentState");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineColorBlendStateCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1616,6 +2017,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPushCon
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkPushConstantRange* wrappers, VkPushConstantRange* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkPushConstantRange) == 12, "Unexpected size for fixed layout struct VkPushConstantRange");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineLayoutCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1719,6 +2135,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDescrip
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDescriptorPoolSize* wrappers, VkDescriptorPoolSize* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDescriptorPoolSize) == 8, "Unexpected size for fixed layout struct VkDescriptorPoolSize");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDescriptorPoolCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1814,6 +2245,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAttachm
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkAttachmentDescription* wrappers, VkAttachmentDescription* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkAttachmentDescription) == 36, "Unexpected size for fixed layout struct VkAttachmentDescription");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAttachmentReference* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1827,6 +2273,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAttachm
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkAttachmentReference* wrappers, VkAttachmentReference* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkAttachmentReference) == 8, "Unexpected size for fixed layout struct VkAttachmentReference");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkFramebufferCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -1898,6 +2359,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSubpass
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSubpassDependency* wrappers, VkSubpassDependency* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSubpassDependency) == 28, "Unexpected size for fixed layout struct VkSubpassDependency");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRenderPassCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2013,6 +2489,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBufferC
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkBufferCopy* wrappers, VkBufferCopy* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkBufferCopy) == 24, "Unexpected size for fixed layout struct VkBufferCopy");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSubresourceLayers* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2028,6 +2519,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSu
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageSubresourceLayers* wrappers, VkImageSubresourceLayers* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkImageSubresourceLayers) == 16, "Unexpected size for fixed layout struct VkImageSubresourceLayers");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBufferImageCopy* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2051,6 +2557,31 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBufferI
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkBufferImageCopy* wrappers, VkBufferImageCopy* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkBufferImageCopy) == 56, "Unexpected size for fixed layout struct VkBufferImageCopy");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkImageSubresourceLayers* imageSubresource_wrappers = DecodeAllocator::Allocate<Decoded_VkImageSubresourceLayers>(len);
+    Decoded_VkOffset3D* imageOffset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset3D>(len);
+    Decoded_VkExtent3D* imageExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].imageSubresource = &imageSubresource_wrappers[i];
+        wrappers[i].imageSubresource->decoded_value = &(values[i].imageSubresource);
+        wrappers[i].imageOffset = &imageOffset_wrappers[i];
+        wrappers[i].imageOffset->decoded_value = &(values[i].imageOffset);
+        wrappers[i].imageExtent = &imageExtent_wrappers[i];
+        wrappers[i].imageExtent->decoded_value = &(values[i].imageExtent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearDepthStencilValue* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2064,6 +2595,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearDe
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearDepthStencilValue* wrappers, VkClearDepthStencilValue* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkClearDepthStencilValue) == 8, "Unexpected size for fixed layout struct VkClearDepthStencilValue");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearAttachment* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2096,6 +2642,31 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearRe
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearRect* wrappers, VkClearRect* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkClearRect) == 24, "Unexpected size for fixed layout struct VkClearRect");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkRect2D* rect_wrappers = DecodeAllocator::Allocate<Decoded_VkRect2D>(len);
+    Decoded_VkOffset2D* rect_offset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkExtent2D* rect_extent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].rect = &rect_wrappers[i];
+        wrappers[i].rect->decoded_value = &(values[i].rect);
+        wrappers[i].rect->offset = &rect_offset_wrappers[i];
+        wrappers[i].rect->offset->decoded_value = &(values[i].rect.offset);
+        wrappers[i].rect->extent = &rect_extent_wrappers[i];
+        wrappers[i].rect->extent->decoded_value = &(values[i].rect.extent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageBlit* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2145,6 +2716,37 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageCo
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageCopy* wrappers, VkImageCopy* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkImageCopy) == 68, "Unexpected size for fixed layout struct VkImageCopy");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkImageSubresourceLayers* srcSubresource_wrappers = DecodeAllocator::Allocate<Decoded_VkImageSubresourceLayers>(len);
+    Decoded_VkOffset3D* srcOffset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset3D>(len);
+    Decoded_VkImageSubresourceLayers* dstSubresource_wrappers = DecodeAllocator::Allocate<Decoded_VkImageSubresourceLayers>(len);
+    Decoded_VkOffset3D* dstOffset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset3D>(len);
+    Decoded_VkExtent3D* extent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].srcSubresource = &srcSubresource_wrappers[i];
+        wrappers[i].srcSubresource->decoded_value = &(values[i].srcSubresource);
+        wrappers[i].srcOffset = &srcOffset_wrappers[i];
+        wrappers[i].srcOffset->decoded_value = &(values[i].srcOffset);
+        wrappers[i].dstSubresource = &dstSubresource_wrappers[i];
+        wrappers[i].dstSubresource->decoded_value = &(values[i].dstSubresource);
+        wrappers[i].dstOffset = &dstOffset_wrappers[i];
+        wrappers[i].dstOffset->decoded_value = &(values[i].dstOffset);
+        wrappers[i].extent = &extent_wrappers[i];
+        wrappers[i].extent->decoded_value = &(values[i].extent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageResolve* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2171,6 +2773,37 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageRe
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkImageResolve* wrappers, VkImageResolve* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkImageResolve) == 68, "Unexpected size for fixed layout struct VkImageResolve");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkImageSubresourceLayers* srcSubresource_wrappers = DecodeAllocator::Allocate<Decoded_VkImageSubresourceLayers>(len);
+    Decoded_VkOffset3D* srcOffset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset3D>(len);
+    Decoded_VkImageSubresourceLayers* dstSubresource_wrappers = DecodeAllocator::Allocate<Decoded_VkImageSubresourceLayers>(len);
+    Decoded_VkOffset3D* dstOffset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset3D>(len);
+    Decoded_VkExtent3D* extent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent3D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].srcSubresource = &srcSubresource_wrappers[i];
+        wrappers[i].srcSubresource->decoded_value = &(values[i].srcSubresource);
+        wrappers[i].srcOffset = &srcOffset_wrappers[i];
+        wrappers[i].srcOffset->decoded_value = &(values[i].srcOffset);
+        wrappers[i].dstSubresource = &dstSubresource_wrappers[i];
+        wrappers[i].dstSubresource->decoded_value = &(values[i].dstSubresource);
+        wrappers[i].dstOffset = &dstOffset_wrappers[i];
+        wrappers[i].dstOffset->decoded_value = &(values[i].dstOffset);
+        wrappers[i].extent = &extent_wrappers[i];
+        wrappers[i].extent->decoded_value = &(values[i].extent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRenderPassBeginInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -2734,6 +3367,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkInputAt
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkInputAttachmentAspectReference* wrappers, VkInputAttachmentAspectReference* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkInputAttachmentAspectReference) == 12, "Unexpected size for fixed layout struct VkInputAttachmentAspectReference");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRenderPassInputAttachmentAspectCreateInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -3073,6 +3721,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkExterna
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkExternalMemoryProperties* wrappers, VkExternalMemoryProperties* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkExternalMemoryProperties) == 12, "Unexpected size for fixed layout struct VkExternalMemoryProperties");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceExternalImageFormatInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -5541,6 +6204,31 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSurface
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSurfaceCapabilitiesKHR* wrappers, VkSurfaceCapabilitiesKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSurfaceCapabilitiesKHR) == 52, "Unexpected size for fixed layout struct VkSurfaceCapabilitiesKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkExtent2D* currentExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+    Decoded_VkExtent2D* minImageExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+    Decoded_VkExtent2D* maxImageExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].currentExtent = &currentExtent_wrappers[i];
+        wrappers[i].currentExtent->decoded_value = &(values[i].currentExtent);
+        wrappers[i].minImageExtent = &minImageExtent_wrappers[i];
+        wrappers[i].minImageExtent->decoded_value = &(values[i].minImageExtent);
+        wrappers[i].maxImageExtent = &maxImageExtent_wrappers[i];
+        wrappers[i].maxImageExtent->decoded_value = &(values[i].maxImageExtent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSurfaceFormatKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -5554,6 +6242,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSurface
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSurfaceFormatKHR* wrappers, VkSurfaceFormatKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSurfaceFormatKHR) == 8, "Unexpected size for fixed layout struct VkSurfaceFormatKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSwapchainCreateInfoKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -5733,6 +6436,25 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDisplay
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDisplayModeParametersKHR* wrappers, VkDisplayModeParametersKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDisplayModeParametersKHR) == 12, "Unexpected size for fixed layout struct VkDisplayModeParametersKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkExtent2D* visibleRegion_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].visibleRegion = &visibleRegion_wrappers[i];
+        wrappers[i].visibleRegion->decoded_value = &(values[i].visibleRegion);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDisplayModeCreateInfoKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -5803,6 +6525,46 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDisplay
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDisplayPlaneCapabilitiesKHR* wrappers, VkDisplayPlaneCapabilitiesKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDisplayPlaneCapabilitiesKHR) == 68, "Unexpected size for fixed layout struct VkDisplayPlaneCapabilitiesKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkOffset2D* minSrcPosition_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkOffset2D* maxSrcPosition_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkExtent2D* minSrcExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+    Decoded_VkExtent2D* maxSrcExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+    Decoded_VkOffset2D* minDstPosition_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkOffset2D* maxDstPosition_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkExtent2D* minDstExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+    Decoded_VkExtent2D* maxDstExtent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].minSrcPosition = &minSrcPosition_wrappers[i];
+        wrappers[i].minSrcPosition->decoded_value = &(values[i].minSrcPosition);
+        wrappers[i].maxSrcPosition = &maxSrcPosition_wrappers[i];
+        wrappers[i].maxSrcPosition->decoded_value = &(values[i].maxSrcPosition);
+        wrappers[i].minSrcExtent = &minSrcExtent_wrappers[i];
+        wrappers[i].minSrcExtent->decoded_value = &(values[i].minSrcExtent);
+        wrappers[i].maxSrcExtent = &maxSrcExtent_wrappers[i];
+        wrappers[i].maxSrcExtent->decoded_value = &(values[i].maxSrcExtent);
+        wrappers[i].minDstPosition = &minDstPosition_wrappers[i];
+        wrappers[i].minDstPosition->decoded_value = &(values[i].minDstPosition);
+        wrappers[i].maxDstPosition = &maxDstPosition_wrappers[i];
+        wrappers[i].maxDstPosition->decoded_value = &(values[i].maxDstPosition);
+        wrappers[i].minDstExtent = &minDstExtent_wrappers[i];
+        wrappers[i].minDstExtent->decoded_value = &(values[i].minDstExtent);
+        wrappers[i].maxDstExtent = &maxDstExtent_wrappers[i];
+        wrappers[i].maxDstExtent->decoded_value = &(values[i].maxDstExtent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDisplayPlanePropertiesKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -6342,6 +7104,28 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRectLay
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkRectLayerKHR* wrappers, VkRectLayerKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkRectLayerKHR) == 20, "Unexpected size for fixed layout struct VkRectLayerKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    Decoded_VkOffset2D* offset_wrappers = DecodeAllocator::Allocate<Decoded_VkOffset2D>(len);
+    Decoded_VkExtent2D* extent_wrappers = DecodeAllocator::Allocate<Decoded_VkExtent2D>(len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+        wrappers[i].offset = &offset_wrappers[i];
+        wrappers[i].offset->decoded_value = &(values[i].offset);
+        wrappers[i].extent = &extent_wrappers[i];
+        wrappers[i].extent->decoded_value = &(values[i].extent);
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPresentRegionKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -7762,6 +8546,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkViewpor
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkViewportWScalingNV* wrappers, VkViewportWScalingNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkViewportWScalingNV) == 8, "Unexpected size for fixed layout struct VkViewportWScalingNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineViewportWScalingStateCreateInfoNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -7884,6 +8683,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkRefresh
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkRefreshCycleDurationGOOGLE* wrappers, VkRefreshCycleDurationGOOGLE* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkRefreshCycleDurationGOOGLE) == 8, "Unexpected size for fixed layout struct VkRefreshCycleDurationGOOGLE");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPastPresentationTimingGOOGLE* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -7961,6 +8775,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkViewpor
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkViewportSwizzleNV* wrappers, VkViewportSwizzleNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkViewportSwizzleNV) == 16, "Unexpected size for fixed layout struct VkViewportSwizzleNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineViewportSwizzleStateCreateInfoNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -8099,6 +8928,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkXYColor
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkXYColorEXT* wrappers, VkXYColorEXT* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkXYColorEXT) == 8, "Unexpected size for fixed layout struct VkXYColorEXT");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkHdrMetadataEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -8413,6 +9257,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSampleL
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSampleLocationEXT* wrappers, VkSampleLocationEXT* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSampleLocationEXT) == 8, "Unexpected size for fixed layout struct VkSampleLocationEXT");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSampleLocationsInfoEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -8678,6 +9537,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrmForm
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrmFormatModifierPropertiesEXT* wrappers, VkDrmFormatModifierPropertiesEXT* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDrmFormatModifierPropertiesEXT) == 16, "Unexpected size for fixed layout struct VkDrmFormatModifierPropertiesEXT");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrmFormatModifierPropertiesListEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -8914,6 +9788,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkCoarseS
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkCoarseSampleLocationNV* wrappers, VkCoarseSampleLocationNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkCoarseSampleLocationNV) == 12, "Unexpected size for fixed layout struct VkCoarseSampleLocationNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkCoarseSampleOrderCustomNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -9228,6 +10117,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAabbPos
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkAabbPositionsKHR* wrappers, VkAabbPositionsKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkAabbPositionsKHR) == 24, "Unexpected size for fixed layout struct VkAabbPositionsKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureInstanceKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -9464,6 +10368,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexI
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkVertexInputBindingDivisorDescriptionEXT* wrappers, VkVertexInputBindingDivisorDescriptionEXT* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkVertexInputBindingDivisorDescriptionEXT) == 8, "Unexpected size for fixed layout struct VkVertexInputBindingDivisorDescriptionEXT");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineVertexInputDivisorStateCreateInfoEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -9587,6 +10506,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawMes
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkDrawMeshTasksIndirectCommandNV* wrappers, VkDrawMeshTasksIndirectCommandNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkDrawMeshTasksIndirectCommandNV) == 8, "Unexpected size for fixed layout struct VkDrawMeshTasksIndirectCommandNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -10560,6 +11494,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindSha
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindShaderGroupIndirectCommandNV* wrappers, VkBindShaderGroupIndirectCommandNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkBindShaderGroupIndirectCommandNV) == 4, "Unexpected size for fixed layout struct VkBindShaderGroupIndirectCommandNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindIndexBufferIndirectCommandNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -10574,6 +11523,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindInd
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindIndexBufferIndirectCommandNV* wrappers, VkBindIndexBufferIndirectCommandNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkBindIndexBufferIndirectCommandNV) == 16, "Unexpected size for fixed layout struct VkBindIndexBufferIndirectCommandNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindVertexBufferIndirectCommandNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -10588,6 +11552,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindVer
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkBindVertexBufferIndirectCommandNV* wrappers, VkBindVertexBufferIndirectCommandNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkBindVertexBufferIndirectCommandNV) == 16, "Unexpected size for fixed layout struct VkBindVertexBufferIndirectCommandNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSetStateFlagsIndirectCommandNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -10600,6 +11579,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSetStat
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSetStateFlagsIndirectCommandNV* wrappers, VkSetStateFlagsIndirectCommandNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSetStateFlagsIndirectCommandNV) == 4, "Unexpected size for fixed layout struct VkSetStateFlagsIndirectCommandNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkIndirectCommandsStreamNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -11110,6 +12104,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkSRTData
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkSRTDataNV* wrappers, VkSRTDataNV* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkSRTDataNV) == 64, "Unexpected size for fixed layout struct VkSRTDataNV");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureSRTMotionInstanceNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -11722,6 +12731,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkMultiDr
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkMultiDrawInfoEXT* wrappers, VkMultiDrawInfoEXT* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkMultiDrawInfoEXT) == 8, "Unexpected size for fixed layout struct VkMultiDrawInfoEXT");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkMultiDrawIndexedInfoEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -11736,6 +12760,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkMultiDr
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkMultiDrawIndexedInfoEXT* wrappers, VkMultiDrawIndexedInfoEXT* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkMultiDrawIndexedInfoEXT) == 12, "Unexpected size for fixed layout struct VkMultiDrawIndexedInfoEXT");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -11865,6 +12904,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAcceler
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureBuildRangeInfoKHR* wrappers, VkAccelerationStructureBuildRangeInfoKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkAccelerationStructureBuildRangeInfoKHR) == 16, "Unexpected size for fixed layout struct VkAccelerationStructureBuildRangeInfoKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureGeometryTrianglesDataKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -12276,6 +13330,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkStrided
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkStridedDeviceAddressRegionKHR* wrappers, VkStridedDeviceAddressRegionKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkStridedDeviceAddressRegionKHR) == 24, "Unexpected size for fixed layout struct VkStridedDeviceAddressRegionKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkTraceRaysIndirectCommandKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -12290,6 +13359,21 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkTraceRa
     return bytes_read;
 }
 
+size_t DecodeStructArray(const uint8_t* buffer, size_t buffer_size, Decoded_VkTraceRaysIndirectCommandKHR* wrappers, VkTraceRaysIndirectCommandKHR* values, size_t len)
+{
+    assert((wrappers != nullptr) && (values != nullptr));
+    static_assert(sizeof(VkTraceRaysIndirectCommandKHR) == 12, "Unexpected size for fixed layout struct VkTraceRaysIndirectCommandKHR");
+
+    size_t bytes_read = ValueDecoder::DecodeFixedLayoutStructArray(buffer, buffer_size, values, len);
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        wrappers[i].decoded_value = &values[i];
+    }
+
+    return bytes_read;
+}
+
 size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPhysicalDeviceRayQueryFeaturesKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
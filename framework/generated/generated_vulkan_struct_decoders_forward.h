@@ -248,6 +248,44 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageResolve* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkRenderPassBeginInfo* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkExtent2D* wrappers, VkExtent2D* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkExtent3D* wrappers, VkExtent3D* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkOffset2D* wrappers, VkOffset2D* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkOffset3D* wrappers, VkOffset3D* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkRect2D* wrappers, VkRect2D* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDispatchIndirectCommand* wrappers, VkDispatchIndirectCommand* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrawIndexedIndirectCommand* wrappers, VkDrawIndexedIndirectCommand* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrawIndirectCommand* wrappers, VkDrawIndirectCommand* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageSubresourceRange* wrappers, VkImageSubresourceRange* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkFormatProperties* wrappers, VkFormatProperties* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageFormatProperties* wrappers, VkImageFormatProperties* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkMemoryType* wrappers, VkMemoryType* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceFeatures* wrappers, VkPhysicalDeviceFeatures* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceSparseProperties* wrappers, VkPhysicalDeviceSparseProperties* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkQueueFamilyProperties* wrappers, VkQueueFamilyProperties* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageSubresource* wrappers, VkImageSubresource* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSparseImageFormatProperties* wrappers, VkSparseImageFormatProperties* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSparseImageMemoryRequirements* wrappers, VkSparseImageMemoryRequirements* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSubresourceLayout* wrappers, VkSubresourceLayout* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkComponentMapping* wrappers, VkComponentMapping* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkVertexInputBindingDescription* wrappers, VkVertexInputBindingDescription* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkVertexInputAttributeDescription* wrappers, VkVertexInputAttributeDescription* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkViewport* wrappers, VkViewport* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkStencilOpState* wrappers, VkStencilOpState* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPipelineColorBlendAttachmentState* wrappers, VkPipelineColorBlendAttachmentState* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPushConstantRange* wrappers, VkPushConstantRange* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDescriptorPoolSize* wrappers, VkDescriptorPoolSize* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAttachmentDescription* wrappers, VkAttachmentDescription* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAttachmentReference* wrappers, VkAttachmentReference* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSubpassDependency* wrappers, VkSubpassDependency* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkBufferCopy* wrappers, VkBufferCopy* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageSubresourceLayers* wrappers, VkImageSubresourceLayers* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkBufferImageCopy* wrappers, VkBufferImageCopy* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkClearDepthStencilValue* wrappers, VkClearDepthStencilValue* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkClearRect* wrappers, VkClearRect* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageCopy* wrappers, VkImageCopy* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkImageResolve* wrappers, VkImageResolve* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceSubgroupProperties;
 struct Decoded_VkBindBufferMemoryInfo;
 struct Decoded_VkBindImageMemoryInfo;
@@ -386,6 +424,9 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDescriptorSetLayoutSupport* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceShaderDrawParametersFeatures* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkInputAttachmentAspectReference* wrappers, VkInputAttachmentAspectReference* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkExternalMemoryProperties* wrappers, VkExternalMemoryProperties* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceVulkan11Features;
 struct Decoded_VkPhysicalDeviceVulkan11Properties;
 struct Decoded_VkPhysicalDeviceVulkan12Features;
@@ -604,6 +645,9 @@ struct Decoded_VkSurfaceFormatKHR;
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSurfaceCapabilitiesKHR* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSurfaceFormatKHR* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSurfaceCapabilitiesKHR* wrappers, VkSurfaceCapabilitiesKHR* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSurfaceFormatKHR* wrappers, VkSurfaceFormatKHR* values, size_t len);
+
 struct Decoded_VkSwapchainCreateInfoKHR;
 struct Decoded_VkPresentInfoKHR;
 struct Decoded_VkImageSwapchainCreateInfoKHR;
@@ -638,6 +682,9 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDisplayPropertiesKHR* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDisplaySurfaceCreateInfoKHR* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDisplayModeParametersKHR* wrappers, VkDisplayModeParametersKHR* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDisplayPlaneCapabilitiesKHR* wrappers, VkDisplayPlaneCapabilitiesKHR* values, size_t len);
+
 struct Decoded_VkDisplayPresentInfoKHR;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDisplayPresentInfoKHR* wrapper);
@@ -722,6 +769,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPresentRegionKHR* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPresentRegionsKHR* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkRectLayerKHR* wrappers, VkRectLayerKHR* values, size_t len);
+
 struct Decoded_VkSharedPresentSurfaceCapabilitiesKHR;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSharedPresentSurfaceCapabilitiesKHR* wrapper);
@@ -956,6 +1005,8 @@ struct Decoded_VkPipelineViewportWScalingStateCreateInfoNV;
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkViewportWScalingNV* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPipelineViewportWScalingStateCreateInfoNV* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkViewportWScalingNV* wrappers, VkViewportWScalingNV* values, size_t len);
+
 struct Decoded_VkSurfaceCapabilities2EXT;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSurfaceCapabilities2EXT* wrapper);
@@ -980,6 +1031,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPresentTimeGOOGLE* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPresentTimesInfoGOOGLE* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkRefreshCycleDurationGOOGLE* wrappers, VkRefreshCycleDurationGOOGLE* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* wrapper);
@@ -990,6 +1043,8 @@ struct Decoded_VkPipelineViewportSwizzleStateCreateInfoNV;
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkViewportSwizzleNV* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPipelineViewportSwizzleStateCreateInfoNV* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkViewportSwizzleNV* wrappers, VkViewportSwizzleNV* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceDiscardRectanglePropertiesEXT;
 struct Decoded_VkPipelineDiscardRectangleStateCreateInfoEXT;
 
@@ -1014,6 +1069,8 @@ struct Decoded_VkHdrMetadataEXT;
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkXYColorEXT* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkHdrMetadataEXT* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkXYColorEXT* wrappers, VkXYColorEXT* values, size_t len);
+
 struct Decoded_VkIOSSurfaceCreateInfoMVK;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkIOSSurfaceCreateInfoMVK* wrapper);
@@ -1068,6 +1125,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceSampleLocationsPropertiesEXT* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkMultisamplePropertiesEXT* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSampleLocationEXT* wrappers, VkSampleLocationEXT* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT;
 struct Decoded_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT;
 struct Decoded_VkPipelineColorBlendAdvancedStateCreateInfoEXT;
@@ -1108,6 +1167,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrmFormatModifierProperties2EXT* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrmFormatModifierPropertiesList2EXT* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrmFormatModifierPropertiesEXT* wrappers, VkDrmFormatModifierPropertiesEXT* values, size_t len);
+
 struct Decoded_VkValidationCacheCreateInfoEXT;
 struct Decoded_VkShaderModuleValidationCacheCreateInfoEXT;
 
@@ -1130,6 +1191,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkCoarseSampleOrderCustomNV* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkCoarseSampleLocationNV* wrappers, VkCoarseSampleLocationNV* values, size_t len);
+
 struct Decoded_VkRayTracingShaderGroupCreateInfoNV;
 struct Decoded_VkRayTracingPipelineCreateInfoNV;
 struct Decoded_VkGeometryTrianglesNV;
@@ -1162,6 +1225,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAabbPositionsKHR* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAccelerationStructureInstanceKHR* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAabbPositionsKHR* wrappers, VkAabbPositionsKHR* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV;
 struct Decoded_VkPipelineRepresentativeFragmentTestStateCreateInfoNV;
 
@@ -1208,6 +1273,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPipelineVertexInputDivisorStateCreateInfoEXT* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkVertexInputBindingDivisorDescriptionEXT* wrappers, VkVertexInputBindingDivisorDescriptionEXT* values, size_t len);
+
 struct Decoded_VkPresentFrameTokenGGP;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPresentFrameTokenGGP* wrapper);
@@ -1224,6 +1291,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceMeshShaderPropertiesNV* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrawMeshTasksIndirectCommandNV* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDrawMeshTasksIndirectCommandNV* wrappers, VkDrawMeshTasksIndirectCommandNV* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV* wrapper);
@@ -1420,6 +1489,11 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkGeneratedCommandsInfoNV* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkBindShaderGroupIndirectCommandNV* wrappers, VkBindShaderGroupIndirectCommandNV* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkBindIndexBufferIndirectCommandNV* wrappers, VkBindIndexBufferIndirectCommandNV* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkBindVertexBufferIndirectCommandNV* wrappers, VkBindVertexBufferIndirectCommandNV* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSetStateFlagsIndirectCommandNV* wrappers, VkSetStateFlagsIndirectCommandNV* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceInheritedViewportScissorFeaturesNV;
 struct Decoded_VkCommandBufferInheritanceViewportScissorInfoNV;
 
@@ -1486,6 +1560,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAccelerationStructureSRTMotionInstanceNV* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkSRTDataNV* wrappers, VkSRTDataNV* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT* wrapper);
@@ -1600,6 +1676,9 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkMultiDrawInfoEXT* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkMultiDrawIndexedInfoEXT* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkMultiDrawInfoEXT* wrappers, VkMultiDrawInfoEXT* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkMultiDrawIndexedInfoEXT* wrappers, VkMultiDrawIndexedInfoEXT* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT;
 struct Decoded_VkSamplerBorderColorComponentMappingCreateInfoEXT;
 
@@ -1654,6 +1733,8 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkCopyAccelerationStructureInfoKHR* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAccelerationStructureBuildSizesInfoKHR* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkAccelerationStructureBuildRangeInfoKHR* wrappers, VkAccelerationStructureBuildRangeInfoKHR* values, size_t len);
+
 struct Decoded_VkRayTracingShaderGroupCreateInfoKHR;
 struct Decoded_VkRayTracingPipelineInterfaceCreateInfoKHR;
 struct Decoded_VkRayTracingPipelineCreateInfoKHR;
@@ -1670,6 +1751,9 @@ size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkStridedDeviceAddressRegionKHR* wrapper);
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkTraceRaysIndirectCommandKHR* wrapper);
 
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkStridedDeviceAddressRegionKHR* wrappers, VkStridedDeviceAddressRegionKHR* values, size_t len);
+size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkTraceRaysIndirectCommandKHR* wrappers, VkTraceRaysIndirectCommandKHR* values, size_t len);
+
 struct Decoded_VkPhysicalDeviceRayQueryFeaturesKHR;
 
 size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPhysicalDeviceRayQueryFeaturesKHR* wrapper);
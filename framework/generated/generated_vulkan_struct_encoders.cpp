@@ -40,34 +40,77 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkExtent2D& value)
 {
-    encoder->EncodeUInt32Value(value.width);
-    encoder->EncodeUInt32Value(value.height);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkExtent2D* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkExtent3D& value)
 {
-    encoder->EncodeUInt32Value(value.width);
-    encoder->EncodeUInt32Value(value.height);
-    encoder->EncodeUInt32Value(value.depth);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkExtent3D* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkOffset2D& value)
 {
-    encoder->EncodeInt32Value(value.x);
-    encoder->EncodeInt32Value(value.y);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkOffset2D* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkOffset3D& value)
 {
-    encoder->EncodeInt32Value(value.x);
-    encoder->EncodeInt32Value(value.y);
-    encoder->EncodeInt32Value(value.z);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkOffset3D* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkRect2D& value)
 {
-    EncodeStruct(encoder, value.offset);
-    EncodeStruct(encoder, value.extent);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkRect2D* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferMemoryBarrier& value)
@@ -85,35 +128,62 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferMemoryBarrier& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDispatchIndirectCommand& value)
 {
-    encoder->EncodeUInt32Value(value.x);
-    encoder->EncodeUInt32Value(value.y);
-    encoder->EncodeUInt32Value(value.z);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDispatchIndirectCommand* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawIndexedIndirectCommand& value)
 {
-    encoder->EncodeUInt32Value(value.indexCount);
-    encoder->EncodeUInt32Value(value.instanceCount);
-    encoder->EncodeUInt32Value(value.firstIndex);
-    encoder->EncodeInt32Value(value.vertexOffset);
-    encoder->EncodeUInt32Value(value.firstInstance);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrawIndexedIndirectCommand* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawIndirectCommand& value)
 {
-    encoder->EncodeUInt32Value(value.vertexCount);
-    encoder->EncodeUInt32Value(value.instanceCount);
-    encoder->EncodeUInt32Value(value.firstVertex);
-    encoder->EncodeUInt32Value(value.firstInstance);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrawIndirectCommand* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresourceRange& value)
 {
-    encoder->EncodeFlagsValue(value.aspectMask);
-    encoder->EncodeUInt32Value(value.baseMipLevel);
-    encoder->EncodeUInt32Value(value.levelCount);
-    encoder->EncodeUInt32Value(value.baseArrayLayer);
-    encoder->EncodeUInt32Value(value.layerCount);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageSubresourceRange* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageMemoryBarrier& value)
@@ -170,18 +240,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkApplicationInfo& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkFormatProperties& value)
 {
-    encoder->EncodeFlagsValue(value.linearTilingFeatures);
-    encoder->EncodeFlagsValue(value.optimalTilingFeatures);
-    encoder->EncodeFlagsValue(value.bufferFeatures);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkFormatProperties* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatProperties& value)
 {
-    EncodeStruct(encoder, value.maxExtent);
-    encoder->EncodeUInt32Value(value.maxMipLevels);
-    encoder->EncodeUInt32Value(value.maxArrayLayers);
-    encoder->EncodeFlagsValue(value.sampleCounts);
-    encoder->EncodeVkDeviceSizeValue(value.maxResourceSize);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageFormatProperties* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkInstanceCreateInfo& value)
@@ -204,67 +288,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryHeap& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryType& value)
 {
-    encoder->EncodeFlagsValue(value.propertyFlags);
-    encoder->EncodeUInt32Value(value.heapIndex);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkMemoryType* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures& value)
 {
-    encoder->EncodeVkBool32Value(value.robustBufferAccess);
-    encoder->EncodeVkBool32Value(value.fullDrawIndexUint32);
-    encoder->EncodeVkBool32Value(value.imageCubeArray);
-    encoder->EncodeVkBool32Value(value.independentBlend);
-    encoder->EncodeVkBool32Value(value.geometryShader);
-    encoder->EncodeVkBool32Value(value.tessellationShader);
-    encoder->EncodeVkBool32Value(value.sampleRateShading);
-    encoder->EncodeVkBool32Value(value.dualSrcBlend);
-    encoder->EncodeVkBool32Value(value.logicOp);
-    encoder->EncodeVkBool32Value(value.multiDrawIndirect);
-    encoder->EncodeVkBool32Value(value.drawIndirectFirstInstance);
-    encoder->EncodeVkBool32Value(value.depthClamp);
-    encoder->EncodeVkBool32Value(value.depthBiasClamp);
-    encoder->EncodeVkBool32Value(value.fillModeNonSolid);
-    encoder->EncodeVkBool32Value(value.depthBounds);
-    encoder->EncodeVkBool32Value(value.wideLines);
-    encoder->EncodeVkBool32Value(value.largePoints);
-    encoder->EncodeVkBool32Value(value.alphaToOne);
-    encoder->EncodeVkBool32Value(value.multiViewport);
-    encoder->EncodeVkBool32Value(value.samplerAnisotropy);
-    encoder->EncodeVkBool32Value(value.textureCompressionETC2);
-    encoder->EncodeVkBool32Value(value.textureCompressionASTC_LDR);
-    encoder->EncodeVkBool32Value(value.textureCompressionBC);
-    encoder->EncodeVkBool32Value(value.occlusionQueryPrecise);
-    encoder->EncodeVkBool32Value(value.pipelineStatisticsQuery);
-    encoder->EncodeVkBool32Value(value.vertexPipelineStoresAndAtomics);
-    encoder->EncodeVkBool32Value(value.fragmentStoresAndAtomics);
-    encoder->EncodeVkBool32Value(value.shaderTessellationAndGeometryPointSize);
-    encoder->EncodeVkBool32Value(value.shaderImageGatherExtended);
-    encoder->EncodeVkBool32Value(value.shaderStorageImageExtendedFormats);
-    encoder->EncodeVkBool32Value(value.shaderStorageImageMultisample);
-    encoder->EncodeVkBool32Value(value.shaderStorageImageReadWithoutFormat);
-    encoder->EncodeVkBool32Value(value.shaderStorageImageWriteWithoutFormat);
-    encoder->EncodeVkBool32Value(value.shaderUniformBufferArrayDynamicIndexing);
-    encoder->EncodeVkBool32Value(value.shaderSampledImageArrayDynamicIndexing);
-    encoder->EncodeVkBool32Value(value.shaderStorageBufferArrayDynamicIndexing);
-    encoder->EncodeVkBool32Value(value.shaderStorageImageArrayDynamicIndexing);
-    encoder->EncodeVkBool32Value(value.shaderClipDistance);
-    encoder->EncodeVkBool32Value(value.shaderCullDistance);
-    encoder->EncodeVkBool32Value(value.shaderFloat64);
-    encoder->EncodeVkBool32Value(value.shaderInt64);
-    encoder->EncodeVkBool32Value(value.shaderInt16);
-    encoder->EncodeVkBool32Value(value.shaderResourceResidency);
-    encoder->EncodeVkBool32Value(value.shaderResourceMinLod);
-    encoder->EncodeVkBool32Value(value.sparseBinding);
-    encoder->EncodeVkBool32Value(value.sparseResidencyBuffer);
-    encoder->EncodeVkBool32Value(value.sparseResidencyImage2D);
-    encoder->EncodeVkBool32Value(value.sparseResidencyImage3D);
-    encoder->EncodeVkBool32Value(value.sparseResidency2Samples);
-    encoder->EncodeVkBool32Value(value.sparseResidency4Samples);
-    encoder->EncodeVkBool32Value(value.sparseResidency8Samples);
-    encoder->EncodeVkBool32Value(value.sparseResidency16Samples);
-    encoder->EncodeVkBool32Value(value.sparseResidencyAliased);
-    encoder->EncodeVkBool32Value(value.variableMultisampleRate);
-    encoder->EncodeVkBool32Value(value.inheritedQueries);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLimits& value)
@@ -387,11 +436,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryPropert
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSparseProperties& value)
 {
-    encoder->EncodeVkBool32Value(value.residencyStandard2DBlockShape);
-    encoder->EncodeVkBool32Value(value.residencyStandard2DMultisampleBlockShape);
-    encoder->EncodeVkBool32Value(value.residencyStandard3DBlockShape);
-    encoder->EncodeVkBool32Value(value.residencyAlignedMipSize);
-    encoder->EncodeVkBool32Value(value.residencyNonResidentStrict);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkPhysicalDeviceSparseProperties* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProperties& value)
@@ -409,10 +464,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProperties& v
 
 void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyProperties& value)
 {
-    encoder->EncodeFlagsValue(value.queueFlags);
-    encoder->EncodeUInt32Value(value.queueCount);
-    encoder->EncodeUInt32Value(value.timestampValidBits);
-    EncodeStruct(encoder, value.minImageTransferGranularity);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkQueueFamilyProperties* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueCreateInfo& value)
@@ -515,9 +577,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageOpaqueMemoryBind
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresource& value)
 {
-    encoder->EncodeFlagsValue(value.aspectMask);
-    encoder->EncodeUInt32Value(value.mipLevel);
-    encoder->EncodeUInt32Value(value.arrayLayer);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageSubresource* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryBind& value)
@@ -555,18 +625,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindSparseInfo& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageFormatProperties& value)
 {
-    encoder->EncodeFlagsValue(value.aspectMask);
-    EncodeStruct(encoder, value.imageGranularity);
-    encoder->EncodeFlagsValue(value.flags);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSparseImageFormatProperties* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryRequirements& value)
 {
-    EncodeStruct(encoder, value.formatProperties);
-    encoder->EncodeUInt32Value(value.imageMipTailFirstLod);
-    encoder->EncodeVkDeviceSizeValue(value.imageMipTailSize);
-    encoder->EncodeVkDeviceSizeValue(value.imageMipTailOffset);
-    encoder->EncodeVkDeviceSizeValue(value.imageMipTailStride);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSparseImageMemoryRequirements* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkFenceCreateInfo& value)
@@ -644,19 +728,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCreateInfo& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSubresourceLayout& value)
 {
-    encoder->EncodeVkDeviceSizeValue(value.offset);
-    encoder->EncodeVkDeviceSizeValue(value.size);
-    encoder->EncodeVkDeviceSizeValue(value.rowPitch);
-    encoder->EncodeVkDeviceSizeValue(value.arrayPitch);
-    encoder->EncodeVkDeviceSizeValue(value.depthPitch);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSubresourceLayout* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkComponentMapping& value)
 {
-    encoder->EncodeEnumValue(value.r);
-    encoder->EncodeEnumValue(value.g);
-    encoder->EncodeEnumValue(value.b);
-    encoder->EncodeEnumValue(value.a);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkComponentMapping* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewCreateInfo& value)
@@ -728,17 +825,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkComputePipelineCreateInfo&
 
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDescription& value)
 {
-    encoder->EncodeUInt32Value(value.binding);
-    encoder->EncodeUInt32Value(value.stride);
-    encoder->EncodeEnumValue(value.inputRate);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkVertexInputBindingDescription* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputAttributeDescription& value)
 {
-    encoder->EncodeUInt32Value(value.location);
-    encoder->EncodeUInt32Value(value.binding);
-    encoder->EncodeEnumValue(value.format);
-    encoder->EncodeUInt32Value(value.offset);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkVertexInputAttributeDescription* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputStateCreateInfo& value)
@@ -771,12 +883,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineTessellationStateCr
 
 void EncodeStruct(ParameterEncoder* encoder, const VkViewport& value)
 {
-    encoder->EncodeFloatValue(value.x);
-    encoder->EncodeFloatValue(value.y);
-    encoder->EncodeFloatValue(value.width);
-    encoder->EncodeFloatValue(value.height);
-    encoder->EncodeFloatValue(value.minDepth);
-    encoder->EncodeFloatValue(value.maxDepth);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkViewport* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportStateCreateInfo& value)
@@ -822,13 +939,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineMultisampleStateCre
 
 void EncodeStruct(ParameterEncoder* encoder, const VkStencilOpState& value)
 {
-    encoder->EncodeEnumValue(value.failOp);
-    encoder->EncodeEnumValue(value.passOp);
-    encoder->EncodeEnumValue(value.depthFailOp);
-    encoder->EncodeEnumValue(value.compareOp);
-    encoder->EncodeUInt32Value(value.compareMask);
-    encoder->EncodeUInt32Value(value.writeMask);
-    encoder->EncodeUInt32Value(value.reference);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkStencilOpState* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDepthStencilStateCreateInfo& value)
@@ -849,14 +970,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDepthStencilStateCr
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAttachmentState& value)
 {
-    encoder->EncodeVkBool32Value(value.blendEnable);
-    encoder->EncodeEnumValue(value.srcColorBlendFactor);
-    encoder->EncodeEnumValue(value.dstColorBlendFactor);
-    encoder->EncodeEnumValue(value.colorBlendOp);
-    encoder->EncodeEnumValue(value.srcAlphaBlendFactor);
-    encoder->EncodeEnumValue(value.dstAlphaBlendFactor);
-    encoder->EncodeEnumValue(value.alphaBlendOp);
-    encoder->EncodeFlagsValue(value.colorWriteMask);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkPipelineColorBlendAttachmentState* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendStateCreateInfo& value)
@@ -905,9 +1029,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsPipelineCreateInfo&
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPushConstantRange& value)
 {
-    encoder->EncodeFlagsValue(value.stageFlags);
-    encoder->EncodeUInt32Value(value.offset);
-    encoder->EncodeUInt32Value(value.size);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkPushConstantRange* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineLayoutCreateInfo& value)
@@ -965,8 +1097,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorBufferInfo& value
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolSize& value)
 {
-    encoder->EncodeEnumValue(value.type);
-    encoder->EncodeUInt32Value(value.descriptorCount);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDescriptorPoolSize* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolCreateInfo& value)
@@ -1008,21 +1149,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutCreateIn
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescription& value)
 {
-    encoder->EncodeFlagsValue(value.flags);
-    encoder->EncodeEnumValue(value.format);
-    encoder->EncodeEnumValue(value.samples);
-    encoder->EncodeEnumValue(value.loadOp);
-    encoder->EncodeEnumValue(value.storeOp);
-    encoder->EncodeEnumValue(value.stencilLoadOp);
-    encoder->EncodeEnumValue(value.stencilStoreOp);
-    encoder->EncodeEnumValue(value.initialLayout);
-    encoder->EncodeEnumValue(value.finalLayout);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkAttachmentDescription* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentReference& value)
 {
-    encoder->EncodeUInt32Value(value.attachment);
-    encoder->EncodeEnumValue(value.layout);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkAttachmentReference* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferCreateInfo& value)
@@ -1054,13 +1206,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescription& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDependency& value)
 {
-    encoder->EncodeUInt32Value(value.srcSubpass);
-    encoder->EncodeUInt32Value(value.dstSubpass);
-    encoder->EncodeFlagsValue(value.srcStageMask);
-    encoder->EncodeFlagsValue(value.dstStageMask);
-    encoder->EncodeFlagsValue(value.srcAccessMask);
-    encoder->EncodeFlagsValue(value.dstAccessMask);
-    encoder->EncodeFlagsValue(value.dependencyFlags);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSubpassDependency* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassCreateInfo& value)
@@ -1115,33 +1271,62 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferBeginInfo& val
 
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferCopy& value)
 {
-    encoder->EncodeVkDeviceSizeValue(value.srcOffset);
-    encoder->EncodeVkDeviceSizeValue(value.dstOffset);
-    encoder->EncodeVkDeviceSizeValue(value.size);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkBufferCopy* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresourceLayers& value)
 {
-    encoder->EncodeFlagsValue(value.aspectMask);
-    encoder->EncodeUInt32Value(value.mipLevel);
-    encoder->EncodeUInt32Value(value.baseArrayLayer);
-    encoder->EncodeUInt32Value(value.layerCount);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageSubresourceLayers* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferImageCopy& value)
 {
-    encoder->EncodeVkDeviceSizeValue(value.bufferOffset);
-    encoder->EncodeUInt32Value(value.bufferRowLength);
-    encoder->EncodeUInt32Value(value.bufferImageHeight);
-    EncodeStruct(encoder, value.imageSubresource);
-    EncodeStruct(encoder, value.imageOffset);
-    EncodeStruct(encoder, value.imageExtent);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkBufferImageCopy* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkClearDepthStencilValue& value)
 {
-    encoder->EncodeFloatValue(value.depth);
-    encoder->EncodeUInt32Value(value.stencil);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkClearDepthStencilValue* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkClearAttachment& value)
@@ -1153,9 +1338,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkClearAttachment& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkClearRect& value)
 {
-    EncodeStruct(encoder, value.rect);
-    encoder->EncodeUInt32Value(value.baseArrayLayer);
-    encoder->EncodeUInt32Value(value.layerCount);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkClearRect* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageBlit& value)
@@ -1168,20 +1361,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageBlit& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy& value)
 {
-    EncodeStruct(encoder, value.srcSubresource);
-    EncodeStruct(encoder, value.srcOffset);
-    EncodeStruct(encoder, value.dstSubresource);
-    EncodeStruct(encoder, value.dstOffset);
-    EncodeStruct(encoder, value.extent);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageCopy* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve& value)
 {
-    EncodeStruct(encoder, value.srcSubresource);
-    EncodeStruct(encoder, value.srcOffset);
-    EncodeStruct(encoder, value.dstSubresource);
-    EncodeStruct(encoder, value.dstOffset);
-    EncodeStruct(encoder, value.extent);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageResolve* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassBeginInfo& value)
@@ -1443,9 +1648,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePointClipping
 
 void EncodeStruct(ParameterEncoder* encoder, const VkInputAttachmentAspectReference& value)
 {
-    encoder->EncodeUInt32Value(value.subpass);
-    encoder->EncodeUInt32Value(value.inputAttachmentIndex);
-    encoder->EncodeFlagsValue(value.aspectMask);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkInputAttachmentAspectReference* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassInputAttachmentAspectCreateInfo& value)
@@ -1612,9 +1825,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorUpdateTemplateCre
 
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryProperties& value)
 {
-    encoder->EncodeFlagsValue(value.externalMemoryFeatures);
-    encoder->EncodeFlagsValue(value.exportFromImportedHandleTypes);
-    encoder->EncodeFlagsValue(value.compatibleHandleTypes);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkExternalMemoryProperties* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalImageFormatInfo& value)
@@ -2941,22 +3162,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceImageMemoryRequiremen
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR& value)
 {
-    encoder->EncodeUInt32Value(value.minImageCount);
-    encoder->EncodeUInt32Value(value.maxImageCount);
-    EncodeStruct(encoder, value.currentExtent);
-    EncodeStruct(encoder, value.minImageExtent);
-    EncodeStruct(encoder, value.maxImageExtent);
-    encoder->EncodeUInt32Value(value.maxImageArrayLayers);
-    encoder->EncodeFlagsValue(value.supportedTransforms);
-    encoder->EncodeEnumValue(value.currentTransform);
-    encoder->EncodeFlagsValue(value.supportedCompositeAlpha);
-    encoder->EncodeFlagsValue(value.supportedUsageFlags);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormatKHR& value)
 {
-    encoder->EncodeEnumValue(value.format);
-    encoder->EncodeEnumValue(value.colorSpace);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSurfaceFormatKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCreateInfoKHR& value)
@@ -3045,8 +3276,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupSwapchainCreateI
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeParametersKHR& value)
 {
-    EncodeStruct(encoder, value.visibleRegion);
-    encoder->EncodeUInt32Value(value.refreshRate);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDisplayModeParametersKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeCreateInfoKHR& value)
@@ -3065,15 +3305,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModePropertiesKHR& v
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneCapabilitiesKHR& value)
 {
-    encoder->EncodeFlagsValue(value.supportedAlpha);
-    EncodeStruct(encoder, value.minSrcPosition);
-    EncodeStruct(encoder, value.maxSrcPosition);
-    EncodeStruct(encoder, value.minSrcExtent);
-    EncodeStruct(encoder, value.maxSrcExtent);
-    EncodeStruct(encoder, value.minDstPosition);
-    EncodeStruct(encoder, value.maxDstPosition);
-    EncodeStruct(encoder, value.minDstExtent);
-    EncodeStruct(encoder, value.maxDstExtent);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDisplayPlaneCapabilitiesKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlanePropertiesKHR& value)
@@ -3328,9 +3570,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePushDescripto
 
 void EncodeStruct(ParameterEncoder* encoder, const VkRectLayerKHR& value)
 {
-    EncodeStruct(encoder, value.offset);
-    EncodeStruct(encoder, value.extent);
-    encoder->EncodeUInt32Value(value.layer);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkRectLayerKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionKHR& value)
@@ -4016,8 +4266,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceCon
 
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportWScalingNV& value)
 {
-    encoder->EncodeFloatValue(value.xcoeff);
-    encoder->EncodeFloatValue(value.ycoeff);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkViewportWScalingNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportWScalingStateCreateInfoNV& value)
@@ -4076,7 +4335,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCounterCreateInfoE
 
 void EncodeStruct(ParameterEncoder* encoder, const VkRefreshCycleDurationGOOGLE& value)
 {
-    encoder->EncodeUInt64Value(value.refreshDuration);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkRefreshCycleDurationGOOGLE* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPastPresentationTimingGOOGLE& value)
@@ -4111,10 +4380,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewPerV
 
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportSwizzleNV& value)
 {
-    encoder->EncodeEnumValue(value.x);
-    encoder->EncodeEnumValue(value.y);
-    encoder->EncodeEnumValue(value.z);
-    encoder->EncodeEnumValue(value.w);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkViewportSwizzleNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportSwizzleStateCreateInfoNV& value)
@@ -4184,8 +4460,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationDepthC
 
 void EncodeStruct(ParameterEncoder* encoder, const VkXYColorEXT& value)
 {
-    encoder->EncodeFloatValue(value.x);
-    encoder->EncodeFloatValue(value.y);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkXYColorEXT* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkHdrMetadataEXT& value)
@@ -4339,8 +4624,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferFormat
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationEXT& value)
 {
-    encoder->EncodeFloatValue(value.x);
-    encoder->EncodeFloatValue(value.y);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSampleLocationEXT* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationsInfoEXT& value)
@@ -4466,9 +4760,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuilt
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesEXT& value)
 {
-    encoder->EncodeUInt64Value(value.drmFormatModifier);
-    encoder->EncodeUInt32Value(value.drmFormatModifierPlaneCount);
-    encoder->EncodeFlagsValue(value.drmFormatModifierTilingFeatures);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesEXT* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesListEXT& value)
@@ -4578,9 +4880,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShadingRateIm
 
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleLocationNV& value)
 {
-    encoder->EncodeUInt32Value(value.pixelX);
-    encoder->EncodeUInt32Value(value.pixelY);
-    encoder->EncodeUInt32Value(value.sample);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkCoarseSampleLocationNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleOrderCustomNV& value)
@@ -4735,12 +5045,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTransformMatrixKHR& value)
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAabbPositionsKHR& value)
 {
-    encoder->EncodeFloatValue(value.minX);
-    encoder->EncodeFloatValue(value.minY);
-    encoder->EncodeFloatValue(value.minZ);
-    encoder->EncodeFloatValue(value.maxX);
-    encoder->EncodeFloatValue(value.maxY);
-    encoder->EncodeFloatValue(value.maxZ);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkAabbPositionsKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInstanceKHR& value)
@@ -4854,8 +5169,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttribu
 
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDescriptionEXT& value)
 {
-    encoder->EncodeUInt32Value(value.binding);
-    encoder->EncodeUInt32Value(value.divisor);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDescriptionEXT* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputDivisorStateCreateInfoEXT& value)
@@ -4918,8 +5242,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPro
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV& value)
 {
-    encoder->EncodeUInt32Value(value.taskCount);
-    encoder->EncodeUInt32Value(value.firstTask);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value)
@@ -5404,26 +5737,62 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsPipelineShaderGroup
 
 void EncodeStruct(ParameterEncoder* encoder, const VkBindShaderGroupIndirectCommandNV& value)
 {
-    encoder->EncodeUInt32Value(value.groupIndex);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkBindShaderGroupIndirectCommandNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkBindIndexBufferIndirectCommandNV& value)
 {
-    encoder->EncodeVkDeviceAddressValue(value.bufferAddress);
-    encoder->EncodeUInt32Value(value.size);
-    encoder->EncodeEnumValue(value.indexType);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkBindIndexBufferIndirectCommandNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkBindVertexBufferIndirectCommandNV& value)
 {
-    encoder->EncodeVkDeviceAddressValue(value.bufferAddress);
-    encoder->EncodeUInt32Value(value.size);
-    encoder->EncodeUInt32Value(value.stride);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkBindVertexBufferIndirectCommandNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSetStateFlagsIndirectCommandNV& value)
 {
-    encoder->EncodeUInt32Value(value.data);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSetStateFlagsIndirectCommandNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsStreamNV& value)
@@ -5666,22 +6035,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureMatrix
 
 void EncodeStruct(ParameterEncoder* encoder, const VkSRTDataNV& value)
 {
-    encoder->EncodeFloatValue(value.sx);
-    encoder->EncodeFloatValue(value.a);
-    encoder->EncodeFloatValue(value.b);
-    encoder->EncodeFloatValue(value.pvx);
-    encoder->EncodeFloatValue(value.sy);
-    encoder->EncodeFloatValue(value.c);
-    encoder->EncodeFloatValue(value.pvy);
-    encoder->EncodeFloatValue(value.sz);
-    encoder->EncodeFloatValue(value.pvz);
-    encoder->EncodeFloatValue(value.qx);
-    encoder->EncodeFloatValue(value.qy);
-    encoder->EncodeFloatValue(value.qz);
-    encoder->EncodeFloatValue(value.qw);
-    encoder->EncodeFloatValue(value.tx);
-    encoder->EncodeFloatValue(value.ty);
-    encoder->EncodeFloatValue(value.tz);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkSRTDataNV* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureSRTMotionInstanceNV& value)
@@ -5975,15 +6339,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiDrawProp
 
 void EncodeStruct(ParameterEncoder* encoder, const VkMultiDrawInfoEXT& value)
 {
-    encoder->EncodeUInt32Value(value.firstVertex);
-    encoder->EncodeUInt32Value(value.vertexCount);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkMultiDrawInfoEXT* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkMultiDrawIndexedInfoEXT& value)
 {
-    encoder->EncodeUInt32Value(value.firstIndex);
-    encoder->EncodeUInt32Value(value.indexCount);
-    encoder->EncodeInt32Value(value.vertexOffset);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkMultiDrawIndexedInfoEXT* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& value)
@@ -6040,10 +6421,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLinearColorAt
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildRangeInfoKHR& value)
 {
-    encoder->EncodeUInt32Value(value.primitiveCount);
-    encoder->EncodeUInt32Value(value.primitiveOffset);
-    encoder->EncodeUInt32Value(value.firstVertex);
-    encoder->EncodeUInt32Value(value.transformOffset);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkAccelerationStructureBuildRangeInfoKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryTrianglesDataKHR& value)
@@ -6250,16 +6638,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPip
 
 void EncodeStruct(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR& value)
 {
-    encoder->EncodeVkDeviceAddressValue(value.deviceAddress);
-    encoder->EncodeVkDeviceSizeValue(value.stride);
-    encoder->EncodeVkDeviceSizeValue(value.size);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR& value)
 {
-    encoder->EncodeUInt32Value(value.width);
-    encoder->EncodeUInt32Value(value.height);
-    encoder->EncodeUInt32Value(value.depth);
+    encoder->EncodeFixedLayoutStruct(value);
+}
+
+void EncodeStructArray(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR* value, size_t len, bool omit_data, bool omit_addr)
+{
+    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        encoder->EncodeFixedLayoutStructArray(value, len);
+    }
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayQueryFeaturesKHR& value)
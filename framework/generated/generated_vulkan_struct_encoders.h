@@ -147,6 +147,44 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassBeginInfo& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkExtent2D* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkExtent3D* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkOffset2D* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkOffset3D* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkRect2D* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkDispatchIndirectCommand* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrawIndexedIndirectCommand* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrawIndirectCommand* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageSubresourceRange* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkFormatProperties* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageFormatProperties* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkMemoryType* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkPhysicalDeviceSparseProperties* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkQueueFamilyProperties* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageSubresource* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkSparseImageFormatProperties* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkSparseImageMemoryRequirements* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkSubresourceLayout* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkComponentMapping* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkVertexInputBindingDescription* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkVertexInputAttributeDescription* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkViewport* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkStencilOpState* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkPipelineColorBlendAttachmentState* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkPushConstantRange* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkDescriptorPoolSize* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkAttachmentDescription* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkAttachmentReference* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkSubpassDependency* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkBufferCopy* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageSubresourceLayers* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkBufferImageCopy* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkClearDepthStencilValue* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkClearRect* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageCopy* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkImageResolve* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupProperties& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryInfo& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryInfo& value);
@@ -216,6 +254,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMaintenance3P
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutSupport& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDrawParametersFeatures& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkInputAttachmentAspectReference* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkExternalMemoryProperties* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Features& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Properties& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Features& value);
@@ -325,6 +366,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceImageMemoryRequiremen
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormatKHR& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkSurfaceFormatKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSwapchainCreateInfoKHR& value);
@@ -342,6 +386,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlanePropertiesKHR&
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplaySurfaceCreateInfoKHR& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkDisplayModeParametersKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkDisplayPlaneCapabilitiesKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPresentInfoKHR& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkXlibSurfaceCreateInfoKHR& value);
@@ -384,6 +431,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRectLayerKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionsKHR& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkRectLayerKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSharedPresentSurfaceCapabilitiesKHR& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceWin32HandleInfoKHR& value);
@@ -501,6 +550,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceCon
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportWScalingNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportWScalingStateCreateInfoNV& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkViewportWScalingNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2EXT& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPowerInfoEXT& value);
@@ -513,11 +564,15 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPastPresentationTimingGOOGL
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimeGOOGLE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimesInfoGOOGLE& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkRefreshCycleDurationGOOGLE* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportSwizzleNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportSwizzleStateCreateInfoNV& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkViewportSwizzleNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDiscardRectangleStateCreateInfoEXT& value);
 
@@ -530,6 +585,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationDepthC
 void EncodeStruct(ParameterEncoder* encoder, const VkXYColorEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkHdrMetadataEXT& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkXYColorEXT* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIOSSurfaceCreateInfoMVK& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkMacOSSurfaceCreateInfoMVK& value);
@@ -557,6 +614,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineSampleLocationsStat
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSampleLocationsPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMultisamplePropertiesEXT& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkSampleLocationEXT* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value);
@@ -577,6 +636,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierPrope
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierProperties2EXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesList2EXT& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesEXT* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationCacheCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleValidationCacheCreateInfoEXT& value);
 
@@ -588,6 +649,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleLocationNV& val
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleOrderCustomNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkCoarseSampleLocationNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryTrianglesNV& value);
@@ -604,6 +667,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTransformMatrixKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAabbPositionsKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInstanceKHR& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkAabbPositionsKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value);
 
@@ -627,6 +692,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDe
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputDivisorStateCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDescriptionEXT* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentFrameTokenGGP& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& value);
@@ -635,6 +702,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderFea
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value);
@@ -733,6 +802,11 @@ void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutCreat
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsMemoryRequirementsInfoNV& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkBindShaderGroupIndirectCommandNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkBindIndexBufferIndirectCommandNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkBindVertexBufferIndirectCommandNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkSetStateFlagsIndirectCommandNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInheritedViewportScissorFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceViewportScissorInfoNV& value);
 
@@ -766,6 +840,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSRTDataNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureSRTMotionInstanceNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkSRTDataNV* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value);
@@ -823,6 +899,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiDrawProp
 void EncodeStruct(ParameterEncoder* encoder, const VkMultiDrawInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMultiDrawIndexedInfoEXT& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkMultiDrawInfoEXT* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkMultiDrawIndexedInfoEXT* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerBorderColorComponentMappingCreateInfoEXT& value);
 
@@ -850,6 +929,8 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyMemoryToAccelerationStr
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildSizesInfoKHR& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkAccelerationStructureBuildRangeInfoKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineInterfaceCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoKHR& value);
@@ -858,6 +939,9 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPip
 void EncodeStruct(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR& value);
 
+void EncodeStructArray(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+void EncodeStructArray(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR* value, size_t len, bool omit_data = false, bool omit_addr = false);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayQueryFeaturesKHR& value);
 
 GFXRECON_END_NAMESPACE(encode)
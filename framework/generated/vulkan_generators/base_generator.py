@@ -303,6 +303,20 @@ class BaseGenerator(OutputGenerator):
     # Default C++ code indentation size.
     INDENT_SIZE = 4
 
+    # Sizes of the scalar types that are written to the capture file with the same size and representation that they
+    # have in memory.  Enum and flags types are handled separately.
+    FIXED_LAYOUT_TYPE_SIZES = {
+        'float': 4,
+        'int32_t': 4,
+        'uint32_t': 4,
+        'VkBool32': 4,
+        'VkSampleMask': 4,
+        'int64_t': 8,
+        'uint64_t': 8,
+        'VkDeviceSize': 8,
+        'VkDeviceAddress': 8
+    }
+
     def __init__(
         self,
         process_cmds,
@@ -338,6 +352,8 @@ class BaseGenerator(OutputGenerator):
             )  # Map of extension struct names to a Boolean value indicating that a struct member has a handle type
             self.extension_structs_with_handle_ptrs = dict(
             )  # Map of extension struct names to a Boolean value indicating that a struct member with a handle type is a pointer
+            self.fixed_layout_structs = dict(
+            )  # Map of struct names to the layout info of structs with a fixed memory layout, for all processed features
         if self.process_cmds:
             self.feature_cmd_params = dict(
             )  # Map of cmd names to lists of per-parameter ValueInfo
@@ -941,6 +957,69 @@ class BaseGenerator(OutputGenerator):
                 return cmd_entry[param_name]
         return None
 
+    def get_fixed_layout_struct_info(self, typename):
+        """Determine if a struct has a fixed memory layout, where all members are scalar values or structs with a fixed
+        layout, and there is no padding between or after the members.  Structs with a fixed layout are written to the
+        capture file with the same representation that they have in memory, and can be encoded and decoded with a
+        single copy.  Returns a (size, alignment, struct_members) tuple for structs with a fixed layout, where
+        struct_members is a list of (name, type) tuples for the members with a struct type, or None.
+        """
+        if typename in self.fixed_layout_structs:
+            return self.fixed_layout_structs[typename]
+
+        # Structs from previously processed features have already been added to the fixed layout struct map.
+        if (typename not in self.feature_struct_members
+            ) or self.is_struct_black_listed(typename):
+            return None
+
+        size = 0
+        alignment = 1
+        struct_members = []
+        for value in self.feature_struct_members[typename]:
+            if value.is_pointer or value.is_array or value.bitfield_width or self.is_generic_struct_handle_value(
+                typename, value.name
+            ):
+                return None
+
+            if self.is_struct(value.base_type):
+                member_info = self.get_fixed_layout_struct_info(
+                    value.base_type
+                )
+                if not member_info:
+                    return None
+                member_size, member_alignment, _ = member_info
+                struct_members.append((value.name, value.base_type))
+            elif self.is_enum(value.base_type):
+                member_size = member_alignment = 4
+            elif self.is_flags(value.base_type):
+                member_size = member_alignment = 8 if self.flags_types[
+                    value.base_type] == 'VkFlags64' else 4
+            elif value.base_type in self.FIXED_LAYOUT_TYPE_SIZES:
+                member_size = member_alignment = self.FIXED_LAYOUT_TYPE_SIZES[
+                    value.base_type]
+            else:
+                return None
+
+            if (size % member_alignment) != 0:
+                return None
+
+            size += member_size
+            alignment = max(alignment, member_alignment)
+
+        if (size == 0) or ((size % alignment) != 0):
+            return None
+
+        self.fixed_layout_structs[typename] = (
+            size, alignment, struct_members
+        )
+        return self.fixed_layout_structs[typename]
+
+    def is_fixed_layout_struct(self, typename):
+        """Determine if a struct has a fixed memory layout, as described by get_fixed_layout_struct_info()."""
+        if self.get_fixed_layout_struct_info(typename):
+            return True
+        return False
+
     def is_generic_struct_handle_value(self, struct_name, member_name):
         """Determine if a struct member contains a generic handle value.  Generic handles have an
         integer type such as uint64_t, with an associated enum value defining the specific
@@ -59,6 +59,7 @@ from decode_pnext_struct_generator import DecodePNextStructGenerator, DecodePNex
 # Consumers
 from vulkan_consumer_header_generator import VulkanConsumerHeaderGenerator, VulkanConsumerHeaderGeneratorOptions
 from vulkan_ascii_consumer_body_generator import VulkanAsciiConsumerBodyGenerator, VulkanAsciiConsumerBodyGeneratorOptions
+from vulkan_export_consumer_body_generator import VulkanExportConsumerBodyGenerator, VulkanExportConsumerBodyGeneratorOptions
 from vulkan_replay_consumer_body_generator import VulkanReplayConsumerBodyGenerator, VulkanReplayConsumerBodyGeneratorOptions
 from vulkan_referenced_resource_consumer_header_generator import VulkanReferencedResourceHeaderGenerator, VulkanReferencedResourceHeaderGeneratorOptions
 from vulkan_referenced_resource_consumer_body_generator import VulkanReferencedResourceBodyGenerator, VulkanReferencedResourceBodyGeneratorOptions
@@ -316,6 +317,23 @@ def make_gen_opts(args):
         )
     ]
 
+    gen_opts['generated_vulkan_export_consumer.h'] = [
+        VulkanConsumerHeaderGenerator,
+        VulkanConsumerHeaderGeneratorOptions(
+            class_name='VulkanExportConsumer',
+            base_class_header='vulkan_export_consumer_base.h',
+            is_override=True,
+            filename='generated_vulkan_export_consumer.h',
+            directory=directory,
+            blacklists=blacklists,
+            platform_types=platform_types,
+            prefix_text=prefix_strings + vk_prefix_strings,
+            protect_file=True,
+            protect_feature=False,
+            extraVulkanHeaders=extraVulkanHeaders
+        )
+    ]
+
     gen_opts['generated_vulkan_referenced_resource_consumer.h'] = [
         VulkanReferencedResourceHeaderGenerator,
         VulkanReferencedResourceHeaderGeneratorOptions(
@@ -363,6 +381,20 @@ def make_gen_opts(args):
         )
     ]
 
+    gen_opts['generated_vulkan_export_consumer.cpp'] = [
+        VulkanExportConsumerBodyGenerator,
+        VulkanExportConsumerBodyGeneratorOptions(
+            filename='generated_vulkan_export_consumer.cpp',
+            directory=directory,
+            blacklists=blacklists,
+            platform_types=platform_types,
+            prefix_text=prefix_strings + vk_prefix_strings,
+            protect_file=False,
+            protect_feature=False,
+            extraVulkanHeaders=extraVulkanHeaders
+        )
+    ]
+
     gen_opts['generated_vulkan_replay_consumer.cpp'] = [
         VulkanReplayConsumerBodyGenerator,
         VulkanReplayConsumerBodyGeneratorOptions(
@@ -352,16 +352,25 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         body += indent + self.make_end_api_call(name, values, return_type)
         indent = indent[0:-self.INDENT_SIZE]
         body += indent + '}\n'
+
+        # State tracking for destroy calls does not use the encoded parameters, so it is performed separately from
+        # encoding, which is skipped when the capture manager is only tracking state.
+        if self.is_destroy_call(name):
+            body += '\n'
+            body += indent + self.make_destroy_tracking_call(name, values)
         return body
 
+    def is_destroy_call(self, name):
+        return name.startswith('vkDestroy') or name.startswith('vkFree') or (
+            name == 'vkReleasePerformanceConfigurationINTEL'
+        )
+
     def make_begin_api_call(self, name, values):
         if name.startswith('vkCreate') or name.startswith(
             'vkAllocate'
-        ) or name.startswith('vkDestroy') or name.startswith(
-            'vkFree'
         ) or self.retrieves_handles(values) or (
             values[0].base_type == 'VkCommandBuffer'
-        ) or (name == 'vkReleasePerformanceConfigurationINTEL'):
+        ):
             return 'auto encoder = VulkanCaptureManager::Get()->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_{});\n'.format(
                 name
             )
@@ -495,28 +504,6 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
                         handle.name, info_name
                     )
 
-        elif name.startswith('vkDestroy') or name.startswith('vkFree') or (
-            name == 'vkReleasePerformanceConfigurationINTEL'
-        ):
-            handle = None
-            if name in ['vkDestroyInstance', 'vkDestroyDevice']:
-                # Instance/device destroy calls are special case where the target handle is the first parameter
-                handle = values[0]
-            else:
-                # The destroy target is the second parameter, except for pool based allocations where it is the last parameter.
-                handle = values[1]
-                if ("Pool" in handle.base_type) and name.startswith('vkFree'):
-                    handle = values[3]
-
-            if handle.is_array:
-                decl += 'EndDestroyApiCallCapture<{}Wrapper>({}, {})'.format(
-                    handle.base_type[2:], handle.array_length, handle.name
-                )
-            else:
-                decl += 'EndDestroyApiCallCapture<{}Wrapper>({})'.format(
-                    handle.base_type[2:], handle.name
-                )
-
         elif values[0].base_type == 'VkCommandBuffer':
             get_handles_expr = self.make_get_command_handles_expr(
                 name, values[1:]
@@ -533,6 +520,26 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         decl += ';\n'
         return decl
 
+    def make_destroy_tracking_call(self, name, values):
+        handle = None
+        if name in ['vkDestroyInstance', 'vkDestroyDevice']:
+            # Instance/device destroy calls are special case where the target handle is the first parameter
+            handle = values[0]
+        else:
+            # The destroy target is the second parameter, except for pool based allocations where it is the last parameter.
+            handle = values[1]
+            if ("Pool" in handle.base_type) and name.startswith('vkFree'):
+                handle = values[3]
+
+        if handle.is_array:
+            return 'VulkanCaptureManager::Get()->TrackDestroyApiCall<{}Wrapper>({}, {});\n'.format(
+                handle.base_type[2:], handle.array_length, handle.name
+            )
+        else:
+            return 'VulkanCaptureManager::Get()->TrackDestroyApiCall<{}Wrapper>({});\n'.format(
+                handle.base_type[2:], handle.name
+            )
+
     def make_handle_wrapping(self, values, indent):
         expr = ''
         for value in values:
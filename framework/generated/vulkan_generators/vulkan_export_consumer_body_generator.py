@@ -0,0 +1,160 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2021 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+import sys, inspect
+from base_generator import BaseGenerator, BaseGeneratorOptions, write
+
+
+class VulkanExportConsumerBodyGeneratorOptions(BaseGeneratorOptions):
+    """Options for generating a C++ class for Vulkan capture file to columnar export file generation."""
+
+    def __init__(
+        self,
+        blacklists=None,  # Path to JSON file listing apicalls and structs to ignore.
+        platform_types=None,  # Path to JSON file listing platform (WIN32, X11, etc.) defined types.
+        filename=None,
+        directory='.',
+        prefix_text='',
+        protect_file=False,
+        protect_feature=True,
+        extraVulkanHeaders=[]
+    ):
+        BaseGeneratorOptions.__init__(
+            self,
+            blacklists,
+            platform_types,
+            filename,
+            directory,
+            prefix_text,
+            protect_file,
+            protect_feature,
+            extraVulkanHeaders=extraVulkanHeaders
+        )
+
+
+class VulkanExportConsumerBodyGenerator(BaseGenerator):
+    """VulkanExportConsumerBodyGenerator - subclass of BaseGenerator.
+    Generates C++ member definitions for the VulkanExportConsumer class responsible for
+    writing one row of API call summary data (call ID, return value, and key handle IDs)
+    per decoded Vulkan API call to a columnar export file.
+    """
+
+    def __init__(
+        self, err_file=sys.stderr, warn_file=sys.stderr, diag_file=sys.stdout
+    ):
+        BaseGenerator.__init__(
+            self,
+            process_cmds=True,
+            process_structs=False,
+            feature_break=True,
+            err_file=err_file,
+            warn_file=warn_file,
+            diag_file=diag_file
+        )
+
+    def beginFile(self, gen_opts):
+        """Method override."""
+        BaseGenerator.beginFile(self, gen_opts)
+
+        includes = inspect.cleandoc(
+            '''
+            #include "generated/generated_vulkan_export_consumer.h"
+            #include "util/defines.h"
+            '''
+        )
+        write(includes, file=self.outFile)
+        self.includeVulkanHeaders(gen_opts)
+        namespace = inspect.cleandoc(
+            '''
+            GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+            GFXRECON_BEGIN_NAMESPACE(decode)
+            '''
+        )
+        write(namespace, file=self.outFile)
+
+    def endFile(self):
+        """Method override."""
+        body = inspect.cleandoc(
+            '''
+            GFXRECON_END_NAMESPACE(decode)
+            GFXRECON_END_NAMESPACE(gfxrecon)
+            '''
+        )
+        write(body, file=self.outFile)
+
+        # Finish processing in superclass
+        BaseGenerator.endFile(self)
+
+    def need_feature_generation(self):
+        """Indicates that the current feature has C++ code to generate."""
+        if self.feature_cmd_params:
+            return True
+        return False
+
+    def generate_feature(self):
+        """Performs C++ code generation for the feature."""
+        first = True
+        for cmd in self.get_filtered_cmd_names():
+            info = self.feature_cmd_params[cmd]
+            return_type = info[0]
+            values = info[2]
+
+            cmddef = '' if first else '\n'
+            cmddef += self.make_consumer_func_decl(
+                return_type, 'VulkanExportConsumer::Process_' + cmd, values
+            ) + '\n'
+            cmddef += '{\n'
+            cmddef += self.make_consumer_func_body(return_type, cmd, values)
+            cmddef += '}'
+            write(cmddef, file=self.outFile)
+            first = False
+
+    def make_consumer_func_body(self, return_type, name, values):
+        """Return VulkanExportConsumer class member function definition.
+        The dispatch handle is the first parameter when it is a handle.  The object handle is the first
+        subsequent handle parameter or, when there is none, the first handle of the first output handle
+        array (the handle created by vkCreate*/vkAllocate* calls)."""
+        dispatch_handle = 'format::kNullHandleId'
+        object_handle = None
+        created_handle = None
+
+        for index, value in enumerate(values):
+            if self.is_handle(value.base_type):
+                if not value.is_pointer:
+                    if index == 0:
+                        dispatch_handle = value.name
+                    elif object_handle is None:
+                        object_handle = value.name
+                elif created_handle is None:
+                    created_handle = 'GetFirstHandleId({})'.format(value.name)
+
+        if object_handle is None:
+            object_handle = created_handle if created_handle else 'format::kNullHandleId'
+
+        if 'void' in return_type:
+            return_value = 'false, 0'
+        else:
+            return_value = 'true, static_cast<int64_t>(returnValue)'
+
+        return '    AddApiCall(call_info, format::ApiCallId::ApiCall_{}, {}, {}, {});\n'.format(
+            name, return_value, dispatch_handle, object_handle
+        )
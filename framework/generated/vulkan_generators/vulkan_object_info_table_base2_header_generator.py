@@ -94,11 +94,13 @@ class VulkanObjectInfoTableBase2HeaderGenerator(BaseGenerator):
         const_get_code = ''
         get_code = ''
         visit_code = ''
+        visit_ids_code = ''
         map_code = ''
 
         for handle_name in sorted(self.handle_names):
             if handle_name in self.DUPLICATE_HANDLE_TYPES:
                 continue
+            type_name = handle_name
             handle_name = handle_name[2:]
             handle_info = handle_name + 'Info'
             handle_map = handle_name[0].lower() + handle_name[1:] + '_map_'
@@ -107,6 +109,7 @@ class VulkanObjectInfoTableBase2HeaderGenerator(BaseGenerator):
             const_get_code += '    const {0}* Get{0}(format::HandleId id) const {{ return GetObjectInfo<{0}>(id, &{1}); }}\n'.format(handle_info, handle_map)
             get_code += '    {0}* Get{0}(format::HandleId id) {{ return GetObjectInfo<{0}>(id, &{1}); }}\n'.format(handle_info, handle_map)
             visit_code += '    void Visit{0}(std::function<void(const {0}*)> visitor) const {{  for (const auto& entry : {1}) {{ visitor(&entry.second); }}  }}\n'.format(handle_info, handle_map)
+            visit_ids_code += '        for (const auto& entry : {0}) {{ visitor("{1}", entry.first); }}\n'.format(handle_map, type_name)
             map_code += '     std::unordered_map<format::HandleId, {0}> {1};\n'.format(handle_info, handle_map)
 
         self.newline()
@@ -126,6 +129,11 @@ class VulkanObjectInfoTableBase2HeaderGenerator(BaseGenerator):
         code += '\n'
         code += visit_code
         code += '\n'
+        code += '    void VisitObjectIds(std::function<void(const char*, format::HandleId)> visitor) const\n'
+        code += '    {\n'
+        code += visit_ids_code
+        code += '    }\n'
+        code += '\n'
         code += '  protected:\n'
         code += map_code
         code += '};\n'
@@ -220,19 +220,24 @@ class VulkanReplayConsumerBodyGenerator(
         else:
             call_expr = '{}({})'.format(dispatchfunc, arglist)
 
+        # Mark the start of the consumer call and the driver call for the replay profiler.
+        body += '    BeginProfiledCall("{}");\n'.format(name)
         if preexpr:
             body += '\n'.join(
                 ['    ' + val if val else val for val in preexpr]
             )
             body += '\n'
             body += '\n'
+        body += '    BeginProfiledDriverCall();\n'
         if return_type == 'VkResult':
             body += '    VkResult replay_result = {};\n'.format(call_expr)
+            body += '    EndProfiledDriverCall();\n'
             body += '    CheckResult("{}", returnValue, replay_result);\n'.format(
                 name
             )
         else:
             body += '    {};\n'.format(call_expr)
+            body += '    EndProfiledDriverCall();\n'
         if postexpr:
             body += '\n'
             body += '\n'.join(
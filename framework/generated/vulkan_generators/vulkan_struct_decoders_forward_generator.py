@@ -112,3 +112,18 @@ class VulkanStructDecodersForwardGenerator(BaseGenerator):
                 .format(struct),
                 file=self.outFile
             )
+
+        # Structs with a fixed memory layout have array decoders that copy the entire array from the parameter buffer.
+        fixed_layout_structs = [
+            struct for struct in self.get_filtered_struct_names()
+            if self.is_fixed_layout_struct(struct)
+        ]
+        if fixed_layout_structs:
+            self.newline()
+
+        for struct in fixed_layout_structs:
+            write(
+                'size_t DecodeStructArray(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_{name}* wrappers, {name}* values, size_t len);'
+                .format(name=struct),
+                file=self.outFile
+            )
@@ -117,14 +117,38 @@ class VulkanStructEncodersBodyGenerator(BaseGenerator):
                 struct
             )
             body += '{\n'
-            body += self.make_struct_body(
-                struct, self.feature_struct_members[struct], 'value.'
-            )
+            if self.is_fixed_layout_struct(struct):
+                # The in-memory representation of the struct matches its encoded representation.
+                body += '    encoder->EncodeFixedLayoutStruct(value);\n'
+            else:
+                body += self.make_struct_body(
+                    struct, self.feature_struct_members[struct], 'value.'
+                )
             body += '}'
+
+            if self.is_fixed_layout_struct(struct):
+                body += '\n\n'
+                body += self.make_fixed_layout_struct_array_encoder(struct)
+
             write(body, file=self.outFile)
 
             first = False
 
+    def make_fixed_layout_struct_array_encoder(self, name):
+        """Generate an array encoder for a struct with a fixed memory layout, which writes the array with a single copy."""
+        body = 'void EncodeStructArray(ParameterEncoder* encoder, const {}* value, size_t len, bool omit_data, bool omit_addr)\n'.format(
+            name
+        )
+        body += '{\n'
+        body += '    encoder->EncodeStructArrayPreamble(value, len, omit_data, omit_addr);\n'
+        body += '\n'
+        body += '    if ((value != nullptr) && (len > 0) && !omit_data)\n'
+        body += '    {\n'
+        body += '        encoder->EncodeFixedLayoutStructArray(value, len);\n'
+        body += '    }\n'
+        body += '}'
+        return body
+
     def make_struct_body(self, name, values, prefix):
         """Command definition."""
         # Build array of lines for function body
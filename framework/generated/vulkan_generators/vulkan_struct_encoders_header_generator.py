@@ -114,3 +114,18 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
                 .format(struct),
                 file=self.outFile
             )
+
+        # Arrays of structs with a fixed memory layout are encoded with a single write.
+        fixed_layout_structs = [
+            struct for struct in self.get_filtered_struct_names()
+            if self.is_fixed_layout_struct(struct)
+        ]
+        if fixed_layout_structs:
+            self.newline()
+
+        for struct in fixed_layout_structs:
+            write(
+                'void EncodeStructArray(ParameterEncoder* encoder, const {}* value, size_t len, bool omit_data = false, bool omit_addr = false);'
+                .format(struct),
+                file=self.outFile
+            )
@@ -23,10 +23,12 @@
 
 #include "graphics/fps_info.h"
 
-#include "util/date_time.h"
 #include "util/logging.h"
+#include "util/platform.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <utility>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -36,13 +38,17 @@ static double GetElapsedSeconds(uint64_t start_time, uint64_t end_time)
     return util::datetime::ConvertTimestampToSeconds(util::datetime::DiffTimestamps(start_time, end_time));
 }
 
-static void
-WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame, int64_t start_time, int64_t end_time)
+static void WriteFpsToConsole(const char* prefix,
+                              uint64_t    start_frame,
+                              uint64_t    end_frame,
+                              int64_t     start_time,
+                              int64_t     end_time,
+                              uint64_t    repeated_frames = 0)
 {
     assert(end_frame >= start_frame && end_time >= start_time);
 
     double   diff_time_sec = GetElapsedSeconds(start_time, end_time);
-    uint64_t total_frames  = (end_frame - start_frame) + 1;
+    uint64_t total_frames  = (end_frame - start_frame) + 1 + repeated_frames;
     double   fps           = (diff_time_sec > 0.0) ? (static_cast<double>(total_frames) / diff_time_sec) : 0.0;
     GFXRECON_WRITE_CONSOLE("%s %f fps, %f seconds, %" PRIu64 " frame%s, framerange %" PRIu64 "-%" PRIu64,
                            prefix,
@@ -54,12 +60,21 @@ WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame,
                            end_frame);
 }
 
+static double ConvertToMilliseconds(int64_t time)
+{
+    return util::datetime::ConvertTimestampToMilliseconds(time);
+}
+
+FpsInfo::FpsInfo(bool record_frame_statistics) : record_frame_statistics_(record_frame_statistics) {}
+
 void FpsInfo::Begin(uint64_t start_frame)
 {
     // Save the start frame/time information for the FPS result.
     replay_start_frame_ = start_frame;
     start_time_         = util::datetime::GetTimestamp();
     replay_start_time_  = start_time_;
+
+    ResetFrameStatistics(start_frame, start_time_);
 }
 
 void FpsInfo::EndAndLog(uint64_t end_frame)
@@ -73,14 +88,230 @@ void FpsInfo::EndAndLog(uint64_t end_frame)
     }
     GFXRECON_WRITE_CONSOLE("Total time: %f seconds", GetElapsedSeconds(start_time_, end_time));
 
-    WriteFpsToConsole(
-        "Replay FPS:", replay_start_frame_, end_frame + replay_start_frame_ - 1, replay_start_time_, end_time);
+    // Offset the replay start time by the time spent preloading during replay, so that it is not included in the FPS.
+    int64_t replay_start_time = replay_start_time_;
+    if (preload_end_time_ > preload_start_time_)
+    {
+        GFXRECON_WRITE_CONSOLE("Preload time: %f seconds", GetElapsedSeconds(preload_start_time_, preload_end_time_));
+
+        if (preload_start_time_ >= replay_start_time_)
+        {
+            replay_start_time += util::datetime::DiffTimestamps(preload_start_time_, preload_end_time_);
+        }
+    }
+
+    // Each loop iteration after the first replays frames that are not counted by the end frame.
+    uint64_t repeated_frames =
+        loop_iteration_times_.empty() ? 0 : (loop_frame_count_ * (loop_iteration_times_.size() - 1));
+
+    WriteFpsToConsole("Replay FPS:",
+                      replay_start_frame_,
+                      end_frame + replay_start_frame_ - 1,
+                      replay_start_time,
+                      end_time,
+                      repeated_frames);
+
+    if (!loop_iteration_times_.empty())
+    {
+        int64_t min_time   = *std::min_element(loop_iteration_times_.begin(), loop_iteration_times_.end());
+        int64_t max_time   = *std::max_element(loop_iteration_times_.begin(), loop_iteration_times_.end());
+        int64_t total_time = 0;
+
+        for (size_t i = 0; i < loop_iteration_times_.size(); ++i)
+        {
+            double seconds = util::datetime::ConvertTimestampToSeconds(loop_iteration_times_[i]);
+            double fps     = (seconds > 0.0) ? (static_cast<double>(loop_frame_count_) / seconds) : 0.0;
+            GFXRECON_WRITE_CONSOLE("Loop iteration %" PRIu64 ": %f fps, %f seconds",
+                                   static_cast<uint64_t>(i + 1),
+                                   fps,
+                                   seconds);
+            total_time += loop_iteration_times_[i];
+        }
+
+        GFXRECON_WRITE_CONSOLE("Loop iteration time (seconds): min %f, mean %f, max %f",
+                               util::datetime::ConvertTimestampToSeconds(min_time),
+                               util::datetime::ConvertTimestampToSeconds(total_time) /
+                                   static_cast<double>(loop_iteration_times_.size()),
+                               util::datetime::ConvertTimestampToSeconds(max_time));
+    }
+
+    if (!frame_statistics_.empty())
+    {
+        GFXRECON_WRITE_CONSOLE("Frame statistics (ms):");
+        WritePercentilesToConsole("  Frame: ", &FrameStatistics::frame_time);
+        WritePercentilesToConsole("  CPU:   ", &FrameStatistics::cpu_time);
+        WritePercentilesToConsole("  Decode:", &FrameStatistics::decode_time);
+        WritePercentilesToConsole("  Driver:", &FrameStatistics::driver_time);
+        WritePercentilesToConsole("  Wait:  ", &FrameStatistics::wait_time);
+    }
 }
 
 void FpsInfo::ProcessStateEndMarker(uint64_t frame)
 {
     replay_start_frame_ = frame;
     replay_start_time_  = util::datetime::GetTimestamp();
+
+    // Frames replayed while loading trimmed state are not part of the replay statistics.
+    frame_statistics_.clear();
+    ResetFrameStatistics(frame, replay_start_time_);
+}
+
+void FpsInfo::EndFrame()
+{
+    int64_t end_time = util::datetime::GetTimestamp();
+
+    // EndFrame() is called from within the present's driver call, so the driver time up to this point belongs to the
+    // frame that is ending and the remainder of the call belongs to the next frame.
+    frame_driver_time_ += end_time - driver_call_begin_time_;
+    driver_call_begin_time_ = end_time;
+
+    FrameStatistics stats;
+    stats.frame       = current_frame_;
+    stats.frame_time  = end_time - frame_begin_time_;
+    stats.wait_time   = std::min(frame_wait_time_, stats.frame_time);
+    stats.cpu_time    = stats.frame_time - stats.wait_time;
+    stats.driver_time = std::min(std::max<int64_t>(frame_driver_time_ - frame_wait_time_, 0), stats.cpu_time);
+    stats.decode_time = stats.cpu_time - stats.driver_time;
+
+    frame_statistics_.push_back(stats);
+
+    ResetFrameStatistics(current_frame_ + 1, end_time);
+}
+
+bool FpsInfo::WriteFrameStatistics(const std::string& filename) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open frame statistics file %s", filename.c_str());
+        return false;
+    }
+
+    const std::string json_extension = ".json";
+    if ((filename.length() >= json_extension.length()) &&
+        (filename.compare(filename.length() - json_extension.length(), json_extension.length(), json_extension) == 0))
+    {
+        WriteFrameStatisticsJson(file);
+    }
+    else
+    {
+        WriteFrameStatisticsCsv(file);
+    }
+
+    util::platform::FileClose(file);
+
+    return true;
+}
+
+void FpsInfo::ResetFrameStatistics(uint64_t frame, int64_t time)
+{
+    current_frame_     = frame;
+    frame_begin_time_  = time;
+    frame_driver_time_ = 0;
+    frame_wait_time_   = 0;
+}
+
+FpsInfo::Percentiles FpsInfo::GetPercentiles(int64_t FrameStatistics::*member) const
+{
+    Percentiles          percentiles = {};
+    std::vector<int64_t> values;
+
+    values.reserve(frame_statistics_.size());
+    for (const auto& stats : frame_statistics_)
+    {
+        values.push_back(stats.*member);
+    }
+
+    if (!values.empty())
+    {
+        std::sort(values.begin(), values.end());
+
+        // Nearest-rank percentiles.
+        auto get_percentile = [&values](size_t percent) {
+            size_t rank = ((values.size() * percent) + 99) / 100;
+            return ConvertToMilliseconds(values[(rank > 0) ? (rank - 1) : 0]);
+        };
+
+        percentiles.p50 = get_percentile(50);
+        percentiles.p95 = get_percentile(95);
+        percentiles.p99 = get_percentile(99);
+        percentiles.max = ConvertToMilliseconds(values.back());
+    }
+
+    return percentiles;
+}
+
+void FpsInfo::WritePercentilesToConsole(const char* label, int64_t FrameStatistics::*member) const
+{
+    Percentiles percentiles = GetPercentiles(member);
+    GFXRECON_WRITE_CONSOLE("%s p50 %.3f, p95 %.3f, p99 %.3f, max %.3f",
+                           label,
+                           percentiles.p50,
+                           percentiles.p95,
+                           percentiles.p99,
+                           percentiles.max);
+}
+
+void FpsInfo::WriteFrameStatisticsCsv(FILE* file) const
+{
+    fprintf(file, "frame,frame_ms,cpu_ms,decode_ms,driver_ms,wait_ms\n");
+
+    for (const auto& stats : frame_statistics_)
+    {
+        fprintf(file,
+                "%" PRIu64 ",%.6f,%.6f,%.6f,%.6f,%.6f\n",
+                stats.frame,
+                ConvertToMilliseconds(stats.frame_time),
+                ConvertToMilliseconds(stats.cpu_time),
+                ConvertToMilliseconds(stats.decode_time),
+                ConvertToMilliseconds(stats.driver_time),
+                ConvertToMilliseconds(stats.wait_time));
+    }
+}
+
+void FpsInfo::WriteFrameStatisticsJson(FILE* file) const
+{
+    const std::pair<const char*, int64_t FrameStatistics::*> fields[] = {
+        { "frame_ms", &FrameStatistics::frame_time },   { "cpu_ms", &FrameStatistics::cpu_time },
+        { "decode_ms", &FrameStatistics::decode_time }, { "driver_ms", &FrameStatistics::driver_time },
+        { "wait_ms", &FrameStatistics::wait_time }
+    };
+
+    fprintf(file, "{\n  \"summary\": {\n");
+
+    for (size_t i = 0; i < (sizeof(fields) / sizeof(fields[0])); ++i)
+    {
+        Percentiles percentiles = GetPercentiles(fields[i].second);
+        fprintf(file,
+                "    \"%s\": { \"p50\": %.6f, \"p95\": %.6f, \"p99\": %.6f, \"max\": %.6f }%s\n",
+                fields[i].first,
+                percentiles.p50,
+                percentiles.p95,
+                percentiles.p99,
+                percentiles.max,
+                (i + 1 < (sizeof(fields) / sizeof(fields[0]))) ? "," : "");
+    }
+
+    fprintf(file, "  },\n  \"frames\": [");
+
+    for (size_t i = 0; i < frame_statistics_.size(); ++i)
+    {
+        const FrameStatistics& stats = frame_statistics_[i];
+        fprintf(file,
+                "%s\n    { \"frame\": %" PRIu64 ", \"frame_ms\": %.6f, \"cpu_ms\": %.6f, \"decode_ms\": %.6f, "
+                "\"driver_ms\": %.6f, \"wait_ms\": %.6f }",
+                (i > 0) ? "," : "",
+                stats.frame,
+                ConvertToMilliseconds(stats.frame_time),
+                ConvertToMilliseconds(stats.cpu_time),
+                ConvertToMilliseconds(stats.decode_time),
+                ConvertToMilliseconds(stats.driver_time),
+                ConvertToMilliseconds(stats.wait_time));
+    }
+
+    fprintf(file, "\n  ]\n}\n");
 }
 
 GFXRECON_END_NAMESPACE(graphics)
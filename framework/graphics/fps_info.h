@@ -24,9 +24,13 @@
 #ifndef GFXRECON_GRAPHICS_FPS_INFO_H
 #define GFXRECON_GRAPHICS_FPS_INFO_H
 
+#include "util/date_time.h"
 #include "util/defines.h"
 
+#include <cstdio>
 #include <limits>
+#include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -34,15 +38,101 @@ GFXRECON_BEGIN_NAMESPACE(graphics)
 class FpsInfo
 {
   public:
+    // When frame statistics are enabled, the time between presents is recorded for each frame, along with the time
+    // spent in driver calls and the time spent waiting for the GPU.  Percentiles of the recorded times are logged by
+    // EndAndLog() and the per-frame values can be written to a file with WriteFrameStatistics().
+    FpsInfo(bool record_frame_statistics = false);
+
     void Begin(uint64_t start_frame = 1);
     void EndAndLog(uint64_t current_frame);
 
     void ProcessStateEndMarker(uint64_t frame);
 
+    // Provides the durations of the replays of a looped frame range, in nanoseconds.  The repeated frames are included
+    // in the replay FPS and the time of each iteration is logged by EndAndLog().
+    void SetLoopIterations(uint64_t frames_per_iteration, const std::vector<int64_t>& iteration_times)
+    {
+        loop_frame_count_     = frames_per_iteration;
+        loop_iteration_times_ = iteration_times;
+    }
+
+    // Provides the start and end timestamps for the preloading of capture file data.  Preload time that occurs after
+    // replay has started is excluded from the replay FPS.
+    void SetPreloadTime(int64_t start_time, int64_t end_time)
+    {
+        preload_start_time_ = start_time;
+        preload_end_time_   = end_time;
+    }
+
+    bool IsRecordingFrameStatistics() const { return record_frame_statistics_; }
+
+    // Frame statistics are recorded by the replay consumer, which brackets each driver call with
+    // BeginDriverCall()/EndDriverCall(), brackets calls that block on GPU work with BeginWait()/EndWait(), and calls
+    // EndFrame() after each present.  Waits and the EndFrame() call are expected to be nested within driver calls.
+    void BeginDriverCall() { driver_call_begin_time_ = util::datetime::GetTimestamp(); }
+
+    void EndDriverCall() { frame_driver_time_ += util::datetime::GetTimestamp() - driver_call_begin_time_; }
+
+    void BeginWait() { wait_begin_time_ = util::datetime::GetTimestamp(); }
+
+    void EndWait() { frame_wait_time_ += util::datetime::GetTimestamp() - wait_begin_time_; }
+
+    void EndFrame();
+
+    // Writes the per-frame statistics to a JSON file if the file name has a .json extension, and to a CSV file
+    // otherwise.
+    bool WriteFrameStatistics(const std::string& filename) const;
+
   private:
-    int64_t  start_time_;
-    uint64_t replay_start_frame_;
-    int64_t  replay_start_time_;
+    // All times are in nanoseconds.  CPU time is the frame time that was not spent waiting for the GPU, and decode
+    // time is the CPU time that was not spent in driver calls.
+    struct FrameStatistics
+    {
+        uint64_t frame;
+        int64_t  frame_time;
+        int64_t  cpu_time;
+        int64_t  decode_time;
+        int64_t  driver_time;
+        int64_t  wait_time;
+    };
+
+    struct Percentiles
+    {
+        double p50;
+        double p95;
+        double p99;
+        double max;
+    };
+
+  private:
+    void ResetFrameStatistics(uint64_t frame, int64_t time);
+
+    Percentiles GetPercentiles(int64_t FrameStatistics::*member) const;
+
+    void WritePercentilesToConsole(const char* label, int64_t FrameStatistics::*member) const;
+
+    void WriteFrameStatisticsCsv(FILE* file) const;
+
+    void WriteFrameStatisticsJson(FILE* file) const;
+
+  private:
+    int64_t  start_time_{ 0 };
+    uint64_t replay_start_frame_{ 1 };
+    int64_t  replay_start_time_{ 0 };
+
+    uint64_t             loop_frame_count_{ 0 };
+    std::vector<int64_t> loop_iteration_times_;
+    int64_t              preload_start_time_{ 0 };
+    int64_t              preload_end_time_{ 0 };
+
+    bool                         record_frame_statistics_;
+    uint64_t                     current_frame_{ 1 };
+    int64_t                      frame_begin_time_{ 0 };
+    int64_t                      frame_driver_time_{ 0 };
+    int64_t                      frame_wait_time_{ 0 };
+    int64_t                      driver_call_begin_time_{ 0 };
+    int64_t                      wait_begin_time_{ 0 };
+    std::vector<FrameStatistics> frame_statistics_;
 };
 
 GFXRECON_END_NAMESPACE(graphics)
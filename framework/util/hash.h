@@ -27,13 +27,24 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(hash)
 
+const uint64_t kFnv1a64OffsetBasis = 0xcbf29ce484222325ull;
+const size_t   kSha256DigestSize   = 32;
+
 uint32_t CheckSum(const uint32_t* code, size_t code_size);
 
+// Computes the 64-bit FNV-1a hash of a buffer.  The hash of a previous buffer can be provided to compute the hash of
+// multiple buffers as a single sequence of bytes.
+uint64_t Fnv1a64(const void* data, size_t size, uint64_t hash = kFnv1a64OffsetBasis);
+
+// Computes the SHA-256 digest of a buffer, for content identification where hash collisions must be avoided.
+void Sha256(const void* data, size_t size, uint8_t digest[kSha256DigestSize]);
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
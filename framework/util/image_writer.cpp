@@ -22,8 +22,25 @@
 
 #include "image_writer.h"
 
+#include "logging.h"
 #include "platform.h"
 
+#if defined(ENABLE_ZLIB_COMPRESSION)
+#include "zlib.h"
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_IMAGE_WRITER_USE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GFXRECON_IMAGE_WRITER_USE_NEON
+#endif
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(imagewriter)
@@ -31,13 +48,273 @@ GFXRECON_BEGIN_NAMESPACE(imagewriter)
 const uint16_t kBmpBitCount = 32; // Expecting 32-bit BGRA bitmap data.
 const uint32_t kBmpBpp      = 4;  // Expecting 4 bytes per pixel for 32-bit BGRA bitmap data.
 
-bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+const uint32_t kRgbBpp  = 3; // PNG and QOI images are written as 24-bit RGB.
+const uint32_t kRgbaBpp = 4; // Bytes per pixel for converted 8-bit RGBA and BGRA data.
+
+const uint8_t kPngSignature[]    = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+const uint8_t kPngBitDepth       = 8;
+const uint8_t kPngColorTypeRgb   = 2;
+const uint8_t kPngFilterTypeSub  = 1;
+const size_t  kPngHeaderDataSize = 13;
+
+const uint8_t kQoiMagic[]        = { 'q', 'o', 'i', 'f' };
+const uint8_t kQoiChannels       = 3;
+const uint8_t kQoiColorspaceSrgb = 0;
+const uint8_t kQoiEndMarker[]    = { 0, 0, 0, 0, 0, 0, 0, 1 };
+const uint8_t kQoiOpIndex        = 0x00;
+const uint8_t kQoiOpDiff         = 0x40;
+const uint8_t kQoiOpLuma         = 0x80;
+const uint8_t kQoiOpRun          = 0xc0;
+const uint8_t kQoiOpRgb          = 0xfe;
+const uint8_t kQoiMaxRun         = 62;
+const size_t  kQoiIndexSize      = 64;
+
+static void StoreBigEndian32(uint32_t value, uint8_t* dst)
+{
+    dst[0] = static_cast<uint8_t>(value >> 24);
+    dst[1] = static_cast<uint8_t>(value >> 16);
+    dst[2] = static_cast<uint8_t>(value >> 8);
+    dst[3] = static_cast<uint8_t>(value);
+}
+
+static float HalfToFloat(uint16_t value)
+{
+    uint32_t exponent = (value >> 10) & 0x1f;
+    uint32_t mantissa = value & 0x3ff;
+    float    result   = 0.0f;
+
+    if (exponent == 0)
+    {
+        // Zero or subnormal.
+        result = std::ldexp(static_cast<float>(mantissa), -24);
+    }
+    else if (exponent == 0x1f)
+    {
+        // Infinity or NaN; NaN is treated as zero.
+        result = (mantissa == 0) ? INFINITY : 0.0f;
+    }
+    else
+    {
+        result = std::ldexp(static_cast<float>(mantissa | 0x400), static_cast<int>(exponent) - 25);
+    }
+
+    return ((value & 0x8000) != 0) ? -result : result;
+}
+
+// Lookup table mapping all 16-bit half float values to 8-bit unorm values, built on first use.
+static const uint8_t* GetHalfToUnormTable()
+{
+    static const std::vector<uint8_t> table = []() {
+        std::vector<uint8_t> values(UINT16_MAX + 1);
+        for (uint32_t i = 0; i <= UINT16_MAX; ++i)
+        {
+            float value = HalfToFloat(static_cast<uint16_t>(i));
+            value       = (value < 0.0f) ? 0.0f : ((value > 1.0f) ? 1.0f : value);
+            values[i]   = static_cast<uint8_t>(value * 255.0f + 0.5f);
+        }
+        return values;
+    }();
+
+    return table.data();
+}
+
+static void SwapRedBlue8(const uint8_t* src, uint32_t pixel_count, uint8_t* dst)
+{
+    uint32_t i = 0;
+
+#if defined(GFXRECON_IMAGE_WRITER_USE_SSE2)
+    const __m128i green_alpha_mask = _mm_set1_epi32(static_cast<int32_t>(0xff00ff00));
+    const __m128i channel_mask     = _mm_set1_epi32(0xff);
+
+    for (; (i + 4) <= pixel_count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i * kRgbaBpp)));
+        __m128i result = _mm_and_si128(pixels, green_alpha_mask);
+        result         = _mm_or_si128(result, _mm_and_si128(_mm_srli_epi32(pixels, 16), channel_mask));
+        result         = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(pixels, channel_mask), 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i * kRgbaBpp)), result);
+    }
+#elif defined(GFXRECON_IMAGE_WRITER_USE_NEON)
+    for (; (i + 16) <= pixel_count; i += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(src + (i * kRgbaBpp));
+        uint8x16_t   red    = pixels.val[0];
+        pixels.val[0]       = pixels.val[2];
+        pixels.val[2]       = red;
+        vst4q_u8(dst + (i * kRgbaBpp), pixels);
+    }
+#endif
+
+    for (; i < pixel_count; ++i)
+    {
+        const uint8_t* src_pixel = src + (i * kRgbaBpp);
+        uint8_t*       dst_pixel = dst + (i * kRgbaBpp);
+        dst_pixel[0]             = src_pixel[2];
+        dst_pixel[1]             = src_pixel[1];
+        dst_pixel[2]             = src_pixel[0];
+        dst_pixel[3]             = src_pixel[3];
+    }
+}
+
+// Converts 10-bit packed pixels to 8-bit channels.  When swap_red_blue is false, the first (least significant) packed
+// channel is written to the first byte of the destination pixel.
+static void Convert10BitPacked(const uint8_t* src, uint32_t pixel_count, bool swap_red_blue, uint8_t* dst)
+{
+    uint32_t i            = 0;
+    uint32_t first_shift  = swap_red_blue ? 16 : 0;
+    uint32_t second_shift = swap_red_blue ? 0 : 16;
+
+#if defined(GFXRECON_IMAGE_WRITER_USE_SSE2)
+    const __m128i channel_mask = _mm_set1_epi32(0xff);
+    const __m128i first_count  = _mm_cvtsi32_si128(static_cast<int32_t>(first_shift));
+    const __m128i second_count = _mm_cvtsi32_si128(static_cast<int32_t>(second_shift));
+
+    for (; (i + 4) <= pixel_count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i * kRgbaBpp)));
+
+        // Keep the 8 most significant bits of each 10-bit channel and expand the 2-bit alpha to 8 bits.
+        __m128i first  = _mm_and_si128(_mm_srli_epi32(pixels, 2), channel_mask);
+        __m128i middle = _mm_and_si128(_mm_srli_epi32(pixels, 12), channel_mask);
+        __m128i last   = _mm_and_si128(_mm_srli_epi32(pixels, 22), channel_mask);
+        __m128i alpha  = _mm_srli_epi32(pixels, 30);
+        alpha          = _mm_or_si128(_mm_or_si128(alpha, _mm_slli_epi32(alpha, 2)),
+                                     _mm_or_si128(_mm_slli_epi32(alpha, 4), _mm_slli_epi32(alpha, 6)));
+
+        __m128i result = _mm_sll_epi32(first, first_count);
+        result         = _mm_or_si128(result, _mm_slli_epi32(middle, 8));
+        result         = _mm_or_si128(result, _mm_sll_epi32(last, second_count));
+        result         = _mm_or_si128(result, _mm_slli_epi32(alpha, 24));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i * kRgbaBpp)), result);
+    }
+#endif
+
+    for (; i < pixel_count; ++i)
+    {
+        uint32_t pixel  = 0;
+        uint32_t result = 0;
+
+        util::platform::MemoryCopy(&pixel, sizeof(pixel), src + (i * kRgbaBpp), sizeof(pixel));
+
+        result = ((pixel >> 2) & 0xff) << first_shift;
+        result |= ((pixel >> 12) & 0xff) << 8;
+        result |= ((pixel >> 22) & 0xff) << second_shift;
+        result |= ((pixel >> 30) * 0x55) << 24;
+
+        util::platform::MemoryCopy(dst + (i * kRgbaBpp), sizeof(result), &result, sizeof(result));
+    }
+}
+
+static void ConvertHalfFloat(const uint8_t* src, uint32_t pixel_count, bool swap_red_blue, uint8_t* dst)
+{
+    const uint8_t* table       = GetHalfToUnormTable();
+    const size_t   first_index = swap_red_blue ? 2 : 0;
+    const size_t   last_index  = swap_red_blue ? 0 : 2;
+
+    for (uint32_t i = 0; i < pixel_count; ++i)
+    {
+        uint16_t channels[4];
+        uint8_t* dst_pixel = dst + (i * kRgbaBpp);
+
+        util::platform::MemoryCopy(channels, sizeof(channels), src + (i * sizeof(channels)), sizeof(channels));
+
+        dst_pixel[first_index] = table[channels[0]];
+        dst_pixel[1]           = table[channels[1]];
+        dst_pixel[last_index]  = table[channels[2]];
+        dst_pixel[3]           = table[channels[3]];
+    }
+}
+
+static void ConvertPixels(
+    const void* src, DataFormats src_format, uint32_t pixel_count, DataFormats dst_format, uint8_t* dst)
+{
+    assert((dst_format == DataFormats::kB8G8R8A8) || (dst_format == DataFormats::kR8G8B8A8));
+
+    auto src_bytes = reinterpret_cast<const uint8_t*>(src);
+    bool dst_bgra  = (dst_format == DataFormats::kB8G8R8A8);
+
+    switch (src_format)
+    {
+        case DataFormats::kB8G8R8A8:
+        case DataFormats::kR8G8B8A8:
+            if (src_format == dst_format)
+            {
+                util::platform::MemoryCopy(dst, pixel_count * kRgbaBpp, src_bytes, pixel_count * kRgbaBpp);
+            }
+            else
+            {
+                SwapRedBlue8(src_bytes, pixel_count, dst);
+            }
+            break;
+        case DataFormats::kA2R10G10B10:
+            Convert10BitPacked(src_bytes, pixel_count, !dst_bgra, dst);
+            break;
+        case DataFormats::kA2B10G10R10:
+            Convert10BitPacked(src_bytes, pixel_count, dst_bgra, dst);
+            break;
+        case DataFormats::kR16G16B16A16Sfloat:
+            ConvertHalfFloat(src_bytes, pixel_count, dst_bgra, dst);
+            break;
+        default:
+            GFXRECON_LOG_ERROR("Unrecognized image data format %u", static_cast<uint32_t>(src_format));
+            break;
+    }
+}
+
+static bool WriteFileData(const std::string& filename, const uint8_t* data, size_t size)
+{
+    bool    success = false;
+    FILE*   file    = nullptr;
+    int32_t result  = util::platform::FileOpen(&file, filename.c_str(), "wb");
+
+    if ((result == 0) && (file != nullptr))
+    {
+        util::platform::FileWrite(data, 1, size, file);
+
+        if (!ferror(file))
+        {
+            success = true;
+        }
+
+        util::platform::FileClose(file);
+    }
+
+    return success;
+}
+
+uint32_t GetPixelSize(DataFormats format)
+{
+    switch (format)
+    {
+        case DataFormats::kR16G16B16A16Sfloat:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+void ConvertPixelsToBgra8(const void* src, DataFormats src_format, uint32_t pixel_count, uint8_t* dst)
+{
+    ConvertPixels(src, src_format, pixel_count, DataFormats::kB8G8R8A8, dst);
+}
+
+void ConvertPixelsToRgba8(const void* src, DataFormats src_format, uint32_t pixel_count, uint8_t* dst)
+{
+    ConvertPixels(src, src_format, pixel_count, DataFormats::kR8G8B8A8, dst);
+}
+
+bool WriteBmpImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   DataFormats        data_format)
 {
     bool     success    = false;
-    uint32_t row_pitch  = width * kBmpBpp;
-    uint32_t image_size = height * row_pitch;
+    uint32_t row_pitch  = width * GetPixelSize(data_format);
+    uint32_t image_size = height * width * kBmpBpp;
 
-    if (image_size <= data_size)
+    if ((height * row_pitch) <= data_size)
     {
         FILE*   file   = nullptr;
         int32_t result = util::platform::FileOpen(&file, filename.c_str(), "wb");
@@ -69,12 +346,26 @@ bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height,
             util::platform::FileWrite(&info_header, sizeof(info_header), 1, file);
 
             // Y needs to be inverted when writing the bitmap data.
-            auto height_1 = height - 1;
-            auto bytes    = reinterpret_cast<const uint8_t*>(data);
+            auto                 height_1 = height - 1;
+            auto                 bytes    = reinterpret_cast<const uint8_t*>(data);
+            std::vector<uint8_t> converted_row;
+
+            if (data_format != DataFormats::kB8G8R8A8)
+            {
+                converted_row.resize(width * kBmpBpp);
+            }
 
             for (uint32_t i = 0; i < height; ++i)
             {
-                util::platform::FileWrite(&bytes[(height_1 - i) * row_pitch], 1, row_pitch, file);
+                const uint8_t* row = &bytes[(height_1 - i) * row_pitch];
+
+                if (!converted_row.empty())
+                {
+                    ConvertPixelsToBgra8(row, data_format, width, converted_row.data());
+                    row = converted_row.data();
+                }
+
+                util::platform::FileWrite(row, 1, width * kBmpBpp, file);
             }
 
             if (!ferror(file))
@@ -89,6 +380,241 @@ bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height,
     return success;
 }
 
+#if defined(ENABLE_ZLIB_COMPRESSION)
+static void AppendPngChunk(const char* type, const uint8_t* data, uint32_t size, std::vector<uint8_t>* file_data)
+{
+    uint8_t length[4];
+    uint8_t crc[4];
+
+    StoreBigEndian32(size, length);
+
+    // The chunk CRC covers the chunk type and data.  Note that crc32() returns its initial value for a null buffer.
+    uLong chunk_crc = crc32(0, reinterpret_cast<const Bytef*>(type), 4);
+
+    file_data->insert(file_data->end(), length, length + sizeof(length));
+    file_data->insert(file_data->end(), type, type + 4);
+
+    if (size > 0)
+    {
+        chunk_crc = crc32(chunk_crc, data, size);
+        file_data->insert(file_data->end(), data, data + size);
+    }
+
+    StoreBigEndian32(static_cast<uint32_t>(chunk_crc), crc);
+    file_data->insert(file_data->end(), crc, crc + sizeof(crc));
+}
+#endif
+
+bool WritePngImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   DataFormats        data_format,
+                   int32_t            compression_level)
+{
+#if defined(ENABLE_ZLIB_COMPRESSION)
+    bool     success   = false;
+    uint32_t row_pitch = width * GetPixelSize(data_format);
+
+    if ((height * row_pitch) <= data_size)
+    {
+        // Each scanline is preceded by its filter type.  The Sub filter, which stores the difference from the pixel to
+        // the left, is cheap to compute and substantially improves compression of rendered images.
+        size_t               scanline_size = 1 + (width * kRgbBpp);
+        std::vector<uint8_t> scanlines(scanline_size * height);
+        std::vector<uint8_t> rgba_row(width * kRgbaBpp);
+        auto                 bytes = reinterpret_cast<const uint8_t*>(data);
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            uint8_t* scanline = &scanlines[y * scanline_size];
+
+            ConvertPixelsToRgba8(&bytes[y * row_pitch], data_format, width, rgba_row.data());
+
+            scanline[0] = kPngFilterTypeSub;
+
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const uint8_t* pixel = &rgba_row[x * kRgbaBpp];
+                uint8_t*       dst   = &scanline[1 + (x * kRgbBpp)];
+
+                for (uint32_t c = 0; c < kRgbBpp; ++c)
+                {
+                    uint8_t left = (x > 0) ? rgba_row[((x - 1) * kRgbaBpp) + c] : 0;
+                    dst[c]       = static_cast<uint8_t>(pixel[c] - left);
+                }
+            }
+        }
+
+        uLongf               compressed_size = compressBound(static_cast<uLong>(scanlines.size()));
+        std::vector<uint8_t> compressed_data(compressed_size);
+
+        if (compress2(compressed_data.data(),
+                      &compressed_size,
+                      scanlines.data(),
+                      static_cast<uLong>(scanlines.size()),
+                      compression_level) == Z_OK)
+        {
+            uint8_t header[kPngHeaderDataSize];
+            StoreBigEndian32(width, &header[0]);
+            StoreBigEndian32(height, &header[4]);
+            header[8]  = kPngBitDepth;
+            header[9]  = kPngColorTypeRgb;
+            header[10] = 0; // Compression method.
+            header[11] = 0; // Filter method.
+            header[12] = 0; // Interlace method.
+
+            std::vector<uint8_t> file_data(kPngSignature, kPngSignature + sizeof(kPngSignature));
+            file_data.reserve(compressed_size + 64);
+
+            AppendPngChunk("IHDR", header, sizeof(header), &file_data);
+            AppendPngChunk("IDAT", compressed_data.data(), static_cast<uint32_t>(compressed_size), &file_data);
+            AppendPngChunk("IEND", nullptr, 0, &file_data);
+
+            success = WriteFileData(filename, file_data.data(), file_data.size());
+        }
+    }
+
+    return success;
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+    GFXRECON_UNREFERENCED_PARAMETER(data_format);
+    GFXRECON_UNREFERENCED_PARAMETER(compression_level);
+
+    GFXRECON_LOG_ERROR("Failed to write PNG image %s: PNG support requires zlib", filename.c_str());
+    return false;
+#endif
+}
+
+bool WriteQoiImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   DataFormats        data_format)
+{
+    bool     success   = false;
+    uint32_t row_pitch = width * GetPixelSize(data_format);
+
+    if ((height * row_pitch) <= data_size)
+    {
+        struct QoiPixel
+        {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+            uint8_t a;
+        };
+
+        std::vector<uint8_t> file_data;
+        std::vector<uint8_t> rgba_row(width * kRgbaBpp);
+        auto                 bytes = reinterpret_cast<const uint8_t*>(data);
+
+        // Reserve space for the worst case of a full RGB op for every pixel.
+        file_data.reserve(sizeof(kQoiMagic) + 10 + (static_cast<size_t>(width) * height * (kRgbBpp + 1)) +
+                          sizeof(kQoiEndMarker));
+
+        uint8_t header[10];
+        StoreBigEndian32(width, &header[0]);
+        StoreBigEndian32(height, &header[4]);
+        header[8] = kQoiChannels;
+        header[9] = kQoiColorspaceSrgb;
+
+        file_data.insert(file_data.end(), kQoiMagic, kQoiMagic + sizeof(kQoiMagic));
+        file_data.insert(file_data.end(), header, header + sizeof(header));
+
+        // Alpha is not stored, so all pixels have the initial alpha value of 255.  Unused index entries have an alpha
+        // value of 0, and never match a pixel.
+        QoiPixel index[kQoiIndexSize] = {};
+        QoiPixel previous             = { 0, 0, 0, 255 };
+        uint32_t run                  = 0;
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            ConvertPixelsToRgba8(&bytes[y * row_pitch], data_format, width, rgba_row.data());
+
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const uint8_t* rgba  = &rgba_row[x * kRgbaBpp];
+                QoiPixel       pixel = { rgba[0], rgba[1], rgba[2], 255 };
+
+                if ((pixel.r == previous.r) && (pixel.g == previous.g) && (pixel.b == previous.b))
+                {
+                    ++run;
+
+                    if (run == kQoiMaxRun)
+                    {
+                        file_data.push_back(static_cast<uint8_t>(kQoiOpRun | (run - 1)));
+                        run = 0;
+                    }
+
+                    continue;
+                }
+
+                if (run > 0)
+                {
+                    file_data.push_back(static_cast<uint8_t>(kQoiOpRun | (run - 1)));
+                    run = 0;
+                }
+
+                size_t hash = (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % kQoiIndexSize;
+
+                if ((index[hash].r == pixel.r) && (index[hash].g == pixel.g) && (index[hash].b == pixel.b) &&
+                    (index[hash].a == pixel.a))
+                {
+                    file_data.push_back(static_cast<uint8_t>(kQoiOpIndex | hash));
+                }
+                else
+                {
+                    index[hash] = pixel;
+
+                    int8_t dr    = static_cast<int8_t>(pixel.r - previous.r);
+                    int8_t dg    = static_cast<int8_t>(pixel.g - previous.g);
+                    int8_t db    = static_cast<int8_t>(pixel.b - previous.b);
+                    int8_t dr_dg = static_cast<int8_t>(dr - dg);
+                    int8_t db_dg = static_cast<int8_t>(db - dg);
+
+                    if ((dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1))
+                    {
+                        file_data.push_back(
+                            static_cast<uint8_t>(kQoiOpDiff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+                    }
+                    else if ((dg >= -32) && (dg <= 31) && (dr_dg >= -8) && (dr_dg <= 7) && (db_dg >= -8) &&
+                             (db_dg <= 7))
+                    {
+                        file_data.push_back(static_cast<uint8_t>(kQoiOpLuma | (dg + 32)));
+                        file_data.push_back(static_cast<uint8_t>(((dr_dg + 8) << 4) | (db_dg + 8)));
+                    }
+                    else
+                    {
+                        file_data.push_back(kQoiOpRgb);
+                        file_data.push_back(pixel.r);
+                        file_data.push_back(pixel.g);
+                        file_data.push_back(pixel.b);
+                    }
+                }
+
+                previous = pixel;
+            }
+        }
+
+        if (run > 0)
+        {
+            file_data.push_back(static_cast<uint8_t>(kQoiOpRun | (run - 1)));
+        }
+
+        file_data.insert(file_data.end(), kQoiEndMarker, kQoiEndMarker + sizeof(kQoiEndMarker));
+
+        success = WriteFileData(filename, file_data.data(), file_data.size());
+    }
+
+    return success;
+}
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -25,6 +25,7 @@
 
 #include "util/defines.h"
 
+#include <cstdint>
 #include <string>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -60,7 +61,51 @@ struct BmpInfoHeader
 
 #pragma pack(pop)
 
-bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
+// Pixel formats of the image data provided to the image writers.  Packed formats are stored with their first channel
+// in the least significant bits.
+enum class DataFormats : uint32_t
+{
+    kB8G8R8A8 = 0,
+    kR8G8B8A8,
+    kA2R10G10B10,
+    kA2B10G10R10,
+    kR16G16B16A16Sfloat
+};
+
+// Default zlib compression level for PNG images, which favors speed over compression ratio.
+const int32_t kPngDefaultCompressionLevel = 1;
+
+uint32_t GetPixelSize(DataFormats format);
+
+// Convert pixels to 8-bit per channel BGRA or RGBA data.  Conversions between 8-bit channel orders and from 10-bit
+// packed formats are vectorized when SSE2 or NEON is available.  Floating point values are clamped to [0, 1].
+void ConvertPixelsToBgra8(const void* src, DataFormats src_format, uint32_t pixel_count, uint8_t* dst);
+
+void ConvertPixelsToRgba8(const void* src, DataFormats src_format, uint32_t pixel_count, uint8_t* dst);
+
+bool WriteBmpImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   DataFormats        data_format = DataFormats::kB8G8R8A8);
+
+// PNG images are written as 8-bit RGB, with the alpha channel discarded.  Requires zlib support.
+bool WritePngImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   DataFormats        data_format       = DataFormats::kB8G8R8A8,
+                   int32_t            compression_level = kPngDefaultCompressionLevel);
+
+// QOI images are written as 8-bit RGB, with the alpha channel discarded.
+bool WriteQoiImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   DataFormats        data_format = DataFormats::kB8G8R8A8);
 
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
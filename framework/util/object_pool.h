@@ -0,0 +1,160 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_OBJECT_POOL_H
+#define GFXRECON_UTIL_OBJECT_POOL_H
+
+#include "util/defines.h"
+
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Thread safe pool of fixed size object slots, allocated from the system in slabs of kSlabObjectCount objects.
+// Released slots are kept on a free list for reuse by later allocations; slab memory is only returned to the system
+// when the pool is destroyed.
+template <typename T, size_t kSlabObjectCount = 256>
+class ObjectPool
+{
+  public:
+    ObjectPool() : free_list_(nullptr) {}
+
+    ~ObjectPool() = default;
+
+    // Allocates a slot and default constructs an object of type T in it.
+    T* Create()
+    {
+        void* storage = AcquireSlot();
+        return new (storage) T();
+    }
+
+    // Destroys an object previously returned by Create and returns its slot to the free list.
+    void Destroy(T* object)
+    {
+        if (object != nullptr)
+        {
+            object->~T();
+            ReleaseSlot(object);
+        }
+    }
+
+    // Destroys a batch of objects, returning all of their slots to the free list with a single lock acquisition.
+    // Each element of the range is passed to get_object to retrieve the object pointer.
+    template <typename Iterator, typename GetObject>
+    void Destroy(Iterator begin, Iterator end, GetObject get_object)
+    {
+        Slot* head = nullptr;
+
+        for (auto iter = begin; iter != end; ++iter)
+        {
+            T* object = get_object(*iter);
+            if (object != nullptr)
+            {
+                object->~T();
+
+                Slot* slot = reinterpret_cast<Slot*>(object);
+                slot->next = head;
+                head       = slot;
+            }
+        }
+
+        if (head != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            while (head != nullptr)
+            {
+                Slot* slot = head;
+                head       = head->next;
+                slot->next = free_list_;
+                free_list_ = slot;
+            }
+        }
+    }
+
+  private:
+    union Slot
+    {
+        Slot*                                                     next;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    static_assert(kSlabObjectCount > 0, "Object pool slabs must hold at least one object.");
+
+  private:
+    void* AcquireSlot()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (free_list_ == nullptr)
+        {
+            AllocateSlab();
+        }
+
+        assert(free_list_ != nullptr);
+
+        Slot* slot = free_list_;
+        free_list_ = slot->next;
+
+        return slot;
+    }
+
+    void ReleaseSlot(void* storage)
+    {
+        Slot* slot = reinterpret_cast<Slot*>(storage);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        slot->next = free_list_;
+        free_list_ = slot;
+    }
+
+    // Must be called with mutex_ held.
+    void AllocateSlab()
+    {
+        std::unique_ptr<Slot[]> slab = std::make_unique<Slot[]>(kSlabObjectCount);
+
+        // Link the new slots in address order so that consecutive allocations are adjacent in memory.
+        for (size_t i = kSlabObjectCount; i > 0; --i)
+        {
+            slab[i - 1].next = free_list_;
+            free_list_       = &slab[i - 1];
+        }
+
+        slabs_.emplace_back(std::move(slab));
+    }
+
+  private:
+    std::mutex                           mutex_;
+    Slot*                                free_list_;
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_OBJECT_POOL_H
@@ -0,0 +1,116 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/sparse_page_buffer.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+const uint64_t SparsePageBuffer::kDefaultPageSize;
+
+SparsePageBuffer::SparsePageBuffer(uint64_t page_size) : page_size_(page_size)
+{
+    assert(page_size > 0);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, page_size);
+}
+
+bool SparsePageBuffer::HasPages(uint64_t offset, uint64_t size) const
+{
+    if (size == 0)
+    {
+        return false;
+    }
+
+    auto page = FindPage(offset);
+    return (page != pages_.end()) && ((page->first * page_size_) < (offset + size));
+}
+
+void SparsePageBuffer::Write(uint64_t offset, uint64_t size, const void* data)
+{
+    assert((data != nullptr) || (size == 0));
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    uint64_t       end   = offset + size;
+
+    while (offset < end)
+    {
+        uint64_t page_offset = offset % page_size_;
+        size_t   copy_size   = static_cast<size_t>(std::min(page_size_ - page_offset, end - offset));
+
+        auto& page = pages_[offset / page_size_];
+        if (page == nullptr)
+        {
+            page = std::make_unique<uint8_t[]>(static_cast<size_t>(page_size_));
+        }
+
+        util::platform::MemoryCopy(page.get() + page_offset, copy_size, bytes, copy_size);
+
+        offset += copy_size;
+        bytes += copy_size;
+    }
+}
+
+void SparsePageBuffer::Read(uint64_t offset, uint64_t size, void* data) const
+{
+    assert((data != nullptr) || (size == 0));
+
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(data);
+    uint64_t end   = offset + size;
+
+    for (auto page = FindPage(offset); (page != pages_.end()) && (offset < end); ++page)
+    {
+        uint64_t page_start = page->first * page_size_;
+        if (page_start >= end)
+        {
+            break;
+        }
+
+        // Bytes preceding the page have not been written.
+        if (page_start > offset)
+        {
+            size_t fill_size = static_cast<size_t>(page_start - offset);
+            memset(bytes, 0, fill_size);
+            offset += fill_size;
+            bytes += fill_size;
+        }
+
+        size_t copy_size = static_cast<size_t>(std::min(page_start + page_size_, end) - offset);
+        util::platform::MemoryCopy(bytes, copy_size, page->second.get() + (offset - page_start), copy_size);
+
+        offset += copy_size;
+        bytes += copy_size;
+    }
+
+    if (offset < end)
+    {
+        memset(bytes, 0, static_cast<size_t>(end - offset));
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,76 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_SPARSE_PAGE_BUFFER_H
+#define GFXRECON_UTIL_SPARSE_PAGE_BUFFER_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Byte buffer of unbounded size that is stored as fixed size pages, which are only allocated when they are written.
+// Bytes that have not been written read as zero, matching the content of a zero initialized buffer of the full size.
+class SparsePageBuffer
+{
+  public:
+    static const uint64_t kDefaultPageSize = 64 * 1024;
+
+  public:
+    SparsePageBuffer(uint64_t page_size = kDefaultPageSize);
+
+    uint64_t GetPageSize() const { return page_size_; }
+
+    size_t GetPageCount() const { return pages_.size(); }
+
+    bool IsEmpty() const { return pages_.empty(); }
+
+    // Returns true if any page that overlaps the range [offset, offset + size) has been written.
+    bool HasPages(uint64_t offset, uint64_t size) const;
+
+    void Write(uint64_t offset, uint64_t size, const void* data);
+
+    // Copies the range [offset, offset + size) to the destination buffer, which must be at least size bytes.
+    void Read(uint64_t offset, uint64_t size, void* data) const;
+
+    void Clear() { pages_.clear(); }
+
+  private:
+    typedef std::map<uint64_t, std::unique_ptr<uint8_t[]>> PageMap;
+
+  private:
+    // Returns the first page that overlaps or follows the offset.
+    PageMap::const_iterator FindPage(uint64_t offset) const { return pages_.lower_bound(offset / page_size_); }
+
+  private:
+    uint64_t page_size_;
+    PageMap  pages_; // Pages indexed by page number.
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SPARSE_PAGE_BUFFER_H
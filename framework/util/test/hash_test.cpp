@@ -0,0 +1,105 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "util/hash.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::string Sha256String(const void* data, size_t size)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    uint8_t digest[gfxrecon::util::hash::kSha256DigestSize];
+    gfxrecon::util::hash::Sha256(data, size, digest);
+
+    std::string result;
+    for (size_t i = 0; i < gfxrecon::util::hash::kSha256DigestSize; ++i)
+    {
+        result += kHexDigits[digest[i] >> 4];
+        result += kHexDigits[digest[i] & 0xf];
+    }
+
+    return result;
+}
+
+std::string Sha256String(const std::string& message)
+{
+    return Sha256String(message.data(), message.size());
+}
+
+// Returns a buffer of the specified size with bytes that do not repeat within a 64 byte block.
+std::vector<uint8_t> MakePatternBuffer(size_t size)
+{
+    std::vector<uint8_t> buffer(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        buffer[i] = static_cast<uint8_t>(i % 251);
+    }
+
+    return buffer;
+}
+
+} // namespace
+
+TEST_CASE("Sha256 matches the FIPS 180-2 test vectors", "[hash]")
+{
+    REQUIRE(Sha256String("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    REQUIRE(Sha256String("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    REQUIRE(Sha256String("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    REQUIRE(Sha256String("abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+                         "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu") ==
+            "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1");
+    REQUIRE(Sha256String(std::string(1000000, 'a')) ==
+            "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_CASE("Sha256 pads messages that end near a block boundary", "[hash]")
+{
+    // Messages of 55 bytes or less fit the length in the final block, while longer messages need an extra block.
+    std::vector<uint8_t> buffer = MakePatternBuffer(120);
+
+    REQUIRE(Sha256String(buffer.data(), 55) == "463eb28e72f82e0a96c0a4cc53690c571281131f672aa229e0d45ae59b598b59");
+    REQUIRE(Sha256String(buffer.data(), 56) == "da2ae4d6b36748f2a318f23e7ab1dfdf45acdc9d049bd80e59de82a60895f562");
+    REQUIRE(Sha256String(buffer.data(), 63) == "29af2686fd53374a36b0846694cc342177e428d1647515f078784d69cdb9e488");
+    REQUIRE(Sha256String(buffer.data(), 64) == "fdeab9acf3710362bd2658cdc9a29e8f9c757fcf9811603a8c447cd1d9151108");
+    REQUIRE(Sha256String(buffer.data(), 119) == "da18797ed7c3a777f0847f429724a2d8cd5138e6ed2895c3fa1a6d39d18f7ec6");
+    REQUIRE(Sha256String(buffer.data(), 120) == "f52b23db1fbb6ded89ef42a23ce0c8922c45f25c50b568a93bf1c075420bbb7c");
+}
+
+TEST_CASE("Fnv1a64 matches the reference values", "[hash]")
+{
+    REQUIRE(gfxrecon::util::hash::Fnv1a64("", 0) == gfxrecon::util::hash::kFnv1a64OffsetBasis);
+    REQUIRE(gfxrecon::util::hash::Fnv1a64("a", 1) == 0xaf63dc4c8601ec8cull);
+    REQUIRE(gfxrecon::util::hash::Fnv1a64("foobar", 6) == 0x85944171f73967e8ull);
+
+    // Hashing buffers in sequence is equivalent to hashing their concatenation.
+    uint64_t hash = gfxrecon::util::hash::Fnv1a64("foo", 3);
+    REQUIRE(gfxrecon::util::hash::Fnv1a64("bar", 3, hash) == 0x85944171f73967e8ull);
+}
@@ -0,0 +1,206 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "util/object_pool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct TestObject
+{
+    static std::atomic<int> live_count;
+
+    TestObject() : value(7), padding{} { ++live_count; }
+    ~TestObject() { --live_count; }
+
+    uint64_t value;
+    uint64_t padding[3];
+};
+
+std::atomic<int> TestObject::live_count{ 0 };
+
+} // namespace
+
+TEST_CASE("ObjectPool constructs and destroys objects", "[object_pool]")
+{
+    gfxrecon::util::ObjectPool<TestObject, 4> pool;
+
+    TestObject* object = pool.Create();
+    REQUIRE(object != nullptr);
+    REQUIRE(object->value == 7);
+    REQUIRE(TestObject::live_count == 1);
+
+    pool.Destroy(object);
+    REQUIRE(TestObject::live_count == 0);
+
+    // Destroying nullptr is a no-op.
+    pool.Destroy(static_cast<TestObject*>(nullptr));
+    REQUIRE(TestObject::live_count == 0);
+}
+
+TEST_CASE("ObjectPool allocates past the slab size and reuses released slots", "[object_pool]")
+{
+    gfxrecon::util::ObjectPool<TestObject, 4> pool;
+
+    std::vector<TestObject*> objects;
+    for (int i = 0; i < 10; ++i)
+    {
+        TestObject* object = pool.Create();
+        REQUIRE(object != nullptr);
+        REQUIRE((reinterpret_cast<uintptr_t>(object) % alignof(TestObject)) == 0);
+        object->value = i;
+        objects.push_back(object);
+    }
+
+    // Every live object has its own slot.
+    std::set<TestObject*> unique_objects(objects.begin(), objects.end());
+    REQUIRE(unique_objects.size() == objects.size());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        REQUIRE(objects[i]->value == static_cast<uint64_t>(i));
+    }
+
+    // Consecutive allocations from a new slab are adjacent.
+    REQUIRE(objects[1] == (objects[0] + 1));
+    REQUIRE(objects[3] == (objects[0] + 3));
+
+    // The most recently released slot is reused first.
+    TestObject* released = objects[5];
+    pool.Destroy(released);
+    REQUIRE(TestObject::live_count == 9);
+
+    TestObject* reused = pool.Create();
+    REQUIRE(reused == released);
+    REQUIRE(reused->value == 7);
+    objects[5] = reused;
+
+    for (TestObject* object : objects)
+    {
+        pool.Destroy(object);
+    }
+
+    REQUIRE(TestObject::live_count == 0);
+}
+
+TEST_CASE("ObjectPool batch destroy releases all slots", "[object_pool]")
+{
+    gfxrecon::util::ObjectPool<TestObject, 4> pool;
+
+    std::vector<std::pair<int, TestObject*>> entries;
+    for (int i = 0; i < 6; ++i)
+    {
+        entries.emplace_back(i, pool.Create());
+    }
+
+    // Entries that map to nullptr are skipped.
+    entries.emplace_back(6, nullptr);
+
+    REQUIRE(TestObject::live_count == 6);
+
+    pool.Destroy(entries.begin(), entries.end(), [](const std::pair<int, TestObject*>& entry) {
+        return entry.second;
+    });
+
+    REQUIRE(TestObject::live_count == 0);
+
+    // The released slots are reused before a new slab is allocated.
+    std::set<TestObject*> released;
+    for (const auto& entry : entries)
+    {
+        if (entry.second != nullptr)
+        {
+            released.insert(entry.second);
+        }
+    }
+
+    std::vector<TestObject*> objects;
+    for (size_t i = 0; i < released.size(); ++i)
+    {
+        TestObject* object = pool.Create();
+        REQUIRE(released.count(object) == 1);
+        objects.push_back(object);
+    }
+
+    pool.Destroy(objects.begin(), objects.end(), [](TestObject* object) { return object; });
+    REQUIRE(TestObject::live_count == 0);
+}
+
+TEST_CASE("ObjectPool can be used from multiple threads", "[object_pool]")
+{
+    const int kThreadCount = 4;
+    const int kIterations  = 1000;
+
+    gfxrecon::util::ObjectPool<TestObject, 16> pool;
+    std::vector<std::thread>                   threads;
+    std::vector<int>                           results(kThreadCount, 0);
+
+    for (int t = 0; t < kThreadCount; ++t)
+    {
+        threads.emplace_back([&pool, &results, t]() {
+            bool                     success = true;
+            std::vector<TestObject*> objects;
+
+            for (int i = 0; i < kIterations; ++i)
+            {
+                TestObject* object = pool.Create();
+                object->value      = (static_cast<uint64_t>(t) << 32) | static_cast<uint64_t>(i);
+                objects.push_back(object);
+
+                if ((i % 3) == 2)
+                {
+                    pool.Destroy(objects.back());
+                    objects.pop_back();
+                }
+            }
+
+            for (size_t i = 0; i < objects.size(); ++i)
+            {
+                // Values written by this thread must not have been overwritten by another thread.
+                success = success && ((objects[i]->value >> 32) == static_cast<uint64_t>(t));
+                pool.Destroy(objects[i]);
+            }
+
+            results[t] = success ? 1 : 0;
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 0; t < kThreadCount; ++t)
+    {
+        REQUIRE(results[t] == 1);
+    }
+
+    REQUIRE(TestObject::live_count == 0);
+}
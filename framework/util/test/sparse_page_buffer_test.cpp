@@ -0,0 +1,126 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "util/sparse_page_buffer.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using gfxrecon::util::SparsePageBuffer;
+
+TEST_CASE("SparsePageBuffer only allocates written pages", "[sparse_page_buffer]")
+{
+    SparsePageBuffer buffer(16);
+
+    REQUIRE(buffer.GetPageSize() == 16);
+    REQUIRE(buffer.IsEmpty());
+    REQUIRE(!buffer.HasPages(0, 1024));
+
+    // A write that starts in page 2 and ends in page 4.
+    std::vector<uint8_t> data(28, 0xab);
+    buffer.Write(40, data.size(), data.data());
+
+    REQUIRE(!buffer.IsEmpty());
+    REQUIRE(buffer.GetPageCount() == 3);
+
+    REQUIRE(!buffer.HasPages(0, 32));
+    REQUIRE(buffer.HasPages(0, 33));
+    REQUIRE(buffer.HasPages(63, 1));
+    REQUIRE(!buffer.HasPages(80, 1024));
+    REQUIRE(!buffer.HasPages(40, 0));
+
+    // Writing to a page that is already allocated does not allocate another page.
+    buffer.Write(32, 1, data.data());
+    REQUIRE(buffer.GetPageCount() == 3);
+
+    buffer.Clear();
+    REQUIRE(buffer.IsEmpty());
+    REQUIRE(!buffer.HasPages(0, 1024));
+}
+
+TEST_CASE("SparsePageBuffer reads unwritten bytes as zero", "[sparse_page_buffer]")
+{
+    SparsePageBuffer buffer(16);
+
+    std::vector<uint8_t> data = { 1, 2, 3, 4 };
+    buffer.Write(14, data.size(), data.data());
+    buffer.Write(70, data.size(), data.data());
+
+    // Read a range that starts and ends in unallocated pages, with an unallocated page between the written pages.
+    std::vector<uint8_t> result(100, 0xff);
+    buffer.Read(0, result.size(), result.data());
+
+    std::vector<uint8_t> expected(100, 0);
+    std::copy(data.begin(), data.end(), expected.begin() + 14);
+    std::copy(data.begin(), data.end(), expected.begin() + 70);
+
+    REQUIRE(result == expected);
+
+    // Read a range that starts inside a written page.
+    std::vector<uint8_t> partial(8, 0xff);
+    buffer.Read(15, partial.size(), partial.data());
+    REQUIRE(partial == std::vector<uint8_t>({ 2, 3, 4, 0, 0, 0, 0, 0 }));
+}
+
+TEST_CASE("SparsePageBuffer matches a dense buffer for random writes", "[sparse_page_buffer]")
+{
+    const uint32_t kSeedCount  = 20;
+    const uint64_t kBufferSize = 4096;
+
+    for (uint32_t seed = 0; seed < kSeedCount; ++seed)
+    {
+        std::mt19937         random(seed);
+        SparsePageBuffer     buffer(64 + (random() % 3) * 61);
+        std::vector<uint8_t> dense(kBufferSize, 0);
+
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            uint64_t offset = random() % kBufferSize;
+            uint64_t size   = random() % std::min<uint64_t>(kBufferSize - offset, 300);
+
+            std::vector<uint8_t> data(static_cast<size_t>(size));
+            for (auto& value : data)
+            {
+                value = static_cast<uint8_t>(random());
+            }
+
+            buffer.Write(offset, size, data.data());
+            std::copy(data.begin(), data.end(), dense.begin() + offset);
+
+            uint64_t read_offset = random() % kBufferSize;
+            uint64_t read_size   = random() % (kBufferSize - read_offset);
+
+            std::vector<uint8_t> result(static_cast<size_t>(read_size), 0xff);
+            buffer.Read(read_offset, read_size, result.data());
+
+            INFO("seed " << seed << ", write " << i);
+            REQUIRE(std::equal(result.begin(), result.end(), dense.begin() + read_offset));
+        }
+
+        std::vector<uint8_t> result(static_cast<size_t>(kBufferSize));
+        buffer.Read(0, kBufferSize, result.data());
+        REQUIRE(result == dense);
+    }
+}
@@ -0,0 +1,201 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "util/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Blocks tasks until it is opened, so that tests can control when submitted tasks complete.
+class TaskGate
+{
+  public:
+    void Pass()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++waiting_count_;
+        waiting_.notify_all();
+        opened_.wait(lock, [this]() { return open_; });
+    }
+
+    void WaitForWaitingCount(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiting_.wait(lock, [this, count]() { return waiting_count_ >= count; });
+    }
+
+    void Open()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        opened_.notify_all();
+    }
+
+  private:
+    std::mutex              mutex_;
+    std::condition_variable waiting_;
+    std::condition_variable opened_;
+    size_t                  waiting_count_{ 0 };
+    bool                    open_{ false };
+};
+
+} // namespace
+
+TEST_CASE("ThreadPool creates the requested worker threads", "[thread_pool]")
+{
+    gfxrecon::util::ThreadPool pool(3);
+    REQUIRE(pool.GetThreadCount() == 3);
+    REQUIRE(pool.GetPendingTaskCount() == 0);
+
+    // A thread count of 0 creates at least one thread.
+    gfxrecon::util::ThreadPool default_pool(0);
+    REQUIRE(default_pool.GetThreadCount() > 0);
+}
+
+TEST_CASE("ThreadPool Wait returns after all submitted tasks complete", "[thread_pool]")
+{
+    const int kTaskCount = 1000;
+
+    gfxrecon::util::ThreadPool pool(4);
+    std::atomic<int>           completed{ 0 };
+
+    for (int i = 0; i < kTaskCount; ++i)
+    {
+        pool.Submit([&completed]() { ++completed; });
+    }
+
+    pool.Wait();
+
+    REQUIRE(completed == kTaskCount);
+    REQUIRE(pool.GetPendingTaskCount() == 0);
+
+    // The pool can be reused after waiting.
+    pool.Submit([&completed]() { ++completed; });
+    pool.Wait();
+
+    REQUIRE(completed == (kTaskCount + 1));
+}
+
+TEST_CASE("ThreadPool runs tasks in submission order", "[thread_pool]")
+{
+    gfxrecon::util::ThreadPool pool(1);
+    std::vector<int>           order;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        pool.Submit([&order, i]() { order.push_back(i); });
+    }
+
+    pool.Wait();
+
+    REQUIRE(order.size() == 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(order[i] == i);
+    }
+}
+
+TEST_CASE("ThreadPool counts queued and running tasks as pending", "[thread_pool]")
+{
+    gfxrecon::util::ThreadPool pool(2);
+    TaskGate                   gate;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        pool.Submit([&gate]() { gate.Pass(); });
+    }
+
+    // Two tasks are running and blocked, and three are queued.
+    gate.WaitForWaitingCount(2);
+    REQUIRE(pool.GetPendingTaskCount() == 5);
+
+    gate.Open();
+    pool.Wait();
+
+    REQUIRE(pool.GetPendingTaskCount() == 0);
+}
+
+TEST_CASE("ThreadPool bounded Submit waits for a free slot", "[thread_pool]")
+{
+    gfxrecon::util::ThreadPool pool(1);
+    TaskGate                   gate;
+    std::atomic<int>           completed{ 0 };
+
+    pool.Submit([&gate, &completed]() {
+        gate.Pass();
+        ++completed;
+    });
+
+    pool.Submit([&completed]() { ++completed; });
+    gate.WaitForWaitingCount(1);
+
+    REQUIRE(pool.GetPendingTaskCount() == 2);
+
+    // The third task can only be submitted after the first task completes, which requires the gate to be opened.
+    std::atomic<bool> submitted{ false };
+    std::thread       submitter([&pool, &completed, &submitted]() {
+        pool.Submit([&completed]() { ++completed; }, 2);
+        submitted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(!submitted);
+
+    gate.Open();
+    submitter.join();
+
+    REQUIRE(submitted);
+    REQUIRE(completed >= 1);
+
+    pool.Wait();
+    REQUIRE(completed == 3);
+
+    // A limit of 0 is treated as 1, so a task can always be submitted to an idle pool.
+    pool.Submit([&completed]() { ++completed; }, 0);
+    pool.Wait();
+    REQUIRE(completed == 4);
+}
+
+TEST_CASE("ThreadPool destructor completes pending tasks", "[thread_pool]")
+{
+    std::atomic<int> completed{ 0 };
+
+    {
+        gfxrecon::util::ThreadPool pool(2);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.Submit([&completed]() { ++completed; });
+        }
+    }
+
+    REQUIRE(completed == 100);
+}
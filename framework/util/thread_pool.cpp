@@ -0,0 +1,129 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/thread_pool.h"
+
+#include <algorithm>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+ThreadPool::ThreadPool(size_t thread_count) : active_task_count_(0), shutdown_(false)
+{
+    if (thread_count == 0)
+    {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    threads_.reserve(thread_count);
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads_.emplace_back(&ThreadPool::ProcessTasks, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    task_available_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::GetPendingTaskCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size() + active_task_count_;
+}
+
+void ThreadPool::Submit(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.emplace_back(std::move(task));
+    }
+
+    task_available_.notify_one();
+}
+
+void ThreadPool::Submit(Task task, size_t max_pending_tasks)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_complete_.wait(lock, [this, max_pending_tasks]() {
+            return (tasks_.size() + active_task_count_) < std::max<size_t>(max_pending_tasks, 1);
+        });
+        tasks_.emplace_back(std::move(task));
+    }
+
+    task_available_.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_complete_.wait(lock, [this]() { return tasks_.empty() && (active_task_count_ == 0); });
+}
+
+void ThreadPool::ProcessTasks()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        task_available_.wait(lock, [this]() { return shutdown_ || !tasks_.empty(); });
+
+        // Remaining tasks are completed before the thread exits.
+        if (tasks_.empty())
+        {
+            break;
+        }
+
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+        ++active_task_count_;
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        --active_task_count_;
+
+        task_complete_.notify_all();
+
+        if (tasks_.empty() && (active_task_count_ == 0))
+        {
+            tasks_complete_.notify_all();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,86 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_THREAD_POOL_H
+#define GFXRECON_UTIL_THREAD_POOL_H
+
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// A fixed size pool of worker threads that execute tasks in the order that they are submitted.
+class ThreadPool
+{
+  public:
+    typedef std::function<void()> Task;
+
+  public:
+    // A thread count of 0 creates one worker thread per CPU core.
+    ThreadPool(size_t thread_count);
+
+    // Waits for all submitted tasks to complete before stopping the worker threads.
+    ~ThreadPool();
+
+    size_t GetThreadCount() const { return threads_.size(); }
+
+    // Returns the number of tasks that are waiting to run or are running.
+    size_t GetPendingTaskCount() const;
+
+    void Submit(Task task);
+
+    // Blocks until fewer than max_pending_tasks tasks are waiting to run or running, then submits the task.  Limits the
+    // memory held by queued tasks without waiting for all of the submitted tasks to complete.
+    void Submit(Task task, size_t max_pending_tasks);
+
+    // Blocks until all submitted tasks have completed.
+    void Wait();
+
+  private:
+    // Not copyable or movable
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void ProcessTasks();
+
+  private:
+    std::vector<std::thread> threads_;
+    std::deque<Task>         tasks_;
+    mutable std::mutex       mutex_;
+    std::condition_variable  task_available_;
+    std::condition_variable  task_complete_;
+    std::condition_variable  tasks_complete_;
+    size_t                   active_task_count_;
+    bool                     shutdown_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_THREAD_POOL_H
@@ -91,6 +91,12 @@ static void add_instance_handle(VkInstance instance)
     instance_handles[encode::GetDispatchKey(instance)] = instance;
 }
 
+static void remove_instance_handle(VkInstance instance)
+{
+    std::lock_guard<std::mutex> lock(instance_handles_lock);
+    instance_handles.erase(encode::GetDispatchKey(instance));
+}
+
 static VkInstance get_instance_handle(const void* handle)
 {
     std::lock_guard<std::mutex> lock(instance_handles_lock);
@@ -179,6 +185,16 @@ VKAPI_ATTR VkResult VKAPI_CALL dispatch_CreateDevice(VkPhysicalDevice
     return result;
 }
 
+VKAPI_ATTR void VKAPI_CALL dispatch_DestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator)
+{
+    if (instance != VK_NULL_HANDLE)
+    {
+        remove_instance_handle(instance);
+    }
+
+    encode::DestroyInstance(instance, pAllocator);
+}
+
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char* pName)
 {
     PFN_vkVoidFunction result = nullptr;
@@ -209,6 +225,12 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance
         {
             result = entry->second;
         }
+
+        // The layer removes destroyed instances from its instance handle table before the instance is destroyed.
+        if (!strcmp(pName, "vkDestroyInstance"))
+        {
+            result = reinterpret_cast<PFN_vkVoidFunction>(dispatch_DestroyInstance);
+        }
     }
 
     return result;
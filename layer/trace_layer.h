@@ -54,6 +54,7 @@ VKAPI_ATTR VkResult VKAPI_CALL dispatch_CreateDevice(VkPhysicalDevice
                                                      const VkDeviceCreateInfo*    pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator,
                                                      VkDevice*                    pDevice);
+VKAPI_ATTR void VKAPI_CALL dispatch_DestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator);
 
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -146,6 +146,14 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     {
         return WriteFillMemoryMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryReferenceCommand)
+    {
+        return WriteFillMemoryReferenceMetaData(block_header, meta_data_id);
+    }
+    else if (meta_data_type == format::MetaDataType::kStoreBlobCommand)
+    {
+        return WriteStoreBlobMetaData(block_header, meta_data_id);
+    }
     else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
         return WriteInitBufferMetaData(block_header, meta_data_id);
@@ -337,6 +345,190 @@ bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& bl
     return true;
 }
 
+bool CompressionConverter::WriteFillMemoryReferenceMetaData(const format::BlockHeader& block_header,
+                                                            format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryReferenceCommand);
+
+    format::FillMemoryReferenceCommandHeader fill_cmd;
+
+    bool success = ReadBytes(&fill_cmd.thread_id, sizeof(fill_cmd.thread_id));
+    success      = success && ReadBytes(&fill_cmd.memory_id, sizeof(fill_cmd.memory_id));
+    success      = success && ReadBytes(&fill_cmd.memory_offset, sizeof(fill_cmd.memory_offset));
+    success      = success && ReadBytes(&fill_cmd.memory_size, sizeof(fill_cmd.memory_size));
+    success      = success && ReadBytes(&fill_cmd.content_id, sizeof(fill_cmd.content_id));
+    success      = success && ReadBytes(&fill_cmd.data_size, sizeof(fill_cmd.data_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill_cmd.data_size);
+
+        size_t         data_size    = static_cast<size_t>(fill_cmd.data_size);
+        const uint8_t* data_address = nullptr;
+
+        // Blocks that reference previously written content have no data to convert.
+        if (data_size > 0)
+        {
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+                size_t compressed_size =
+                    static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
+
+                if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                         "Failed to read fill memory reference meta-data block");
+                    return false;
+                }
+
+                assert(uncompressed_size == data_size);
+            }
+            else
+            {
+                if (!ReadParameterBuffer(data_size))
+                {
+                    HandleBlockReadError(kErrorReadingBlockData,
+                                         "Failed to read fill memory reference meta-data block");
+                    return false;
+                }
+            }
+
+            data_address = GetParameterBuffer().data();
+        }
+
+        fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        fill_cmd.meta_header.meta_data_id      = meta_data_id;
+
+        if (!decompressing_ && (data_size > 0))
+        {
+            assert(target_compressor_ != nullptr);
+
+            auto&  compressed_buffer = GetCompressedParameterBuffer();
+            size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+
+            if ((compressed_size > 0) && (compressed_size < data_size))
+            {
+                // As with fill memory commands, the header includes the uncompressed size, so only the block type
+                // changes to indicate the data is compressed.
+                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+                data_address = compressed_buffer.data();
+                data_size    = compressed_size;
+            }
+        }
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + data_size;
+
+        if (!WriteBytes(&fill_cmd, sizeof(fill_cmd)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader,
+                                  "Failed to write fill memory reference meta-data block header");
+            return false;
+        }
+
+        if ((data_size > 0) && !WriteBytes(data_address, data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory reference meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory reference meta-data block header");
+        return false;
+    }
+
+    return true;
+}
+
+bool CompressionConverter::WriteStoreBlobMetaData(const format::BlockHeader& block_header,
+                                                  format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kStoreBlobCommand);
+
+    format::StoreBlobCommandHeader store_cmd;
+
+    bool success = ReadBytes(&store_cmd.thread_id, sizeof(store_cmd.thread_id));
+    success      = success && ReadBytes(store_cmd.blob_digest, sizeof(store_cmd.blob_digest));
+    success      = success && ReadBytes(&store_cmd.data_size, sizeof(store_cmd.data_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, store_cmd.data_size);
+
+        size_t data_size = static_cast<size_t>(store_cmd.data_size);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            size_t compressed_size =
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(store_cmd));
+
+            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            {
+                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read store blob meta-data block");
+                return false;
+            }
+
+            assert(uncompressed_size == data_size);
+        }
+        else
+        {
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read store blob meta-data block");
+                return false;
+            }
+        }
+
+        const uint8_t* data_address = GetParameterBuffer().data();
+
+        store_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        store_cmd.meta_header.meta_data_id      = meta_data_id;
+
+        if (!decompressing_ && (data_size > 0))
+        {
+            assert(target_compressor_ != nullptr);
+
+            auto&  compressed_buffer = GetCompressedParameterBuffer();
+            size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+
+            if ((compressed_size > 0) && (compressed_size < data_size))
+            {
+                // The header includes the uncompressed size, so only the block type changes to indicate compression.
+                store_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+                data_address = compressed_buffer.data();
+                data_size    = compressed_size;
+            }
+        }
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        store_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(store_cmd) + data_size;
+
+        if (!WriteBytes(&store_cmd, sizeof(store_cmd)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write store blob meta-data block header");
+            return false;
+        }
+
+        if ((data_size > 0) && !WriteBytes(data_address, data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write store blob meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read store blob meta-data block header");
+        return false;
+    }
+
+    return true;
+}
+
 bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& block_header,
                                                    format::MetaDataId         meta_data_id)
 {
@@ -57,6 +57,10 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool WriteFillMemoryReferenceMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool WriteStoreBlobMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
     bool WriteInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
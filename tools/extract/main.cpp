@@ -23,6 +23,7 @@
 #include "project_version.h"
 
 #include "decode/file_processor.h"
+#include "decode/vulkan_replay_options.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -30,19 +31,26 @@
 #include "util/file_path.h"
 #include "util/hash.h"
 #include "util/logging.h"
+#include "util/thread_pool.h"
 
 #include "vulkan/vulkan.h"
 
+#include <atomic>
 #include <cstdlib>
+#include <memory>
 #include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 const char kHelpShortOption[]   = "-h";
 const char kHelpLongOption[]    = "--help";
 const char kVersionOption[]     = "--version";
 const char kDirectoryArgument[] = "--dir";
 const char kNoDebugPopup[]      = "--no-debug-popup";
+const char kDedupOption[]       = "--dedup";
 
-const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--dedup";
 const char kArguments[] = "--dir";
 
 static void PrintUsage(const char* exe_name)
@@ -55,7 +63,7 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Extract shaders from a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--dir <dir>] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--dir <dir>] [--dedup] <file>\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("Optional arguments:");
@@ -65,7 +73,13 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("             \t\tuse <file>.shaders in working directory. Create directory");
     GFXRECON_WRITE_CONSOLE("             \t\tif necessary. Each shader is placed in individual file");
     GFXRECON_WRITE_CONSOLE("             \t\tnamed sh<handle_id> where handle_id is handle id of the");
-    GFXRECON_WRITE_CONSOLE("             \t\tCreateShaderModule call. See gfxrecon-replay --replace-shaders.");
+    GFXRECON_WRITE_CONSOLE("             \t\tCreateShaderModule call. A %s file mapping",
+                           gfxrecon::decode::kShaderManifestFileName);
+    GFXRECON_WRITE_CONSOLE("             \t\thandle ids to shader files is also written to the directory.");
+    GFXRECON_WRITE_CONSOLE("             \t\tSee gfxrecon-replay --replace-shaders.");
+    GFXRECON_WRITE_CONSOLE("  --dedup\t\tWrite one file for each unique shader, named sh<hash> where");
+    GFXRECON_WRITE_CONSOLE("         \t\thash is the SHA-256 digest of the shader code, instead of one");
+    GFXRECON_WRITE_CONSOLE("         \t\tfile for each CreateShaderModule call.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -108,10 +122,49 @@ static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::
     return false;
 }
 
+// Only decodes vkCreateShaderModule calls, so that the file processor can skip the data of all other blocks.
+class ShaderModuleDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual bool SupportsApiCall(gfxrecon::format::ApiCallId call_id) override
+    {
+        return (call_id == gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule);
+    }
+
+    virtual bool SupportsMetaDataId(gfxrecon::format::MetaDataId meta_data_id) override { return false; }
+};
+
 class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
 {
   public:
-    VulkanExtractConsumer(std::string& extract_dir) : extract_dir_(extract_dir) {}
+    VulkanExtractConsumer(const std::string& extract_dir, bool deduplicate) :
+        extract_dir_(extract_dir), deduplicate_(deduplicate), write_pool_(0), write_failed_(false), file_count_(0)
+    {}
+
+    uint64_t GetShaderCount() const { return manifest_.size(); }
+
+    uint64_t GetFileCount() const { return file_count_; }
+
+    // Waits for the shader files to be written, and writes the manifest.  Returns false if a file could not be written.
+    bool Finish()
+    {
+        write_pool_.Wait();
+
+        std::string file_path = gfxrecon::util::filepath::Join(extract_dir_, gfxrecon::decode::kShaderManifestFileName);
+        std::string manifest;
+
+        for (const auto& entry : manifest_)
+        {
+            manifest += std::to_string(entry.first) + " " + entry.second + "\n";
+        }
+
+        if (!WriteShaderFile(file_path, reinterpret_cast<const uint8_t*>(manifest.data()), manifest.size()))
+        {
+            write_failed_ = true;
+        }
+
+        return !write_failed_;
+    }
 
     virtual void Process_vkCreateShaderModule(
         const gfxrecon::decode::ApiCallInfo&                                                        call_info,
@@ -124,32 +177,101 @@ class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
         if ((returnValue >= 0) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pShaderModule != nullptr) &&
             !pShaderModule->IsNull())
         {
-            const uint32_t* orig_code = pCreateInfo->GetPointer()->pCode;
-            size_t          orig_size = pCreateInfo->GetPointer()->codeSize;
-            uint64_t        handle_id = *pShaderModule->GetPointer();
-            std::string     file_name = "sh" + std::to_string(handle_id);
-            std::string     file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
-
-            FILE*   fp     = nullptr;
-            int32_t result = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
-            if (result == 0)
+            const uint8_t* orig_code = reinterpret_cast<const uint8_t*>(pCreateInfo->GetPointer()->pCode);
+            size_t         orig_size = pCreateInfo->GetPointer()->codeSize;
+            uint64_t       handle_id = *pShaderModule->GetPointer();
+            std::string    file_name;
+
+            if (deduplicate_)
             {
-                size_t written_size = gfxrecon::util::platform::FileWrite(orig_code, sizeof(char), orig_size, fp);
-                if (written_size != orig_size)
+                file_name = "sh" + GetDigestString(orig_code, orig_size);
+
+                // Shaders with the same code share a file.
+                if (!written_files_.insert(file_name).second)
                 {
-                    GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_name.c_str());
+                    manifest_.emplace_back(handle_id, std::move(file_name));
+                    return;
                 }
-                gfxrecon::util::platform::FileClose(fp);
             }
             else
             {
-                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_name.c_str());
+                file_name = "sh" + std::to_string(handle_id);
+            }
+
+            std::string file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
+            manifest_.emplace_back(handle_id, std::move(file_name));
+            ++file_count_;
+
+            // The decoded shader code is only valid for the duration of the call, so the worker thread writes a copy.
+            auto code = std::make_shared<std::vector<uint8_t>>(orig_code, orig_code + orig_size);
+
+            // Limit the amount of shader code held in memory while waiting to be written.
+            write_pool_.Submit(
+                [this, file_path, code]() {
+                    if (!WriteShaderFile(file_path, code->data(), code->size()))
+                    {
+                        write_failed_ = true;
+                    }
+                },
+                kMaxPendingWrites);
+        }
+    }
+
+  private:
+    static const size_t kMaxPendingWrites = 256;
+
+  private:
+    static std::string GetDigestString(const uint8_t* data, size_t size)
+    {
+        static const char kHexDigits[] = "0123456789abcdef";
+
+        uint8_t digest[gfxrecon::util::hash::kSha256DigestSize];
+        gfxrecon::util::hash::Sha256(data, size, digest);
+
+        std::string digest_string;
+        for (uint8_t value : digest)
+        {
+            digest_string += kHexDigits[value >> 4];
+            digest_string += kHexDigits[value & 0xf];
+        }
+
+        return digest_string;
+    }
+
+    static bool WriteShaderFile(const std::string& file_path, const uint8_t* data, size_t size)
+    {
+        FILE*   fp      = nullptr;
+        bool    success = false;
+        int32_t result  = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
+        if (result == 0)
+        {
+            size_t written_size = gfxrecon::util::platform::FileWrite(data, sizeof(char), size, fp);
+            if (written_size != size)
+            {
+                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_path.c_str());
+            }
+            else
+            {
+                success = true;
             }
+            gfxrecon::util::platform::FileClose(fp);
+        }
+        else
+        {
+            GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_path.c_str());
         }
+
+        return success;
     }
 
   private:
-    std::string extract_dir_;
+    std::string                                   extract_dir_;
+    bool                                          deduplicate_;
+    gfxrecon::util::ThreadPool                    write_pool_; // Writes shader files on worker threads.
+    std::atomic<bool>                             write_failed_;
+    std::unordered_set<std::string>               written_files_;
+    std::vector<std::pair<uint64_t, std::string>> manifest_; // Shader file name for each handle ID.
+    uint64_t                                      file_count_;
 };
 
 int main(int argc, const char** argv)
@@ -218,24 +340,37 @@ int main(int argc, const char** argv)
             }
         }
 
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanExtractConsumer           extract_consumer(extract_dir);
+        ShaderModuleDecoder   decoder;
+        VulkanExtractConsumer extract_consumer(extract_dir, arg_parser.IsOptionSet(kDedupOption));
 
         decoder.AddConsumer(&extract_consumer);
 
         file_processor.AddDecoder(&decoder);
         file_processor.ProcessAllFrames();
 
+        bool write_success = extract_consumer.Finish();
+
         if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
             GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
             gfxrecon::util::Log::Release();
             exit(-1);
         }
+        else if (!write_success)
+        {
+            GFXRECON_WRITE_CONSOLE("A failure has occurred while writing shader files");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
         else if (file_processor.GetCurrentFrameNumber() == 0)
         {
             GFXRECON_WRITE_CONSOLE("File did not contain any frames");
         }
+
+        GFXRECON_WRITE_CONSOLE("Extracted %" PRIu64 " shaders to %" PRIu64 " files in %s",
+                               extract_consumer.GetShaderCount(),
+                               extract_consumer.GetFileCount(),
+                               extract_dir.c_str());
     }
 
     gfxrecon::util::Log::Release();
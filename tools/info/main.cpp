@@ -22,6 +22,7 @@
 
 #include "project_version.h"
 
+#include "decode/block_statistics.h"
 #include "decode/file_processor.h"
 #include "format/format.h"
 #include "format/format_util.h"
@@ -32,19 +33,27 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
+#include <cstdio>
 #include <cstdlib>
 #include <limits>
+#include <map>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kSummaryOption[]   = "--summary";
+const char kSizesOption[]     = "--sizes";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[] = "-h|--help,--version,--no-debug-popup,--summary,--sizes";
 
 const char kUnrecognizedFormatString[] = "<unrecognized-format>";
 
@@ -58,12 +67,19 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Print statistics for a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--summary] [--sizes] <file>\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --summary\t\tOnly decode the API calls needed for application, device, memory");
+    GFXRECON_WRITE_CONSOLE("          \t\tallocation, and pipeline info, skipping the data for all other blocks.");
+    GFXRECON_WRITE_CONSOLE("          \t\tAlso print block size totals and a histogram of API calls by ID.");
+    GFXRECON_WRITE_CONSOLE("  --sizes\t\tPrint a report of the file and uncompressed sizes of the blocks for");
+    GFXRECON_WRITE_CONSOLE("          \t\teach API call, meta-data type, frame, and memory object filled by");
+    GFXRECON_WRITE_CONSOLE("          \t\tfill memory commands. The data for every block is read and");
+    GFXRECON_WRITE_CONSOLE("          \t\tdecompressed to determine its uncompressed size.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -115,6 +131,44 @@ static std::string GetVersionString(uint32_t api_version)
     return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
 }
 
+// Decoder for summary mode, which only decodes the API calls that are processed by VulkanStatsConsumer to retrieve
+// application, device, allocation, and pipeline info.  The file processor skips the data for all other blocks.
+class SummaryDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual bool SupportsApiCall(gfxrecon::format::ApiCallId call_id) override
+    {
+        switch (call_id)
+        {
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateInstance:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateDevice:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateComputePipelines:
+            case gfxrecon::format::ApiCallId::ApiCall_vkAllocateMemory:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    virtual bool SupportsMetaDataId(gfxrecon::format::MetaDataId meta_data_id) override { return false; }
+};
+
+// Decoder for the size report, which causes the data for every block to be read and decompressed to determine its
+// uncompressed size.  API call parameters are not decoded.
+class SizeReportDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual void DecodeFunctionCall(gfxrecon::format::ApiCallId          call_id,
+                                    const gfxrecon::decode::ApiCallInfo& call_info,
+                                    const uint8_t*                       parameter_buffer,
+                                    size_t                               buffer_size) override
+    {}
+};
+
 class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
 {
   public:
@@ -495,6 +549,105 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
     uint64_t max_allocation_size_{ 0 };
 };
 
+// Sort the entries of a statistics map by decreasing file size.
+template <typename Key>
+static std::vector<std::pair<Key, gfxrecon::decode::BlockStatistics::Totals>>
+GetSortedTotals(const std::map<Key, gfxrecon::decode::BlockStatistics::Totals>& totals)
+{
+    typedef std::pair<Key, gfxrecon::decode::BlockStatistics::Totals> Entry;
+
+    std::vector<Entry> sorted(totals.begin(), totals.end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Entry& a, const Entry& b) {
+        return a.second.bytes > b.second.bytes;
+    });
+
+    return sorted;
+}
+
+static void PrintBlockSummary(const gfxrecon::decode::BlockStatistics& block_statistics)
+{
+    const auto& block_totals            = block_statistics.GetBlockTotals();
+    const auto& compressed_block_totals = block_statistics.GetCompressedBlockTotals();
+
+    GFXRECON_WRITE_CONSOLE("\nBlock info:");
+    GFXRECON_WRITE_CONSOLE("\tTotal blocks: %" PRIu64 " (%" PRIu64 " bytes)", block_totals.count, block_totals.bytes);
+    GFXRECON_WRITE_CONSOLE("\tCompressed blocks: %" PRIu64 " (%" PRIu64 " bytes)",
+                           compressed_block_totals.count,
+                           compressed_block_totals.bytes);
+    GFXRECON_WRITE_CONSOLE("\tUncompressed blocks: %" PRIu64 " (%" PRIu64 " bytes)",
+                           block_totals.count - compressed_block_totals.count,
+                           block_totals.bytes - compressed_block_totals.bytes);
+    GFXRECON_WRITE_CONSOLE("\tFunction call blocks: %" PRIu64 " (%" PRIu64 " bytes)",
+                           block_statistics.GetFunctionCallBlockTotals().count,
+                           block_statistics.GetFunctionCallBlockTotals().bytes);
+    GFXRECON_WRITE_CONSOLE("\tMeta-data blocks: %" PRIu64 " (%" PRIu64 " bytes)",
+                           block_statistics.GetMetaDataBlockTotals().count,
+                           block_statistics.GetMetaDataBlockTotals().bytes);
+
+    GFXRECON_WRITE_CONSOLE("\nAPI call info (by total size):");
+    for (const auto& entry : GetSortedTotals(block_statistics.GetApiCallTotals()))
+    {
+        GFXRECON_WRITE_CONSOLE("\t%s: %" PRIu64 " calls (%" PRIu64 " bytes)",
+                               gfxrecon::format::GetApiCallName(entry.first).c_str(),
+                               entry.second.count,
+                               entry.second.bytes);
+    }
+}
+
+static void PrintSizeTotals(const std::string& name, const gfxrecon::decode::BlockStatistics::Totals& totals)
+{
+    double ratio =
+        (totals.bytes > 0) ? (static_cast<double>(totals.uncompressed_bytes) / static_cast<double>(totals.bytes)) : 1.0;
+
+    GFXRECON_WRITE_CONSOLE("\t%s: %" PRIu64 " blocks, %" PRIu64 " bytes, %" PRIu64 " uncompressed bytes, ratio %.2f",
+                           name.c_str(),
+                           totals.count,
+                           totals.bytes,
+                           totals.uncompressed_bytes,
+                           ratio);
+}
+
+static void PrintSizeReport(const gfxrecon::decode::BlockStatistics& block_statistics)
+{
+    GFXRECON_WRITE_CONSOLE("\nSize report:");
+    PrintSizeTotals("All blocks", block_statistics.GetBlockTotals());
+    PrintSizeTotals("Compressed blocks", block_statistics.GetCompressedBlockTotals());
+    PrintSizeTotals("Function call blocks", block_statistics.GetFunctionCallBlockTotals());
+    PrintSizeTotals("Meta-data blocks", block_statistics.GetMetaDataBlockTotals());
+
+    GFXRECON_WRITE_CONSOLE("\nSize by API call:");
+    for (const auto& entry : GetSortedTotals(block_statistics.GetApiCallTotals()))
+    {
+        PrintSizeTotals(gfxrecon::format::GetApiCallName(entry.first), entry.second);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nSize by meta-data type:");
+    for (const auto& entry : GetSortedTotals(block_statistics.GetMetaDataTypeTotals()))
+    {
+        std::string type_name = gfxrecon::format::GetMetaDataTypeName(entry.first);
+        if (type_name.empty())
+        {
+            type_name = "MetaData_" + std::to_string(static_cast<uint32_t>(entry.first));
+        }
+
+        PrintSizeTotals(type_name, entry.second);
+    }
+
+    // Frame numbers start at 1, with the blocks that precede the first frame delimiter included in the first frame.
+    GFXRECON_WRITE_CONSOLE("\nSize by frame:");
+    const auto& frame_totals = block_statistics.GetFrameTotals();
+    for (size_t i = 0; i < frame_totals.size(); ++i)
+    {
+        PrintSizeTotals("Frame " + std::to_string(i + 1), frame_totals[i]);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nSize by memory object for fill memory commands:");
+    for (const auto& entry : GetSortedTotals(block_statistics.GetFillMemoryTotals()))
+    {
+        PrintSizeTotals("Memory " + std::to_string(entry.first), entry.second);
+    }
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
@@ -525,15 +678,32 @@ int main(int argc, const char** argv)
     const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
     std::string                     input_filename       = positional_arguments[0];
 
+    bool summary     = arg_parser.IsOptionSet(kSummaryOption);
+    bool size_report = arg_parser.IsOptionSet(kSizesOption);
+
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanStatsConsumer             stats_consumer;
+        gfxrecon::decode::VulkanDecoder   full_decoder;
+        SummaryDecoder                    summary_decoder;
+        SizeReportDecoder                 size_report_decoder;
+        gfxrecon::decode::VulkanDecoder*  decoder = summary ? &summary_decoder : &full_decoder;
+        gfxrecon::decode::BlockStatistics block_statistics;
+        VulkanStatsConsumer               stats_consumer;
 
-        decoder.AddConsumer(&stats_consumer);
+        decoder->AddConsumer(&stats_consumer);
 
-        file_processor.AddDecoder(&decoder);
+        if (summary || size_report)
+        {
+            file_processor.SetBlockStatistics(&block_statistics);
+        }
+
+        file_processor.AddDecoder(decoder);
+
+        if (size_report)
+        {
+            file_processor.AddDecoder(&size_report_decoder);
+        }
         file_processor.ProcessAllFrames();
 
         if ((file_processor.GetCurrentFrameNumber() > 0) &&
@@ -632,6 +802,16 @@ int main(int argc, const char** argv)
             // GFXRECON_WRITE_CONSOLE("\nDraw/dispatch call info:");
             // GFXRECON_WRITE_CONSOLE("\tTotal draw calls: %" PRIu64, stats_consumer.GetDrawCount());
             // GFXRECON_WRITE_CONSOLE("\tTotal dispatch calls: %" PRIu64, stats_consumer.GetDispatchCount());
+
+            if (summary)
+            {
+                PrintBlockSummary(block_statistics);
+            }
+
+            if (size_report)
+            {
+                PrintSizeReport(block_statistics);
+            }
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
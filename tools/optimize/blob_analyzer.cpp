@@ -0,0 +1,154 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "blob_analyzer.h"
+
+#include "util/hash.h"
+#include "util/platform.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// The SPIR-V code of a shader module create info is encoded as the codeSize value, followed by the pCode array's
+// attribute, address, and length, and then the code.
+const size_t   kShaderCodePreambleSize = sizeof(format::SizeTEncodeType) + sizeof(uint32_t) +
+                                       sizeof(format::AddressEncodeType) + sizeof(format::SizeTEncodeType);
+const uint32_t kSpirVMagicNumber       = 0x07230203;
+
+BlobAnalyzer::BlobAnalyzer() : repeated_blob_count_(0), repeated_blob_bytes_(0) {}
+
+std::string BlobAnalyzer::GetBlobDigest(const uint8_t* data, size_t size)
+{
+    uint8_t digest[format::kBlobDigestSize];
+    util::hash::Sha256(data, size, digest);
+    return std::string(reinterpret_cast<const char*>(digest), sizeof(digest));
+}
+
+bool BlobAnalyzer::FindShaderCode(const uint8_t* parameter_buffer,
+                                  size_t         buffer_size,
+                                  size_t*        code_offset,
+                                  size_t*        code_size)
+{
+    assert((code_offset != nullptr) && (code_size != nullptr));
+
+    // Search for the SPIR-V magic number at the start of a code array with a length that matches the codeSize value.
+    for (size_t offset = kShaderCodePreambleSize; (offset + sizeof(kSpirVMagicNumber)) <= buffer_size; ++offset)
+    {
+        uint32_t word = 0;
+        util::platform::MemoryCopy(&word, sizeof(word), parameter_buffer + offset, sizeof(word));
+
+        if (word == kSpirVMagicNumber)
+        {
+            format::SizeTEncodeType code_size_value = 0;
+            format::SizeTEncodeType code_length     = 0;
+
+            util::platform::MemoryCopy(&code_size_value,
+                                       sizeof(code_size_value),
+                                       parameter_buffer + (offset - kShaderCodePreambleSize),
+                                       sizeof(code_size_value));
+            util::platform::MemoryCopy(&code_length,
+                                       sizeof(code_length),
+                                       parameter_buffer + (offset - sizeof(code_length)),
+                                       sizeof(code_length));
+
+            if ((code_size_value == (code_length * sizeof(uint32_t))) && (code_size_value <= (buffer_size - offset)))
+            {
+                (*code_offset) = offset;
+                (*code_size)   = static_cast<size_t>(code_size_value);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+std::unordered_set<std::string> BlobAnalyzer::GetRepeatedBlobDigests() const
+{
+    std::unordered_set<std::string> digests;
+
+    for (const auto& entry : blob_counts_)
+    {
+        if (entry.second > 1)
+        {
+            digests.insert(entry.first);
+        }
+    }
+
+    return digests;
+}
+
+void BlobAnalyzer::DecodeFunctionCall(format::ApiCallId          call_id,
+                                      const decode::ApiCallInfo& call_info,
+                                      const uint8_t*             parameter_buffer,
+                                      size_t                     buffer_size)
+{
+    size_t code_offset = 0;
+    size_t code_size   = 0;
+
+    if ((call_id == format::ApiCallId::ApiCall_vkCreateShaderModule) &&
+        FindShaderCode(parameter_buffer, buffer_size, &code_offset, &code_size))
+    {
+        AddBlob(parameter_buffer + code_offset, code_size);
+    }
+}
+
+void BlobAnalyzer::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                             format::HandleId device_id,
+                                             format::HandleId buffer_id,
+                                             uint64_t         data_size,
+                                             const uint8_t*   data)
+{
+    AddBlob(data, data_size);
+}
+
+void BlobAnalyzer::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                            format::HandleId             device_id,
+                                            format::HandleId             image_id,
+                                            uint64_t                     data_size,
+                                            uint32_t                     aspect,
+                                            uint32_t                     layout,
+                                            const std::vector<uint64_t>& level_sizes,
+                                            const uint8_t*               data)
+{
+    AddBlob(data, data_size);
+}
+
+void BlobAnalyzer::AddBlob(const uint8_t* data, uint64_t size)
+{
+    if ((data != nullptr) && (size >= kMinBlobSize))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+        uint32_t& count = blob_counts_[GetBlobDigest(data, static_cast<size_t>(size))];
+        if (count > 0)
+        {
+            ++repeated_blob_count_;
+            repeated_blob_bytes_ += size;
+        }
+
+        ++count;
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,358 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "dead_call_analyzer.h"
+
+#include "util/platform.h"
+
+#include "vulkan/vulkan.h"
+
+#include <algorithm>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Size of the encoded parameters that follow the create info and allocator parameters of an object creation call:
+// the handle pointer's attribute, address, and handle ID, followed by the VkResult return value.
+const size_t kCreateHandleSuffixSize = sizeof(uint32_t) + sizeof(format::AddressEncodeType) +
+                                       sizeof(format::HandleEncodeType) + sizeof(format::EnumEncodeType);
+
+DeadCallAnalyzer::DeadCallAnalyzer() :
+    min_candidate_id_(std::numeric_limits<format::HandleId>::max()), max_candidate_id_(0), removable_object_count_(0),
+    redundant_query_count_(0)
+{}
+
+void DeadCallAnalyzer::DecodeFunctionCall(format::ApiCallId          call_id,
+                                          const decode::ApiCallInfo& call_info,
+                                          const uint8_t*             parameter_buffer,
+                                          size_t                     buffer_size)
+{
+    // Destruction is processed before scanning, so that the destroyed handle is not treated as a reference. Creation
+    // is processed after scanning, so that the created handle is not treated as a reference.
+    if (IsObjectDestroyCall(call_id))
+    {
+        RemoveCandidate(call_info.index, parameter_buffer, buffer_size);
+    }
+    else if (IsPhysicalDeviceQuery(call_id))
+    {
+        ProcessQuery(call_id, call_info.index, parameter_buffer, buffer_size);
+    }
+
+    ScanHandleReferences(parameter_buffer, buffer_size);
+
+    if (IsObjectCreateCall(call_id))
+    {
+        AddCandidate(call_info.index, parameter_buffer, buffer_size);
+    }
+}
+
+void DeadCallAnalyzer::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    MarkUsed(memory_id);
+}
+
+void DeadCallAnalyzer::DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                                   format::HandleId surface_id,
+                                                   uint32_t         width,
+                                                   uint32_t         height)
+{
+    MarkUsed(surface_id);
+}
+
+void DeadCallAnalyzer::DispatchResizeWindowCommand2(
+    format::ThreadId thread_id, format::HandleId surface_id, uint32_t width, uint32_t height, uint32_t pre_transform)
+{
+    MarkUsed(surface_id);
+}
+
+void DeadCallAnalyzer::DispatchCreateHardwareBufferCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    memory_id,
+    uint64_t                                            buffer_id,
+    uint32_t                                            format,
+    uint32_t                                            width,
+    uint32_t                                            height,
+    uint32_t                                            stride,
+    uint32_t                                            usage,
+    uint32_t                                            layers,
+    const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    MarkUsed(memory_id);
+}
+
+void DeadCallAnalyzer::DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                       format::HandleId device_id,
+                                                       format::HandleId object_id,
+                                                       uint64_t         address)
+{
+    MarkUsed(object_id);
+}
+
+void DeadCallAnalyzer::DispatchSetRayTracingShaderGroupHandlesCommand(format::ThreadId thread_id,
+                                                                      format::HandleId device_id,
+                                                                      format::HandleId buffer_id,
+                                                                      size_t           data_size,
+                                                                      const uint8_t*   data)
+{
+    MarkUsed(buffer_id);
+}
+
+void DeadCallAnalyzer::DispatchSetSwapchainImageStateCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_state)
+{
+    for (const auto& image_info : image_state)
+    {
+        MarkUsed(image_info.image_id);
+        MarkUsed(image_info.acquire_semaphore_id);
+        MarkUsed(image_info.acquire_fence_id);
+    }
+}
+
+void DeadCallAnalyzer::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId buffer_id,
+                                                 uint64_t         data_size,
+                                                 const uint8_t*   data)
+{
+    MarkUsed(buffer_id);
+}
+
+void DeadCallAnalyzer::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                                format::HandleId             device_id,
+                                                format::HandleId             image_id,
+                                                uint64_t                     data_size,
+                                                uint32_t                     aspect,
+                                                uint32_t                     layout,
+                                                const std::vector<uint64_t>& level_sizes,
+                                                const uint8_t*               data)
+{
+    MarkUsed(image_id);
+}
+
+// Creation calls with the (device, pCreateInfo, pAllocator, pHandle) signature and a VkResult return value, for
+// objects that have no side effects beyond their own existence.
+bool DeadCallAnalyzer::IsObjectCreateCall(format::ApiCallId call_id) const
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkAllocateMemory:
+        case format::ApiCallId::ApiCall_vkCreateBuffer:
+        case format::ApiCallId::ApiCall_vkCreateBufferView:
+        case format::ApiCallId::ApiCall_vkCreateImage:
+        case format::ApiCallId::ApiCall_vkCreateImageView:
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkCreateFence:
+        case format::ApiCallId::ApiCall_vkCreateSemaphore:
+        case format::ApiCallId::ApiCall_vkCreateEvent:
+        case format::ApiCallId::ApiCall_vkCreateQueryPool:
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+        case format::ApiCallId::ApiCall_vkCreatePipelineCache:
+        case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCreateFramebuffer:
+        case format::ApiCallId::ApiCall_vkCreateCommandPool:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Destruction calls with the (device, handle, pAllocator) signature.
+bool DeadCallAnalyzer::IsObjectDestroyCall(format::ApiCallId call_id) const
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkFreeMemory:
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Queries whose results depend only on their parameters, so that a query with parameter data identical to an earlier
+// query (including the encoded results) is redundant.
+bool DeadCallAnalyzer::IsPhysicalDeviceQuery(format::ApiCallId call_id) const
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void DeadCallAnalyzer::AddCandidate(uint64_t call_index, const uint8_t* parameter_buffer, size_t buffer_size)
+{
+    if (buffer_size >= kCreateHandleSuffixSize)
+    {
+        const uint8_t* suffix = parameter_buffer + (buffer_size - kCreateHandleSuffixSize);
+
+        uint32_t                 pointer_attrib = 0;
+        format::HandleEncodeType handle_id      = 0;
+        format::EnumEncodeType   result         = 0;
+        size_t                   offset         = 0;
+
+        util::platform::MemoryCopy(&pointer_attrib, sizeof(pointer_attrib), suffix, sizeof(pointer_attrib));
+        offset += sizeof(pointer_attrib) + sizeof(format::AddressEncodeType);
+
+        util::platform::MemoryCopy(&handle_id, sizeof(handle_id), suffix + offset, sizeof(handle_id));
+        offset += sizeof(handle_id);
+
+        util::platform::MemoryCopy(&result, sizeof(result), suffix + offset, sizeof(result));
+
+        // Only track objects that were successfully created, with a handle pointer that was encoded with both its
+        // address and its value.
+        const uint32_t expected_attrib = format::PointerAttributes::kIsSingle |
+                                         format::PointerAttributes::kHasAddress | format::PointerAttributes::kHasData;
+
+        if ((pointer_attrib == expected_attrib) && (static_cast<VkResult>(result) == VK_SUCCESS) &&
+            (handle_id != format::kNullHandleId))
+        {
+            candidates_[handle_id].create_call_index = call_index;
+
+            min_candidate_id_ = std::min(min_candidate_id_, handle_id);
+            max_candidate_id_ = std::max(max_candidate_id_, handle_id);
+        }
+    }
+}
+
+void DeadCallAnalyzer::RemoveCandidate(uint64_t call_index, const uint8_t* parameter_buffer, size_t buffer_size)
+{
+    // The destroyed handle is the second parameter, following the device handle.
+    if (buffer_size >= (sizeof(format::HandleEncodeType) * 2))
+    {
+        format::HandleEncodeType handle_id = 0;
+        util::platform::MemoryCopy(&handle_id,
+                                   sizeof(handle_id),
+                                   parameter_buffer + sizeof(format::HandleEncodeType),
+                                   sizeof(handle_id));
+
+        auto entry = candidates_.find(handle_id);
+        if (entry != candidates_.end())
+        {
+            // The object was destroyed without being referenced, so both its creation and destruction can be removed.
+            removable_call_indices_.insert(entry->second.create_call_index);
+            removable_call_indices_.insert(call_index);
+            ++removable_object_count_;
+
+            candidates_.erase(entry);
+        }
+    }
+}
+
+void DeadCallAnalyzer::ProcessQuery(format::ApiCallId call_id,
+                                    uint64_t          call_index,
+                                    const uint8_t*    parameter_buffer,
+                                    size_t            buffer_size)
+{
+    std::string key(reinterpret_cast<const char*>(&call_id), sizeof(call_id));
+    key.append(reinterpret_cast<const char*>(parameter_buffer), buffer_size);
+
+    if (!queries_.insert(std::move(key)).second)
+    {
+        removable_call_indices_.insert(call_index);
+        ++redundant_query_count_;
+    }
+}
+
+void DeadCallAnalyzer::ScanHandleReferences(const uint8_t* parameter_buffer, size_t buffer_size)
+{
+    if (!candidates_.empty() && (buffer_size >= sizeof(format::HandleEncodeType)))
+    {
+        const size_t end = buffer_size - sizeof(format::HandleEncodeType);
+
+        // Handle IDs are not aligned within the parameter data, so every byte offset is checked.
+        for (size_t offset = 0; offset <= end; ++offset)
+        {
+            format::HandleEncodeType value = 0;
+            util::platform::MemoryCopy(&value, sizeof(value), parameter_buffer + offset, sizeof(value));
+
+            if ((value >= min_candidate_id_) && (value <= max_candidate_id_))
+            {
+                MarkUsed(value);
+            }
+        }
+    }
+}
+
+void DeadCallAnalyzer::MarkUsed(format::HandleId handle_id)
+{
+    // Referenced objects are no longer candidates for removal.
+    candidates_.erase(handle_id);
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
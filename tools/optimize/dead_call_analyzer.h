@@ -0,0 +1,201 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DEAD_CALL_ANALYZER_H
+#define GFXRECON_DEAD_CALL_ANALYZER_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Identifies API calls that can be removed from a capture file without changing replay results, by index:
+//  - Object creation and destruction call pairs for objects whose handle ID is not referenced by any other block.
+//  - Physical device queries that repeat an earlier query with identical parameter data.
+//
+// Handle references are detected by scanning the raw parameter data of every function call for the 64-bit handle ID
+// of each live candidate object. The scan is conservative: an unrelated value that matches a handle ID prevents the
+// object's removal, but a handle reference is never missed.
+class DeadCallAnalyzer : public decode::ApiDecoder
+{
+  public:
+    DeadCallAnalyzer();
+
+    virtual ~DeadCallAnalyzer() override {}
+
+    // Retrieve the indices of the API calls that can be removed, matching decode::ApiCallInfo::index.
+    const std::unordered_set<uint64_t>& GetRemovableCallIndices() const { return removable_call_indices_; }
+
+    uint64_t GetRemovableObjectCount() const { return removable_object_count_; }
+
+    uint64_t GetRedundantQueryCount() const { return redundant_query_count_; }
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override { return true; }
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return true; }
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             parameter_buffer,
+                                    size_t                     buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override {}
+
+    virtual void DispatchFillMemoryCommand(format::ThreadId thread_id,
+                                           uint64_t         memory_id,
+                                           uint64_t         offset,
+                                           uint64_t         size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override;
+
+    virtual void DispatchResizeWindowCommand2(format::ThreadId thread_id,
+                                              format::HandleId surface_id,
+                                              uint32_t         width,
+                                              uint32_t         height,
+                                              uint32_t         pre_transform) override;
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override {}
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override
+    {}
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override
+    {}
+
+    virtual void DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId object_id,
+                                                 uint64_t         address) override;
+
+    virtual void DispatchSetRayTracingShaderGroupHandlesCommand(format::ThreadId thread_id,
+                                                                format::HandleId device_id,
+                                                                format::HandleId buffer_id,
+                                                                size_t           data_size,
+                                                                const uint8_t*   data) override;
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override;
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override
+    {}
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override {}
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+  private:
+    bool IsObjectCreateCall(format::ApiCallId call_id) const;
+
+    bool IsObjectDestroyCall(format::ApiCallId call_id) const;
+
+    bool IsPhysicalDeviceQuery(format::ApiCallId call_id) const;
+
+    void AddCandidate(uint64_t call_index, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void RemoveCandidate(uint64_t call_index, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void
+    ProcessQuery(format::ApiCallId call_id, uint64_t call_index, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void ScanHandleReferences(const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void MarkUsed(format::HandleId handle_id);
+
+  private:
+    // Object created by a call that may be removed if the object is destroyed without being referenced.
+    struct CandidateInfo
+    {
+        uint64_t create_call_index{ 0 };
+    };
+
+  private:
+    std::unordered_map<format::HandleId, CandidateInfo> candidates_;
+    format::HandleId                                    min_candidate_id_;
+    format::HandleId                                    max_candidate_id_;
+    std::unordered_set<std::string>                     queries_;
+    std::unordered_set<uint64_t>                        removable_call_indices_;
+    uint64_t                                            removable_object_count_;
+    uint64_t                                            redundant_query_count_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DEAD_CALL_ANALYZER_H
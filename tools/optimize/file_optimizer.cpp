@@ -22,26 +22,85 @@
 
 #include "file_optimizer.h"
 
+#include "blob_analyzer.h"
+
+#include "format/api_call_id.h"
 #include "format/format_util.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
 #include <cassert>
+#include <cstring>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
-FileOptimizer::FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids) :
-    unreferenced_ids_(unreferenced_ids)
+FileOptimizer::FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids,
+                             const std::unordered_set<uint64_t>&         removed_call_indices,
+                             const std::unordered_set<uint64_t>&         repeated_fill_content_ids,
+                             const std::unordered_set<std::string>&      repeated_blob_digests) :
+    unreferenced_ids_(unreferenced_ids), removed_call_indices_(removed_call_indices), api_call_index_(0),
+    fill_api_family_(format::ApiFamily_None), repeated_fill_content_ids_(repeated_fill_content_ids),
+    fill_reference_count_(0), repeated_blob_digests_(repeated_blob_digests), stored_blob_count_(0),
+    blob_reference_count_(0)
 {}
 
-FileOptimizer::FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids) :
-    unreferenced_ids_(std::move(unreferenced_ids))
+FileOptimizer::FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids,
+                             std::unordered_set<uint64_t>&&         removed_call_indices,
+                             std::unordered_set<uint64_t>&&         repeated_fill_content_ids,
+                             std::unordered_set<std::string>&&      repeated_blob_digests) :
+    unreferenced_ids_(std::move(unreferenced_ids)), removed_call_indices_(std::move(removed_call_indices)),
+    api_call_index_(0), fill_api_family_(format::ApiFamily_None),
+    repeated_fill_content_ids_(std::move(repeated_fill_content_ids)), fill_reference_count_(0),
+    repeated_blob_digests_(std::move(repeated_blob_digests)), stored_blob_count_(0), blob_reference_count_(0)
 {}
 
+bool FileOptimizer::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
+{
+    // Pending fills must be written before any call that could access the filled memory.
+    if (!FlushFillMemoryCommands())
+    {
+        return false;
+    }
+
+    // Function call blocks are indexed in file order, matching the decode::ApiCallInfo::index values assigned by the
+    // file processor during analysis.
+    uint64_t call_index = api_call_index_++;
+
+    if (removed_call_indices_.find(call_index) != removed_call_indices_.end())
+    {
+        if (!SkipBytes(block_header.size - sizeof(call_id)))
+        {
+            HandleBlockReadError(kErrorSeekingFile, "Failed to skip function call block data");
+            return false;
+        }
+
+        return true;
+    }
+
+    if ((call_id == format::ApiCallId::ApiCall_vkCreateShaderModule) && !repeated_blob_digests_.empty())
+    {
+        return WriteShaderModuleFunctionCall(block_header, call_id);
+    }
+
+    return FileTransformer::ProcessFunctionCall(block_header, call_id);
+}
+
 bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
-    if (meta_data_type == format::MetaDataType::kInitBufferCommand)
+    if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+    {
+        return ReadFillMemoryMetaData(block_header, meta_data_id);
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryReferenceCommand)
+    {
+        return ReadFillMemoryReferenceMetaData(block_header, meta_data_id);
+    }
+    else if (!FlushFillMemoryCommands())
+    {
+        return false;
+    }
+    else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
         return FilterInitBufferMetaData(block_header, meta_data_id);
     }
@@ -49,6 +108,10 @@ bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, for
     {
         return FilterInitImageMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kStoreBlobCommand)
+    {
+        return CopyStoreBlobMetaData(block_header, meta_data_id);
+    }
     else
     {
         // Copy the meta data block, if it was not filtered.
@@ -56,6 +119,148 @@ bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, for
     }
 }
 
+bool FileOptimizer::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
+{
+    if (!FlushFillMemoryCommands())
+    {
+        return false;
+    }
+
+    return FileTransformer::ProcessStateMarker(block_header, marker_type);
+}
+
+bool FileOptimizer::ProcessBlobReferenceBlock(const format::BlockHeader& block_header,
+                                              format::BlockType          inner_block_type)
+{
+    if (!FlushFillMemoryCommands())
+    {
+        return false;
+    }
+
+    // Function calls restored from blob reference blocks are indexed by the file processor, and can be removed.
+    if (inner_block_type == format::BlockType::kFunctionCallBlock)
+    {
+        uint64_t call_index = api_call_index_++;
+
+        if (removed_call_indices_.find(call_index) != removed_call_indices_.end())
+        {
+            if (!SkipBytes(block_header.size - sizeof(inner_block_type)))
+            {
+                HandleBlockReadError(kErrorSeekingFile, "Failed to skip blob reference block data");
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    return FileTransformer::ProcessBlobReferenceBlock(block_header, inner_block_type);
+}
+
+bool FileOptimizer::ProcessPassThroughBlock(const format::BlockHeader& block_header)
+{
+    // Blocks are written in file order, so pending fills must be written before any block that follows them.
+    if (!FlushFillMemoryCommands())
+    {
+        return false;
+    }
+
+    return FileTransformer::ProcessPassThroughBlock(block_header);
+}
+
+bool FileOptimizer::ProcessEndOfFile()
+{
+    return FlushFillMemoryCommands();
+}
+
+bool FileOptimizer::WriteShaderModuleFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
+{
+    format::ThreadId thread_id         = 0;
+    uint64_t         uncompressed_size = 0;
+    size_t           parameter_size    = 0;
+    size_t           compressed_size   = 0;
+    bool             compressed        = format::IsBlockCompressed(block_header.type);
+    bool             success           = ReadBytes(&thread_id, sizeof(thread_id));
+
+    if (compressed)
+    {
+        success = success && ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+            compressed_size = static_cast<size_t>(block_header.size - sizeof(call_id) - sizeof(thread_id) -
+                                                  sizeof(uncompressed_size));
+            success         = ReadCompressedParameterBuffer(
+                compressed_size, static_cast<size_t>(uncompressed_size), &parameter_size);
+        }
+    }
+    else if (success)
+    {
+        parameter_size = static_cast<size_t>(block_header.size - sizeof(call_id) - sizeof(thread_id));
+        success        = ReadParameterBuffer(parameter_size);
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(compressed ? kErrorReadingCompressedBlockData : kErrorReadingBlockData,
+                             "Failed to read function call block data");
+        return false;
+    }
+
+    const uint8_t* parameter_buffer = GetParameterBuffer().data();
+    size_t         code_offset      = 0;
+    size_t         code_size        = 0;
+    std::string    blob_digest;
+
+    if (BlobAnalyzer::FindShaderCode(parameter_buffer, parameter_size, &code_offset, &code_size) &&
+        IsRepeatedBlob(parameter_buffer + code_offset, code_size, &blob_digest))
+    {
+        // The uncompressed function call block, with the shader code replaced by a blob reference.
+        blob_block_prefix_.resize(sizeof(call_id) + sizeof(thread_id) + code_offset);
+
+        uint8_t* prefix = blob_block_prefix_.data();
+        util::platform::MemoryCopy(prefix, sizeof(call_id), &call_id, sizeof(call_id));
+        util::platform::MemoryCopy(prefix + sizeof(call_id), sizeof(thread_id), &thread_id, sizeof(thread_id));
+        util::platform::MemoryCopy(
+            prefix + sizeof(call_id) + sizeof(thread_id), code_offset, parameter_buffer, code_offset);
+
+        return WriteBlobReferenceBlock(format::BlockType::kFunctionCallBlock,
+                                       format::ApiFamilyId::ApiFamily_Vulkan,
+                                       thread_id,
+                                       blob_digest,
+                                       prefix,
+                                       blob_block_prefix_.size(),
+                                       parameter_buffer + code_offset,
+                                       code_size,
+                                       parameter_buffer + code_offset + code_size,
+                                       parameter_size - (code_offset + code_size));
+    }
+
+    // Write the original block.
+    success = WriteBlockHeader(block_header) && WriteBytes(&call_id, sizeof(call_id)) &&
+              WriteBytes(&thread_id, sizeof(thread_id));
+
+    if (compressed)
+    {
+        success = success && WriteBytes(&uncompressed_size, sizeof(uncompressed_size)) &&
+                  WriteBytes(GetCompressedParameterBuffer().data(), compressed_size);
+    }
+    else
+    {
+        success = success && WriteBytes(parameter_buffer, parameter_size);
+    }
+
+    if (!success)
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block");
+        return false;
+    }
+
+    return true;
+}
+
 bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
     assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitBufferCommand);
@@ -81,6 +286,14 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
                 return false;
             }
         }
+        else if (!repeated_blob_digests_.empty() && (header.data_size >= BlobAnalyzer::kMinBlobSize))
+        {
+            header.meta_header.block_header = block_header;
+            header.meta_header.meta_data_id = meta_data_id;
+
+            return WriteInitDataMetaData(
+                block_header, &header, sizeof(header), 0, header.thread_id, header.data_size);
+        }
         else
         {
             // Copy the block from the input file to the output file.
@@ -139,6 +352,14 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
                 return false;
             }
         }
+        else if (!repeated_blob_digests_.empty() && (header.data_size >= BlobAnalyzer::kMinBlobSize))
+        {
+            header.meta_header.block_header = block_header;
+            header.meta_header.meta_data_id = meta_data_id;
+
+            return WriteInitDataMetaData(
+                block_header, &header, sizeof(header), header.level_count, header.thread_id, header.data_size);
+        }
         else
         {
             // Copy the block from the input file to the output file.
@@ -168,4 +389,430 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
     return true;
 }
 
+bool FileOptimizer::WriteInitDataMetaData(const format::BlockHeader& block_header,
+                                          const void*                header,
+                                          size_t                     header_size,
+                                          uint32_t                   level_count,
+                                          format::ThreadId           thread_id,
+                                          uint64_t                   data_size)
+{
+    assert((header != nullptr) && (header_size >= sizeof(format::MetaDataHeader)));
+
+    // The uncompressed block data consists of the header fields following the block header, the image level sizes,
+    // and the resource data, of which only the resource data is compressed.
+    size_t fields_size = header_size - sizeof(block_header);
+    size_t levels_size = level_count * sizeof(uint64_t);
+
+    blob_block_prefix_.resize(fields_size + levels_size);
+    util::platform::MemoryCopy(blob_block_prefix_.data(),
+                               fields_size,
+                               reinterpret_cast<const uint8_t*>(header) + sizeof(block_header),
+                               fields_size);
+
+    bool success = (levels_size == 0) || ReadBytes(blob_block_prefix_.data() + fields_size, levels_size);
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+    bool   compressed      = format::IsBlockCompressed(block_header.type);
+    size_t compressed_size = static_cast<size_t>(block_header.size - fields_size - levels_size);
+
+    if (success)
+    {
+        if (compressed)
+        {
+            size_t uncompressed_size = 0;
+            success =
+                ReadCompressedParameterBuffer(compressed_size, static_cast<size_t>(data_size), &uncompressed_size);
+        }
+        else
+        {
+            success = ReadParameterBuffer(static_cast<size_t>(data_size));
+        }
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(compressed ? kErrorReadingCompressedBlockData : kErrorReadingBlockData,
+                             "Failed to read resource initialization meta-data block data");
+        return false;
+    }
+
+    const uint8_t* data = GetParameterBuffer().data();
+    std::string    blob_digest;
+
+    if (IsRepeatedBlob(data, static_cast<size_t>(data_size), &blob_digest))
+    {
+        const format::MetaDataHeader* meta_header = reinterpret_cast<const format::MetaDataHeader*>(header);
+
+        return WriteBlobReferenceBlock(format::BlockType::kMetaDataBlock,
+                                       format::GetMetaDataApi(meta_header->meta_data_id),
+                                       thread_id,
+                                       blob_digest,
+                                       blob_block_prefix_.data(),
+                                       blob_block_prefix_.size(),
+                                       data,
+                                       static_cast<size_t>(data_size),
+                                       nullptr,
+                                       0);
+    }
+
+    // Write the original block.
+    success = WriteBytes(header, header_size) &&
+              ((levels_size == 0) || WriteBytes(blob_block_prefix_.data() + fields_size, levels_size));
+
+    if (compressed)
+    {
+        success = success && WriteBytes(GetCompressedParameterBuffer().data(), compressed_size);
+    }
+    else
+    {
+        success = success && WriteBytes(data, static_cast<size_t>(data_size));
+    }
+
+    if (!success)
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write resource initialization meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileOptimizer::CopyStoreBlobMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kStoreBlobCommand);
+
+    format::StoreBlobCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(header.blob_digest, sizeof(header.blob_digest));
+    success      = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read store blob meta-data block header");
+        return false;
+    }
+
+    // Blobs stored by a previously optimized file are referenced by its copied blob reference blocks, and are not
+    // stored again.
+    stored_blob_digests_.emplace(reinterpret_cast<const char*>(header.blob_digest), sizeof(header.blob_digest));
+
+    header.meta_header.block_header = block_header;
+    header.meta_header.meta_data_id = meta_data_id;
+
+    if (!WriteBytes(&header, sizeof(header)))
+    {
+        HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write store blob meta-data block header");
+        return false;
+    }
+
+    if (!CopyBytes(block_header.size - format::GetMetaDataBlockBaseSize(header)))
+    {
+        HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy store blob meta-data block data");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileOptimizer::WriteBlobReferenceBlock(format::BlockType   inner_block_type,
+                                            format::ApiFamilyId api_family,
+                                            format::ThreadId    thread_id,
+                                            const std::string&  blob_digest,
+                                            const uint8_t*      prefix,
+                                            size_t              prefix_size,
+                                            const uint8_t*      blob,
+                                            size_t              blob_size,
+                                            const uint8_t*      suffix,
+                                            size_t              suffix_size)
+{
+    assert(blob_digest.size() == format::kBlobDigestSize);
+
+    format::BlobReference reference;
+    reference.offset = prefix_size;
+    reference.size   = blob_size;
+    util::platform::MemoryCopy(
+        reference.blob_digest, sizeof(reference.blob_digest), blob_digest.data(), blob_digest.size());
+
+    if (stored_blob_digests_.insert(blob_digest).second)
+    {
+        // First occurrence of the blob, which is retained by replay for the blocks that reference it.
+        format::StoreBlobCommandHeader store_header;
+        store_header.meta_header.meta_data_id =
+            format::MakeMetaDataId(api_family, format::MetaDataType::kStoreBlobCommand);
+        store_header.thread_id = thread_id;
+        store_header.data_size = blob_size;
+        util::platform::MemoryCopy(
+            store_header.blob_digest, sizeof(store_header.blob_digest), blob_digest.data(), blob_digest.size());
+
+        if (!WriteMetaDataBlock(&store_header.meta_header, sizeof(store_header), blob, blob_size))
+        {
+            return false;
+        }
+
+        ++stored_blob_count_;
+    }
+    else
+    {
+        ++blob_reference_count_;
+    }
+
+    format::BlobReferenceBlockHeader header;
+    header.block_header.type = format::BlockType::kBlobReferenceBlock;
+    header.block_header.size = (sizeof(header) - sizeof(header.block_header)) + sizeof(reference) + prefix_size +
+                               suffix_size;
+    header.inner_block_type  = inner_block_type;
+    header.inner_block_size  = prefix_size + blob_size + suffix_size;
+    header.reference_count   = 1;
+
+    bool success = WriteBytes(&header, sizeof(header)) && WriteBytes(&reference, sizeof(reference));
+    success      = success && ((prefix_size == 0) || WriteBytes(prefix, prefix_size));
+    success      = success && ((suffix_size == 0) || WriteBytes(suffix, suffix_size));
+
+    if (!success)
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write blob reference block");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileOptimizer::IsRepeatedBlob(const uint8_t* data, size_t size, std::string* blob_digest) const
+{
+    assert(blob_digest != nullptr);
+
+    if (size < BlobAnalyzer::kMinBlobSize)
+    {
+        return false;
+    }
+
+    (*blob_digest) = BlobAnalyzer::GetBlobDigest(data, size);
+
+    return (repeated_blob_digests_.find(*blob_digest) != repeated_blob_digests_.end());
+}
+
+bool FileOptimizer::ReadFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
+
+    format::FillMemoryCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+    success      = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+    success      = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
+
+    if (format::IsBlockCompressed(block_header.type))
+    {
+        size_t uncompressed_size = 0;
+        size_t compressed_size   = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+        success = ReadCompressedParameterBuffer(
+            compressed_size, static_cast<size_t>(header.memory_size), &uncompressed_size);
+    }
+    else
+    {
+        success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(format::IsBlockCompressed(block_header.type) ? kErrorReadingCompressedBlockData
+                                                                          : kErrorReadingBlockData,
+                             "Failed to read fill memory meta-data block");
+        return false;
+    }
+
+    fill_api_family_ = format::GetMetaDataApi(meta_data_id);
+    coalescer_.AddFill(
+        header.thread_id, header.memory_id, header.memory_offset, header.memory_size, GetParameterBuffer().data());
+
+    return true;
+}
+
+bool FileOptimizer::ReadFillMemoryReferenceMetaData(const format::BlockHeader& block_header,
+                                                    format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryReferenceCommand);
+
+    format::FillMemoryReferenceCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+    success      = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+    success      = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+    success      = success && ReadBytes(&header.content_id, sizeof(header.content_id));
+    success      = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory reference meta-data block header");
+        return false;
+    }
+
+    // Content references from a previously optimized file are resolved, so that the fills can be merged and their
+    // content references rebuilt.
+    auto& content = input_fill_content_[header.content_id];
+
+    if (header.data_size > 0)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+            success = ReadCompressedParameterBuffer(
+                compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+        }
+        else
+        {
+            success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+        }
+
+        if (!success)
+        {
+            HandleBlockReadError(format::IsBlockCompressed(block_header.type) ? kErrorReadingCompressedBlockData
+                                                                              : kErrorReadingBlockData,
+                                 "Failed to read fill memory reference meta-data block");
+            return false;
+        }
+
+        const auto& parameter_buffer = GetParameterBuffer();
+        content.assign(parameter_buffer.begin(), parameter_buffer.begin() + static_cast<size_t>(header.data_size));
+    }
+
+    if (content.size() < header.memory_size)
+    {
+        GFXRECON_LOG_WARNING(
+            "Omitting fill memory reference meta-data block with missing content for content ID %" PRIx64,
+            header.content_id);
+        return true;
+    }
+
+    fill_api_family_ = format::GetMetaDataApi(meta_data_id);
+    coalescer_.AddFill(header.thread_id, header.memory_id, header.memory_offset, header.memory_size, content.data());
+
+    return true;
+}
+
+bool FileOptimizer::FlushFillMemoryCommands()
+{
+    if (coalescer_.HasPendingFills())
+    {
+        return coalescer_.Flush(
+            [this](const FillMemoryCoalescer::MergedFill& fill) { return WriteFillMemoryCommand(fill); });
+    }
+
+    return true;
+}
+
+bool FileOptimizer::WriteFillMemoryCommand(const FillMemoryCoalescer::MergedFill& fill)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill.size);
+
+    if ((fill.size >= FillMemoryCoalescer::kMinContentReferenceSize) && !repeated_fill_content_ids_.empty())
+    {
+        uint64_t content_id = FillMemoryCoalescer::GetContentId(fill.data, fill.size);
+
+        if (repeated_fill_content_ids_.find(content_id) != repeated_fill_content_ids_.end())
+        {
+            format::FillMemoryReferenceCommandHeader header;
+            header.meta_header.meta_data_id =
+                format::MakeMetaDataId(fill_api_family_, format::MetaDataType::kFillMemoryReferenceCommand);
+            header.thread_id     = fill.thread_id;
+            header.memory_id     = fill.memory_id;
+            header.memory_offset = fill.offset;
+            header.memory_size   = fill.size;
+            header.content_id    = content_id;
+
+            auto entry = written_fill_content_.find(content_id);
+            if (entry == written_fill_content_.end())
+            {
+                // First write of the content, which is retained by replay for the fills that reference it.
+                written_fill_content_[content_id].assign(fill.data, fill.data + static_cast<size_t>(fill.size));
+
+                header.data_size = fill.size;
+                return WriteMetaDataBlock(&header.meta_header, sizeof(header), fill.data, fill.size);
+            }
+            else if ((entry->second.size() == fill.size) &&
+                     (memcmp(entry->second.data(), fill.data, entry->second.size()) == 0))
+            {
+                ++fill_reference_count_;
+
+                header.data_size = 0;
+                return WriteMetaDataBlock(&header.meta_header, sizeof(header), nullptr, 0);
+            }
+
+            // Content with a hash collision is written as a regular fill.
+        }
+    }
+
+    format::FillMemoryCommandHeader header;
+    header.meta_header.meta_data_id =
+        format::MakeMetaDataId(fill_api_family_, format::MetaDataType::kFillMemoryCommand);
+    header.thread_id     = fill.thread_id;
+    header.memory_id     = fill.memory_id;
+    header.memory_offset = fill.offset;
+    header.memory_size   = fill.size;
+
+    return WriteMetaDataBlock(&header.meta_header, sizeof(header), fill.data, fill.size);
+}
+
+bool FileOptimizer::WriteMetaDataBlock(format::MetaDataHeader* meta_header,
+                                       size_t                  header_size,
+                                       const uint8_t*          data,
+                                       uint64_t                data_size)
+{
+    assert(meta_header != nullptr);
+
+    const uint8_t*    write_data      = data;
+    size_t            write_size      = static_cast<size_t>(data_size);
+    util::Compressor* compressor      = GetCompressor();
+    uint64_t          base_block_size = header_size - sizeof(meta_header->block_header);
+
+    meta_header->block_header.type = format::BlockType::kMetaDataBlock;
+
+    if ((compressor != nullptr) && (write_size > 0))
+    {
+        auto&  compressed_buffer = GetCompressedParameterBuffer();
+        size_t compressed_size   = compressor->Compress(write_size, data, &compressed_buffer, 0);
+
+        if ((compressed_size > 0) && (compressed_size < write_size))
+        {
+            // The header includes the uncompressed size, so only the block type changes to indicate compression.
+            meta_header->block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            write_data                     = compressed_buffer.data();
+            write_size                     = compressed_size;
+        }
+    }
+
+    meta_header->block_header.size = base_block_size + write_size;
+
+    if (!WriteBytes(meta_header, header_size))
+    {
+        HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write meta-data block header");
+        return false;
+    }
+
+    if ((write_size > 0) && !WriteBytes(write_data, write_size))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write meta-data block data");
+        return false;
+    }
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -23,30 +23,119 @@
 #ifndef GFXRECON_FILE_OPTIMIZER_H
 #define GFXRECON_FILE_OPTIMIZER_H
 
+#include "fill_memory_coalescer.h"
+
 #include "decode/file_transformer.h"
 #include "util/defines.h"
 
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
 class FileOptimizer : public decode::FileTransformer
 {
   public:
-    FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids);
+    FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids,
+                  const std::unordered_set<uint64_t>&         removed_call_indices,
+                  const std::unordered_set<uint64_t>&         repeated_fill_content_ids,
+                  const std::unordered_set<std::string>&      repeated_blob_digests);
+
+    FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids,
+                  std::unordered_set<uint64_t>&&         removed_call_indices,
+                  std::unordered_set<uint64_t>&&         repeated_fill_content_ids,
+                  std::unordered_set<std::string>&&      repeated_blob_digests);
+
+    uint64_t GetInputFillCount() const { return coalescer_.GetInputFillCount(); }
+
+    uint64_t GetOutputFillCount() const { return coalescer_.GetOutputFillCount(); }
+
+    uint64_t GetFillReferenceCount() const { return fill_reference_count_; }
+
+    uint64_t GetStoredBlobCount() const { return stored_blob_count_; }
 
-    FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids);
+    uint64_t GetBlobReferenceCount() const { return blob_reference_count_; }
 
   protected:
+    virtual bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id) override;
+
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
+    virtual bool ProcessBlobReferenceBlock(const format::BlockHeader& block_header,
+                                           format::BlockType          inner_block_type) override;
+
+    virtual bool ProcessPassThroughBlock(const format::BlockHeader& block_header) override;
+
+    virtual bool ProcessEndOfFile() override;
+
   private:
+    bool WriteShaderModuleFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
+
     bool FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool FilterInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool WriteInitDataMetaData(const format::BlockHeader& block_header,
+                               const void*                header,
+                               size_t                     header_size,
+                               uint32_t                   level_count,
+                               format::ThreadId           thread_id,
+                               uint64_t                   data_size);
+
+    bool CopyStoreBlobMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool WriteBlobReferenceBlock(format::BlockType   inner_block_type,
+                                 format::ApiFamilyId api_family,
+                                 format::ThreadId    thread_id,
+                                 const std::string&  blob_digest,
+                                 const uint8_t*      prefix,
+                                 size_t              prefix_size,
+                                 const uint8_t*      blob,
+                                 size_t              blob_size,
+                                 const uint8_t*      suffix,
+                                 size_t              suffix_size);
+
+    // Returns true if the data is a blob that is written more than once, and retrieves its digest.
+    bool IsRepeatedBlob(const uint8_t* data, size_t size, std::string* blob_digest) const;
+
+    bool ReadFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool ReadFillMemoryReferenceMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool FlushFillMemoryCommands();
+
+    bool WriteFillMemoryCommand(const FillMemoryCoalescer::MergedFill& fill);
+
+    bool WriteMetaDataBlock(format::MetaDataHeader* meta_header,
+                            size_t                  header_size,
+                            const uint8_t*          data,
+                            uint64_t                data_size);
+
   private:
     std::unordered_set<format::HandleId> unreferenced_ids_;
+    std::unordered_set<uint64_t>         removed_call_indices_; // Indices of function call blocks to omit.
+    uint64_t                             api_call_index_;
+
+    // Consecutive fill memory commands are merged before they are written.  Merged fill content that is written more
+    // than once, as determined by FillMemoryAnalyzer, is written with the first fill and referenced by later fills.
+    FillMemoryCoalescer                                 coalescer_;
+    format::ApiFamilyId                                 fill_api_family_;
+    std::unordered_set<uint64_t>                        repeated_fill_content_ids_;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> written_fill_content_;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> input_fill_content_; // Content referenced by the input file.
+    uint64_t                                            fill_reference_count_;
+
+    // Large shader code and resource initialization data that is written more than once, as determined by
+    // BlobAnalyzer, is stored in the blob table with its first occurrence and referenced by the blocks that contain it.
+    std::unordered_set<std::string> repeated_blob_digests_;
+    std::unordered_set<std::string> stored_blob_digests_;
+    std::vector<uint8_t>            blob_block_prefix_;
+    uint64_t                        stored_blob_count_;
+    uint64_t                        blob_reference_count_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,65 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "fill_memory_analyzer.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+FillMemoryAnalyzer::FillMemoryAnalyzer() : repeated_fill_count_(0) {}
+
+std::unordered_set<uint64_t> FillMemoryAnalyzer::GetRepeatedContentIds() const
+{
+    std::unordered_set<uint64_t> content_ids;
+
+    for (const auto& entry : content_counts_)
+    {
+        if (entry.second > 1)
+        {
+            content_ids.insert(entry.first);
+        }
+    }
+
+    return content_ids;
+}
+
+void FillMemoryAnalyzer::FlushFills()
+{
+    if (coalescer_.HasPendingFills())
+    {
+        coalescer_.Flush([this](const FillMemoryCoalescer::MergedFill& fill) {
+            if (fill.size >= FillMemoryCoalescer::kMinContentReferenceSize)
+            {
+                uint32_t& count = content_counts_[FillMemoryCoalescer::GetContentId(fill.data, fill.size)];
+                if (count > 0)
+                {
+                    ++repeated_fill_count_;
+                }
+
+                ++count;
+            }
+
+            return true;
+        });
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,223 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_FILL_MEMORY_ANALYZER_H
+#define GFXRECON_FILL_MEMORY_ANALYZER_H
+
+#include "fill_memory_coalescer.h"
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Merges fill memory commands in the same way as the file optimizer, and identifies the merged fill content that is
+// written more than once, which the optimizer writes once and references from the later fills.  Any block other than a
+// fill memory command ends the current run of fills.
+class FillMemoryAnalyzer : public decode::ApiDecoder
+{
+  public:
+    FillMemoryAnalyzer();
+
+    virtual ~FillMemoryAnalyzer() override {}
+
+    // Must be called after file processing completes, to process the last run of fills.
+    void Finish() { FlushFills(); }
+
+    // Retrieve the content IDs of merged fills with data that is written more than once.
+    std::unordered_set<uint64_t> GetRepeatedContentIds() const;
+
+    uint64_t GetInputFillCount() const { return coalescer_.GetInputFillCount(); }
+
+    uint64_t GetMergedFillCount() const { return coalescer_.GetOutputFillCount(); }
+
+    uint64_t GetRepeatedFillCount() const { return repeated_fill_count_; }
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override { return true; }
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return true; }
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             parameter_buffer,
+                                    size_t                     buffer_size) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override { FlushFills(); }
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override { FlushFills(); }
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchFillMemoryCommand(format::ThreadId thread_id,
+                                           uint64_t         memory_id,
+                                           uint64_t         offset,
+                                           uint64_t         size,
+                                           const uint8_t*   data) override
+    {
+        coalescer_.AddFill(thread_id, memory_id, offset, size, data);
+    }
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchResizeWindowCommand2(format::ThreadId thread_id,
+                                              format::HandleId surface_id,
+                                              uint32_t         width,
+                                              uint32_t         height,
+                                              uint32_t         pre_transform) override
+    {
+        FlushFills();
+    }
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override
+    {
+        FlushFills();
+    }
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId object_id,
+                                                 uint64_t         address) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchSetRayTracingShaderGroupHandlesCommand(format::ThreadId thread_id,
+                                                                format::HandleId device_id,
+                                                                format::HandleId buffer_id,
+                                                                size_t           data_size,
+                                                                const uint8_t*   data) override
+    {
+        FlushFills();
+    }
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override
+    {
+        FlushFills();
+    }
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override
+    {
+        FlushFills();
+    }
+
+  private:
+    void FlushFills();
+
+  private:
+    FillMemoryCoalescer                    coalescer_;
+    std::unordered_map<uint64_t, uint32_t> content_counts_; // Number of merged fills written with each content ID.
+    uint64_t                               repeated_fill_count_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FILL_MEMORY_ANALYZER_H
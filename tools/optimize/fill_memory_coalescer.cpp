@@ -0,0 +1,198 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "fill_memory_coalescer.h"
+
+#include "util/hash.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+FillMemoryCoalescer::FillMemoryCoalescer() : input_fill_count_(0), output_fill_count_(0) {}
+
+uint64_t FillMemoryCoalescer::GetContentId(const uint8_t* data, uint64_t size)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+    return util::hash::Fnv1a64(data, static_cast<size_t>(size));
+}
+
+void FillMemoryCoalescer::AddFill(
+    format::ThreadId thread_id, format::HandleId memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+    ++input_fill_count_;
+
+    // Empty fills have no effect and are dropped.
+    if (size > 0)
+    {
+        size_t data_offset = pending_data_.size();
+        size_t data_size   = static_cast<size_t>(size);
+
+        pending_data_.resize(data_offset + data_size);
+        util::platform::MemoryCopy(pending_data_.data() + data_offset, data_size, data, data_size);
+
+        pending_fills_.push_back({ thread_id, memory_id, offset, size, data_offset });
+    }
+}
+
+bool FillMemoryCoalescer::Flush(const WriteFunction& write)
+{
+    bool success = true;
+
+    if (!pending_fills_.empty())
+    {
+        // Group the fills by memory object, preserving the order in which the memory objects first appear.
+        std::vector<format::HandleId>                             memory_ids;
+        std::unordered_map<format::HandleId, std::vector<size_t>> memory_fills;
+
+        for (size_t i = 0; i < pending_fills_.size(); ++i)
+        {
+            auto& fill_indices = memory_fills[pending_fills_[i].memory_id];
+            if (fill_indices.empty())
+            {
+                memory_ids.push_back(pending_fills_[i].memory_id);
+            }
+
+            fill_indices.push_back(i);
+        }
+
+        for (auto memory_id : memory_ids)
+        {
+            success = WriteMemoryFills(memory_fills[memory_id], write);
+            if (!success)
+            {
+                break;
+            }
+        }
+
+        pending_fills_.clear();
+        pending_data_.clear();
+    }
+
+    return success;
+}
+
+bool FillMemoryCoalescer::WriteMemoryFills(const std::vector<size_t>& fill_indices, const WriteFunction& write)
+{
+    assert(!fill_indices.empty());
+
+    if (fill_indices.size() == 1)
+    {
+        const PendingFill& fill = pending_fills_[fill_indices[0]];
+
+        ++output_fill_count_;
+        return write(
+            { fill.thread_id, fill.memory_id, fill.offset, fill.size, pending_data_.data() + fill.data_offset });
+    }
+
+    // Combine overlapping and adjacent fills into ranges, visiting the fills in order of offset.
+    sorted_indices_.assign(fill_indices.begin(), fill_indices.end());
+    std::stable_sort(sorted_indices_.begin(), sorted_indices_.end(), [this](size_t lhs, size_t rhs) {
+        return pending_fills_[lhs].offset < pending_fills_[rhs].offset;
+    });
+
+    size_t range_count = 0;
+    for (size_t index : sorted_indices_)
+    {
+        const PendingFill& fill = pending_fills_[index];
+        uint64_t           end  = fill.offset + fill.size;
+
+        if ((range_count > 0) && (fill.offset <= ranges_[range_count - 1].end))
+        {
+            ranges_[range_count - 1].end = std::max(ranges_[range_count - 1].end, end);
+        }
+        else
+        {
+            if (range_count == ranges_.size())
+            {
+                ranges_.emplace_back();
+            }
+
+            ranges_[range_count].begin = fill.offset;
+            ranges_[range_count].end   = end;
+            ranges_[range_count].fills.clear();
+            ++range_count;
+        }
+    }
+
+    // Assign the fills to their ranges in file order, so that later fills are applied after earlier fills.
+    for (size_t index : fill_indices)
+    {
+        const PendingFill& fill = pending_fills_[index];
+
+        auto range = std::upper_bound(
+            ranges_.begin(), ranges_.begin() + range_count, fill.offset, [](uint64_t offset, const FillRange& range) {
+                return offset < range.begin;
+            });
+
+        assert(range != ranges_.begin());
+        (range - 1)->fills.push_back(index);
+    }
+
+    for (size_t i = 0; i < range_count; ++i)
+    {
+        const FillRange&   range     = ranges_[i];
+        const PendingFill& last_fill = pending_fills_[range.fills.back()];
+        MergedFill         merged    = {
+            last_fill.thread_id, last_fill.memory_id, range.begin, range.end - range.begin, nullptr
+        };
+
+        if (range.fills.size() == 1)
+        {
+            merged.data = pending_data_.data() + last_fill.data_offset;
+        }
+        else
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, merged.size);
+            merge_buffer_.resize(static_cast<size_t>(merged.size));
+
+            for (size_t index : range.fills)
+            {
+                const PendingFill& fill        = pending_fills_[index];
+                size_t             copy_offset = static_cast<size_t>(fill.offset - range.begin);
+                size_t             copy_size   = static_cast<size_t>(fill.size);
+
+                util::platform::MemoryCopy(merge_buffer_.data() + copy_offset,
+                                           merge_buffer_.size() - copy_offset,
+                                           pending_data_.data() + fill.data_offset,
+                                           copy_size);
+            }
+
+            merged.data = merge_buffer_.data();
+        }
+
+        ++output_fill_count_;
+        if (!write(merged))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
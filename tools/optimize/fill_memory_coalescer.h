@@ -0,0 +1,115 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_FILL_MEMORY_COALESCER_H
+#define GFXRECON_FILL_MEMORY_COALESCER_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Accumulates a run of consecutive fill memory commands and merges them into the smallest set of fills that produce the
+// same memory contents.  Fills to overlapping or adjacent ranges of the same memory object are combined into a single
+// fill, with data from later fills replacing data from earlier fills where the ranges overlap.
+//
+// Fills may only be merged across blocks that do not access mapped memory, so the pending fills must be flushed before
+// any other block is processed.
+class FillMemoryCoalescer
+{
+  public:
+    // Fills that are smaller than this are always written with their data, as the data is not much larger than a
+    // reference to previously written content.
+    static const uint64_t kMinContentReferenceSize = 256;
+
+    struct MergedFill
+    {
+        format::ThreadId thread_id;
+        format::HandleId memory_id;
+        uint64_t         offset;
+        uint64_t         size;
+        const uint8_t*   data;
+    };
+
+    // Merged fill data is only valid for the duration of the callback.
+    typedef std::function<bool(const MergedFill&)> WriteFunction;
+
+  public:
+    FillMemoryCoalescer();
+
+    static uint64_t GetContentId(const uint8_t* data, uint64_t size);
+
+    bool HasPendingFills() const { return !pending_fills_.empty(); }
+
+    void AddFill(format::ThreadId thread_id,
+                 format::HandleId memory_id,
+                 uint64_t         offset,
+                 uint64_t         size,
+                 const uint8_t*   data);
+
+    // Merges the pending fills and passes each merged fill to the write function.  Merged fills are ordered by the
+    // position of the first fill for their memory object, and then by offset.  Returns false if the write function
+    // returns false.
+    bool Flush(const WriteFunction& write);
+
+    uint64_t GetInputFillCount() const { return input_fill_count_; }
+
+    uint64_t GetOutputFillCount() const { return output_fill_count_; }
+
+  private:
+    struct PendingFill
+    {
+        format::ThreadId thread_id;
+        format::HandleId memory_id;
+        uint64_t         offset;
+        uint64_t         size;
+        size_t           data_offset; // Offset of the fill data in pending_data_.
+    };
+
+    // Union of the ranges of one or more overlapping or adjacent fills.
+    struct FillRange
+    {
+        uint64_t            begin;
+        uint64_t            end;
+        std::vector<size_t> fills; // Indices of the fills contained in the range, in file order.
+    };
+
+  private:
+    bool WriteMemoryFills(const std::vector<size_t>& fill_indices, const WriteFunction& write);
+
+  private:
+    std::vector<PendingFill> pending_fills_;
+    std::vector<uint8_t>     pending_data_;
+    std::vector<uint8_t>     merge_buffer_;
+    std::vector<size_t>      sorted_indices_;
+    std::vector<FillRange>   ranges_;
+    uint64_t                 input_fill_count_;
+    uint64_t                 output_fill_count_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FILL_MEMORY_COALESCER_H
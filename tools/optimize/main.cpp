@@ -21,7 +21,10 @@
 */
 
 #include "project_version.h"
+#include "blob_analyzer.h"
+#include "dead_call_analyzer.h"
 #include "file_optimizer.h"
+#include "fill_memory_analyzer.h"
 
 #include "decode/file_processor.h"
 #include "format/format.h"
@@ -55,7 +58,9 @@ static void PrintUsage(const char* exe_name)
         app_name.replace(0, dir_location + 1, "");
     }
     GFXRECON_WRITE_CONSOLE(
-        "\n%s - Remove unused resource initialization data from trimmed GFXReconstruct capture files.\n",
+        "\n%s - Remove unused resource initialization data and API calls with no observable effect from trimmed "
+        "GFXReconstruct capture files, and merge and deduplicate memory fill, shader code, and resource "
+        "initialization data.\n",
         app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
     GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input-file> <output-file>\n", app_name.c_str());
@@ -117,26 +122,76 @@ static std::string GetVersionString(uint32_t api_version)
 }
 
 void GetUnreferencedResources(const std::string&                              input_filename,
-                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids)
+                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids,
+                              std::unordered_set<uint64_t>*                   removed_call_indices,
+                              std::unordered_set<uint64_t>*                   repeated_fill_content_ids,
+                              uint64_t*                                       removable_fill_count,
+                              std::unordered_set<std::string>*                repeated_blob_digests)
 {
-    assert(unreferenced_ids != nullptr);
+    assert((unreferenced_ids != nullptr) && (removed_call_indices != nullptr) &&
+           (repeated_fill_content_ids != nullptr) && (removable_fill_count != nullptr) &&
+           (repeated_blob_digests != nullptr));
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::VulkanDecoder                    decoder;
         gfxrecon::decode::VulkanReferencedResourceConsumer resref_consumer;
+        gfxrecon::DeadCallAnalyzer                         dead_call_analyzer;
+        gfxrecon::FillMemoryAnalyzer                       fill_memory_analyzer;
+        gfxrecon::BlobAnalyzer                             blob_analyzer;
 
         decoder.AddConsumer(&resref_consumer);
 
         file_processor.AddDecoder(&decoder);
+        file_processor.AddDecoder(&dead_call_analyzer);
+        file_processor.AddDecoder(&fill_memory_analyzer);
+        file_processor.AddDecoder(&blob_analyzer);
         file_processor.ProcessAllFrames();
+        fill_memory_analyzer.Finish();
 
         if ((file_processor.GetCurrentFrameNumber() > 0) &&
             (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
         {
             // Get the list of resources that were included in a command buffer submission during replay.
             resref_consumer.GetReferencedResourceIds(nullptr, unreferenced_ids);
+
+            // Get the list of calls with no observable effect.
+            (*removed_call_indices) = dead_call_analyzer.GetRemovableCallIndices();
+
+            if (!removed_call_indices->empty())
+            {
+                GFXRECON_WRITE_CONSOLE("Found %" PRIu64 " objects that were destroyed without being used and %" PRIu64
+                                       " redundant physical device queries.",
+                                       dead_call_analyzer.GetRemovableObjectCount(),
+                                       dead_call_analyzer.GetRedundantQueryCount());
+            }
+
+            // Get the list of memory fill contents that are written more than once.
+            (*repeated_fill_content_ids) = fill_memory_analyzer.GetRepeatedContentIds();
+            (*removable_fill_count) =
+                (fill_memory_analyzer.GetInputFillCount() - fill_memory_analyzer.GetMergedFillCount()) +
+                fill_memory_analyzer.GetRepeatedFillCount();
+
+            if ((*removable_fill_count) > 0)
+            {
+                GFXRECON_WRITE_CONSOLE("Found %" PRIu64 " memory fills that can be merged and %" PRIu64
+                                       " memory fills that repeat earlier fill data.",
+                                       fill_memory_analyzer.GetInputFillCount() -
+                                           fill_memory_analyzer.GetMergedFillCount(),
+                                       fill_memory_analyzer.GetRepeatedFillCount());
+            }
+
+            // Get the list of shader code and resource initialization data blobs that are written more than once.
+            (*repeated_blob_digests) = blob_analyzer.GetRepeatedBlobDigests();
+
+            if (!repeated_blob_digests->empty())
+            {
+                GFXRECON_WRITE_CONSOLE("Found %" PRIu64 " shader code and resource initialization data blobs totaling "
+                                       "%" PRIu64 " bytes that repeat earlier blob data.",
+                                       blob_analyzer.GetRepeatedBlobCount(),
+                                       blob_analyzer.GetRepeatedBlobBytes());
+            }
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
@@ -155,9 +210,15 @@ void GetUnreferencedResources(const std::string&                              in
 
 void FilterUnreferencedResources(const std::string&                               input_filename,
                                  const std::string&                               output_filename,
-                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
+                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids,
+                                 std::unordered_set<uint64_t>&&                   removed_call_indices,
+                                 std::unordered_set<uint64_t>&&                   repeated_fill_content_ids,
+                                 std::unordered_set<std::string>&&                repeated_blob_digests)
 {
-    gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
+    gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids),
+                                           std::move(removed_call_indices),
+                                           std::move(repeated_fill_content_ids),
+                                           std::move(repeated_blob_digests));
     if (file_processor.Initialize(input_filename, output_filename))
     {
         file_processor.Process();
@@ -170,6 +231,14 @@ void FilterUnreferencedResources(const std::string&
         }
 
         GFXRECON_WRITE_CONSOLE("Resource filtering complete.");
+        GFXRECON_WRITE_CONSOLE("\tMemory fills: %" PRIu64 " merged into %" PRIu64 ", with %" PRIu64
+                               " referencing earlier fill data",
+                               file_processor.GetInputFillCount(),
+                               file_processor.GetOutputFillCount(),
+                               file_processor.GetFillReferenceCount());
+        GFXRECON_WRITE_CONSOLE("\tBlobs: %" PRIu64 " stored, with %" PRIu64 " referencing earlier blob data",
+                               file_processor.GetStoredBlobCount(),
+                               file_processor.GetBlobReferenceCount());
         GFXRECON_WRITE_CONSOLE("\tOriginal file size: %" PRIu64 " bytes", file_processor.GetNumBytesRead());
         GFXRECON_WRITE_CONSOLE("\tOptimized file size: %" PRIu64 " bytes", file_processor.GetNumBytesWritten());
     }
@@ -208,21 +277,38 @@ int main(int argc, const char** argv)
         std::string                     input_filename       = positional_arguments[0];
         std::string                     output_filename      = positional_arguments[1];
 
-        GFXRECON_WRITE_CONSOLE("Scanning %s for unreferenced resources.", input_filename.c_str());
+        GFXRECON_WRITE_CONSOLE("Scanning %s for unreferenced resources and unused API calls.", input_filename.c_str());
         std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
-        GetUnreferencedResources(input_filename, &unreferenced_ids);
+        std::unordered_set<uint64_t>                   removed_call_indices;
+        std::unordered_set<uint64_t>                   repeated_fill_content_ids;
+        uint64_t                                       removable_fill_count = 0;
+        std::unordered_set<std::string>                repeated_blob_digests;
+        GetUnreferencedResources(input_filename,
+                                 &unreferenced_ids,
+                                 &removed_call_indices,
+                                 &repeated_fill_content_ids,
+                                 &removable_fill_count,
+                                 &repeated_blob_digests);
 
-        if (!unreferenced_ids.empty())
+        if (!unreferenced_ids.empty() || !removed_call_indices.empty() || (removable_fill_count > 0) ||
+            !repeated_blob_digests.empty())
         {
-            // Filter unreferenced ids.
+            // Filter unreferenced ids and unused calls, merge memory fills, and deduplicate blobs.
             GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64
-                                   " unused resources.",
-                                   unreferenced_ids.size());
-            FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids));
+                                   " unused resources and %" PRIu64 " unused API calls.",
+                                   unreferenced_ids.size(),
+                                   removed_call_indices.size());
+            FilterUnreferencedResources(input_filename,
+                                        output_filename,
+                                        std::move(unreferenced_ids),
+                                        std::move(removed_call_indices),
+                                        std::move(repeated_fill_content_ids),
+                                        std::move(repeated_blob_digests));
         }
         else
         {
-            GFXRECON_WRITE_CONSOLE("No unused resources detected.  A new file will not be created.",
+            GFXRECON_WRITE_CONSOLE("No unused resources, API calls, or redundant memory fills or blobs detected.  A "
+                                   "new file will not be created.",
                                    input_filename.c_str());
         }
     }
@@ -0,0 +1,263 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+
+#include "fill_memory_coalescer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+using gfxrecon::FillMemoryCoalescer;
+using gfxrecon::format::HandleId;
+
+namespace
+{
+
+struct WrittenFill
+{
+    gfxrecon::format::ThreadId thread_id;
+    HandleId                   memory_id;
+    uint64_t                   offset;
+    std::vector<uint8_t>       data;
+};
+
+std::vector<uint8_t> MakeData(uint64_t size, uint8_t value)
+{
+    return std::vector<uint8_t>(static_cast<size_t>(size), value);
+}
+
+std::vector<WrittenFill> FlushFills(FillMemoryCoalescer* coalescer)
+{
+    std::vector<WrittenFill> written;
+
+    bool success = coalescer->Flush([&written](const FillMemoryCoalescer::MergedFill& fill) {
+        written.push_back(
+            { fill.thread_id, fill.memory_id, fill.offset, std::vector<uint8_t>(fill.data, fill.data + fill.size) });
+        return true;
+    });
+
+    REQUIRE(success);
+    REQUIRE(!coalescer->HasPendingFills());
+
+    return written;
+}
+
+// Memory contents, with -1 for bytes that were never written.
+typedef std::map<HandleId, std::vector<int>> MemoryContents;
+
+void ApplyFill(MemoryContents* memory, HandleId memory_id, uint64_t offset, const uint8_t* data, uint64_t size)
+{
+    auto& contents = (*memory)[memory_id];
+    if (contents.size() < (offset + size))
+    {
+        contents.resize(static_cast<size_t>(offset + size), -1);
+    }
+
+    for (uint64_t i = 0; i < size; ++i)
+    {
+        contents[static_cast<size_t>(offset + i)] = data[i];
+    }
+}
+
+// Removes the unwritten bytes at the end of each memory object, which are added for fills with a size of 0.
+void TrimContents(MemoryContents* memory)
+{
+    for (auto iter = memory->begin(); iter != memory->end();)
+    {
+        auto& contents = iter->second;
+        while (!contents.empty() && (contents.back() == -1))
+        {
+            contents.pop_back();
+        }
+
+        iter = contents.empty() ? memory->erase(iter) : std::next(iter);
+    }
+}
+
+} // namespace
+
+TEST_CASE("FillMemoryCoalescer writes a single fill unchanged", "[fill_memory_coalescer]")
+{
+    FillMemoryCoalescer coalescer;
+    auto                data = MakeData(16, 1);
+
+    REQUIRE(!coalescer.HasPendingFills());
+
+    coalescer.AddFill(3, 100, 32, data.size(), data.data());
+    REQUIRE(coalescer.HasPendingFills());
+
+    auto written = FlushFills(&coalescer);
+
+    REQUIRE(written.size() == 1);
+    REQUIRE(written[0].thread_id == 3);
+    REQUIRE(written[0].memory_id == 100);
+    REQUIRE(written[0].offset == 32);
+    REQUIRE(written[0].data == data);
+
+    REQUIRE(coalescer.GetInputFillCount() == 1);
+    REQUIRE(coalescer.GetOutputFillCount() == 1);
+}
+
+TEST_CASE("FillMemoryCoalescer merges overlapping and adjacent fills", "[fill_memory_coalescer]")
+{
+    FillMemoryCoalescer coalescer;
+    auto                first  = MakeData(16, 1);
+    auto                second = MakeData(16, 2);
+    auto                third  = MakeData(8, 3);
+    auto                fourth = MakeData(4, 4);
+
+    // [0, 16) and [8, 24) overlap, [24, 32) is adjacent, and [4, 8) is contained in the first fill.  The later fills
+    // replace the earlier fills where they overlap, including the contained fill that has the lowest offset.
+    coalescer.AddFill(1, 100, 0, first.size(), first.data());
+    coalescer.AddFill(1, 100, 8, second.size(), second.data());
+    coalescer.AddFill(1, 100, 24, third.size(), third.data());
+    coalescer.AddFill(2, 100, 4, fourth.size(), fourth.data());
+
+    auto written = FlushFills(&coalescer);
+
+    std::vector<uint8_t> expected(32);
+    std::fill(expected.begin(), expected.begin() + 8, 1);
+    std::fill(expected.begin() + 8, expected.begin() + 24, 2);
+    std::fill(expected.begin() + 24, expected.end(), 3);
+    std::fill(expected.begin() + 4, expected.begin() + 8, 4);
+
+    REQUIRE(written.size() == 1);
+    REQUIRE(written[0].memory_id == 100);
+    REQUIRE(written[0].offset == 0);
+    REQUIRE(written[0].data == expected);
+
+    // The merged fill takes the thread ID of the last fill.
+    REQUIRE(written[0].thread_id == 2);
+
+    REQUIRE(coalescer.GetInputFillCount() == 4);
+    REQUIRE(coalescer.GetOutputFillCount() == 1);
+}
+
+TEST_CASE("FillMemoryCoalescer keeps disjoint fills and memory objects separate", "[fill_memory_coalescer]")
+{
+    FillMemoryCoalescer coalescer;
+    auto                data = MakeData(8, 5);
+
+    coalescer.AddFill(1, 200, 64, data.size(), data.data());
+    coalescer.AddFill(1, 100, 0, data.size(), data.data());
+    coalescer.AddFill(1, 200, 0, data.size(), data.data());
+    coalescer.AddFill(1, 100, 9, data.size(), data.data());
+
+    // Empty fills are dropped.
+    coalescer.AddFill(1, 300, 0, 0, data.data());
+
+    auto written = FlushFills(&coalescer);
+
+    // Ordered by first appearance of the memory object, then by offset.
+    REQUIRE(written.size() == 4);
+    REQUIRE(((written[0].memory_id == 200) && (written[0].offset == 0)));
+    REQUIRE(((written[1].memory_id == 200) && (written[1].offset == 64)));
+    REQUIRE(((written[2].memory_id == 100) && (written[2].offset == 0)));
+    REQUIRE(((written[3].memory_id == 100) && (written[3].offset == 9)));
+
+    REQUIRE(coalescer.GetInputFillCount() == 5);
+    REQUIRE(coalescer.GetOutputFillCount() == 4);
+}
+
+TEST_CASE("FillMemoryCoalescer stops flushing when a write fails", "[fill_memory_coalescer]")
+{
+    FillMemoryCoalescer coalescer;
+    auto                data = MakeData(8, 6);
+
+    coalescer.AddFill(1, 100, 0, data.size(), data.data());
+    coalescer.AddFill(1, 200, 0, data.size(), data.data());
+
+    size_t write_count = 0;
+    bool   success     = coalescer.Flush([&write_count](const FillMemoryCoalescer::MergedFill&) {
+        ++write_count;
+        return false;
+    });
+
+    REQUIRE(!success);
+    REQUIRE(write_count == 1);
+
+    // The pending fills are discarded.
+    REQUIRE(!coalescer.HasPendingFills());
+}
+
+TEST_CASE("FillMemoryCoalescer produces the same memory contents as the original fills", "[fill_memory_coalescer]")
+{
+    const uint32_t kSeedCount   = 50;
+    const uint64_t kMemorySize  = 256;
+    const HandleId kMemoryCount = 3;
+
+    for (uint32_t seed = 0; seed < kSeedCount; ++seed)
+    {
+        std::mt19937        random(seed);
+        FillMemoryCoalescer coalescer;
+        MemoryContents      expected;
+        MemoryContents      actual;
+
+        uint32_t fill_count = 1 + (random() % 40);
+
+        for (uint32_t i = 0; i < fill_count; ++i)
+        {
+            HandleId memory_id = 1 + (random() % kMemoryCount);
+            uint64_t offset    = random() % kMemorySize;
+            uint64_t size      = random() % (kMemorySize - offset);
+
+            std::vector<uint8_t> data(static_cast<size_t>(size));
+            for (auto& value : data)
+            {
+                value = static_cast<uint8_t>(random());
+            }
+
+            coalescer.AddFill(1, memory_id, offset, size, data.data());
+            ApplyFill(&expected, memory_id, offset, data.data(), size);
+        }
+
+        auto written = FlushFills(&coalescer);
+
+        std::map<HandleId, uint64_t> previous_end;
+
+        for (const auto& fill : written)
+        {
+            // Merged fills for a memory object are sorted, and neither overlap nor touch.
+            auto end = previous_end.find(fill.memory_id);
+            if (end != previous_end.end())
+            {
+                REQUIRE(fill.offset > end->second);
+            }
+
+            previous_end[fill.memory_id] = fill.offset + fill.data.size();
+
+            ApplyFill(&actual, fill.memory_id, fill.offset, fill.data.data(), fill.data.size());
+        }
+
+        TrimContents(&expected);
+        TrimContents(&actual);
+
+        INFO("seed " << seed);
+        REQUIRE(actual == expected);
+        REQUIRE(coalescer.GetInputFillCount() == fill_count);
+        REQUIRE(coalescer.GetOutputFillCount() == written.size());
+    }
+}
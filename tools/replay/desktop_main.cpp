@@ -24,6 +24,7 @@
 #include "replay_settings.h"
 
 #include "application/application.h"
+#include "decode/api_call_profiler.h"
 #include "decode/file_processor.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
@@ -112,7 +113,9 @@ int main(int argc, const char** argv)
             auto        application =
                 std::make_shared<gfxrecon::application::Application>(kApplicationName, wsi_extension, &file_processor);
 
-            gfxrecon::graphics::FpsInfo                    fps_info;
+            const std::string& frame_statistics_file = arg_parser.GetArgumentValue(kFrameStatisticsArgument);
+
+            gfxrecon::graphics::FpsInfo                    fps_info(!frame_statistics_file.empty());
             gfxrecon::decode::VulkanTrackedObjectInfoTable tracked_object_info_table;
             gfxrecon::decode::VulkanReplayConsumer         replay_consumer(
                 application, GetVulkanReplayOptions(arg_parser, filename, &tracked_object_info_table));
@@ -121,10 +124,38 @@ int main(int argc, const char** argv)
             replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
             replay_consumer.SetFpsInfo(&fps_info);
 
+            std::unique_ptr<gfxrecon::decode::ApiCallProfiler> profiler;
+
+            const std::string& profile_trace_file = arg_parser.GetArgumentValue(kProfileTraceArgument);
+            if (arg_parser.IsOptionSet(kProfileOption) || !profile_trace_file.empty())
+            {
+                profiler = std::make_unique<gfxrecon::decode::ApiCallProfiler>(!profile_trace_file.empty());
+                file_processor.SetApiCallProfiler(profiler.get());
+                replay_consumer.SetApiCallProfiler(profiler.get());
+            }
+
             decoder.AddConsumer(&replay_consumer);
             file_processor.AddDecoder(&decoder);
             application->SetPauseFrame(GetPauseFrame(arg_parser));
 
+            uint32_t loop_first_frame = 0;
+            uint32_t loop_last_frame  = 0;
+            uint32_t loop_count       = 0;
+            if (GetLoopFrames(arg_parser, &loop_first_frame, &loop_last_frame, &loop_count))
+            {
+                file_processor.SetLoopFrames(loop_first_frame, loop_last_frame, loop_count);
+                file_processor.SetLoopCheckHandlers(
+                    [&replay_consumer]() { replay_consumer.BeginLoopRangeObjectCheck(); },
+                    [&replay_consumer]() { return replay_consumer.EndLoopRangeObjectCheck(); });
+            }
+
+            uint32_t preload_first_frame = 0;
+            uint32_t preload_last_frame  = 0;
+            if (GetPreloadFrames(arg_parser, &preload_first_frame, &preload_last_frame))
+            {
+                file_processor.SetPreloadFrames(preload_first_frame, preload_last_frame);
+            }
+
             // Warn if the capture layer is active.
             CheckActiveLayers(gfxrecon::util::platform::GetEnv(kLayerEnvVar));
 
@@ -135,7 +166,25 @@ int main(int argc, const char** argv)
             if ((file_processor.GetCurrentFrameNumber() > 0) &&
                 (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
             {
+                fps_info.SetLoopIterations((loop_last_frame - loop_first_frame) + 1,
+                                           file_processor.GetLoopIterationTimes());
+                fps_info.SetPreloadTime(file_processor.GetPreloadStartTime(), file_processor.GetPreloadEndTime());
                 fps_info.EndAndLog(file_processor.GetCurrentFrameNumber());
+
+                if (!frame_statistics_file.empty())
+                {
+                    fps_info.WriteFrameStatistics(frame_statistics_file);
+                }
+
+                if (profiler)
+                {
+                    profiler->WriteSummary();
+
+                    if (!profile_trace_file.empty())
+                    {
+                        profiler->WriteTraceFile(profile_trace_file);
+                    }
+                }
             }
             else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
             {
@@ -28,10 +28,12 @@
 const char kOptions[] =
     "-h|--help,--version,--log-debugview,--no-debug-popup,--paused,--sync,--sfa|--skip-failed-allocations,--"
     "opcd|--omit-pipeline-cache-data,--remove-unsupported,--validate,--debug-device-lost,--create-dummy-allocations,--"
-    "screenshot-all,--dcp,--discard-cached-psos";
+    "screenshot-all,--screenshot-async,--dcp,--discard-cached-psos,--profile,--pool-memory,--"
+    "async-pipelines";
 const char kArguments[] = "--log-level,--log-file,--gpu,--pause-frame,--wsi,--surface-index,-m|--memory-translation,--"
                           "replace-shaders,--screenshots,--denied-messages,--allowed-messages,--screenshot-format,--"
-                          "screenshot-dir,--screenshot-prefix";
+                          "screenshot-dir,--screenshot-prefix,--profile-trace,--frame-stats,--loop-frames,--"
+                          "loop-count,--preload";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -49,11 +51,15 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pause-frame <N>] [--paused] [--sync] [--screenshot-all]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshots <N1(-N2),...>] [--screenshot-format <format>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-dir <dir>] [--screenshot-prefix <file-prefix>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-async]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sfa | --skip-failed-allocations] [--replace-shaders <dir>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--opcd | --omit-pipeline-cache-data] [--wsi <platform>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dcp | --discard-cached-psos] [--surface-index <N>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--remove-unsupported] [--validate]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[-m <mode> | --memory-translation <mode>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--profile] [--profile-trace <file>] [--frame-stats <file>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--loop-frames <N1-N2>] [--loop-count <N>] [--preload <N1-N2>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[-m <mode> | --memory-translation <mode>] [--pool-memory]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--async-pipelines]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-debugview]");
 #if defined(_DEBUG)
@@ -103,6 +109,15 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tAvailable formats are:");
     GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tBitmap file format.  This is the default format.",
                            kScreenshotFormatBmp);
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tPortable Network Graphics file format, using fast",
+                           kScreenshotFormatPng);
+    GFXRECON_WRITE_CONSOLE("          \t\t      \t\tzlib compression.  Requires zlib support.");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tQuite OK Image file format, a fast lossless format.",
+                           kScreenshotFormatQoi);
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tNo image files are written.  An exact hash and a",
+                           kScreenshotFormatHash);
+    GFXRECON_WRITE_CONSOLE("          \t\t      \t\tperceptual hash of each image are written to the");
+    GFXRECON_WRITE_CONSOLE("          \t\t      \t\tfile <file-prefix>_hashes.csv.");
     GFXRECON_WRITE_CONSOLE("  --screenshot-dir <dir>");
     GFXRECON_WRITE_CONSOLE("          \t\tDirectory to write screenshots.  Default is the current");
     GFXRECON_WRITE_CONSOLE("          \t\tworking directory.");
@@ -110,13 +125,18 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tPrefix to apply to the screenshot file name.  Default is ");
     GFXRECON_WRITE_CONSOLE("          \t\t\"screenshot\", producing file names similar to");
     GFXRECON_WRITE_CONSOLE("          \t\t\"screenshot_frame_8049.bmp\".");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-async");
+    GFXRECON_WRITE_CONSOLE("          \t\tGenerate screenshots without waiting for the device to");
+    GFXRECON_WRITE_CONSOLE("          \t\tbecome idle.  Image copies are completed in the");
+    GFXRECON_WRITE_CONSOLE("          \t\tbackground and image files are written by worker");
+    GFXRECON_WRITE_CONSOLE("          \t\tthreads, overlapping with the replay of later frames.");
     GFXRECON_WRITE_CONSOLE("  --sfa\t\t\tSkip vkAllocateMemory, vkAllocateCommandBuffers, and");
     GFXRECON_WRITE_CONSOLE("       \t\t\tvkAllocateDescriptorSets calls that failed during");
     GFXRECON_WRITE_CONSOLE("       \t\t\tcapture (same as --skip-failed-allocations).");
     GFXRECON_WRITE_CONSOLE("  --replace-shaders <dir> Replace the shader code in each CreateShaderModule");
-    GFXRECON_WRITE_CONSOLE("       \t\t\twith the contents of the file <dir>/sh<handle_id> if found, where");
-    GFXRECON_WRITE_CONSOLE("       \t\t\t<handle_id> is the handle id of the CreateShaderModule call.");
-    GFXRECON_WRITE_CONSOLE("       \t\t\tSee gfxrecon-extract.");
+    GFXRECON_WRITE_CONSOLE("       \t\t\twith the contents of the file that the <dir>/shaders.manifest");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tfile lists for the handle id of the CreateShaderModule call,");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tif found.  See gfxrecon-extract.");
     GFXRECON_WRITE_CONSOLE("  --opcd\t\tOmit pipeline cache data from calls to");
     GFXRECON_WRITE_CONSOLE("        \t\tvkCreatePipelineCache and skip calls to");
     GFXRECON_WRITE_CONSOLE("        \t\tvkGetPipelineCacheData (same as");
@@ -130,6 +150,31 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --remove-unsupported\tRemove unsupported extensions and features from instance");
     GFXRECON_WRITE_CONSOLE("                      \tand device creation parameters.");
     GFXRECON_WRITE_CONSOLE("  --validate\t\tEnables the Khronos Vulkan validation layer.");
+    GFXRECON_WRITE_CONSOLE("  --profile\t\tMeasure the number of calls and the time spent decoding,");
+    GFXRECON_WRITE_CONSOLE("          \t\tmapping handles, and calling the driver for each API");
+    GFXRECON_WRITE_CONSOLE("          \t\tcall, and print a table sorted by total time at exit.");
+    GFXRECON_WRITE_CONSOLE("  --profile-trace <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite a timeline of the profiled API calls to <file> in");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe Chrome trace event JSON format at exit.  Implies");
+    GFXRECON_WRITE_CONSOLE("          \t\t--profile.");
+    GFXRECON_WRITE_CONSOLE("  --frame-stats <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRecord the frame time, CPU time, and the time spent");
+    GFXRECON_WRITE_CONSOLE("          \t\tdecoding, calling the driver, and waiting for the GPU");
+    GFXRECON_WRITE_CONSOLE("          \t\tfor each frame.  Percentiles are printed at exit and the");
+    GFXRECON_WRITE_CONSOLE("          \t\tper-frame times are written to <file>, in JSON format if");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe file name ends with .json and CSV format otherwise.");
+    GFXRECON_WRITE_CONSOLE("  --loop-frames <N1-N2>");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplay the frames from N1 to N2 repeatedly, as specified");
+    GFXRECON_WRITE_CONSOLE("          \t\tby --loop-count, reusing the objects created by the");
+    GFXRECON_WRITE_CONSOLE("          \t\tpreceding frames, and print the time of each iteration.");
+    GFXRECON_WRITE_CONSOLE("          \t\tThe range must destroy the objects that it creates; if");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe first iteration leaves objects alive, a warning is");
+    GFXRECON_WRITE_CONSOLE("          \t\tlogged and the range is not replayed again.");
+    GFXRECON_WRITE_CONSOLE("  --loop-count <N>\tNumber of times to replay the --loop-frames range.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is 1.");
+    GFXRECON_WRITE_CONSOLE("  --preload <N1-N2>\tRead and decompress the frames from N1 to N2 into memory");
+    GFXRECON_WRITE_CONSOLE("          \t\twhen replay reaches frame N1, and replay them without");
+    GFXRECON_WRITE_CONSOLE("          \t\tfile I/O.  Preload time is excluded from the replay FPS.");
     GFXRECON_WRITE_CONSOLE("  -m <mode>\t\tEnable memory translation for replay on GPUs with memory");
     GFXRECON_WRITE_CONSOLE("          \t\ttypes that are not compatible with the capture GPU's");
     GFXRECON_WRITE_CONSOLE("          \t\tmemory types.  Available modes are:");
@@ -147,6 +192,19 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\t         \tto different allocations with different");
     GFXRECON_WRITE_CONSOLE("          \t\t         \toffsets.  Uses VMA to manage allocations");
     GFXRECON_WRITE_CONSOLE("          \t\t         \tand suballocations.");
+    GFXRECON_WRITE_CONSOLE("  --pool-memory\t\tSuballocate memory allocations from larger allocations");
+    GFXRECON_WRITE_CONSOLE("          \t\tper memory type, preserving capture binding offsets,");
+    GFXRECON_WRITE_CONSOLE("          \t\tto reduce the number of driver allocations.  Applies to");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe %s, %s, and %s memory translation modes.",
+                           kMemoryTranslationNone,
+                           kMemoryTranslationRemap,
+                           kMemoryTranslationRealign);
+    GFXRECON_WRITE_CONSOLE("          \t\tPooling is disabled when a sparse resource is created.");
+    GFXRECON_WRITE_CONSOLE("  --async-pipelines\tCreate graphics and compute pipelines on worker threads,");
+    GFXRECON_WRITE_CONSOLE("          \t\tallowing replay to continue until a created pipeline is");
+    GFXRECON_WRITE_CONSOLE("          \t\tfirst used.  Shader modules, pipeline layouts, render");
+    GFXRECON_WRITE_CONSOLE("          \t\tpasses, and pipeline caches are not destroyed until");
+    GFXRECON_WRITE_CONSOLE("          \t\tpending pipeline creation has completed.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("  --api <api>\t\tUse the specified API for replay (Windows only).");
     GFXRECON_WRITE_CONSOLE("          \t\tAvailable values are:");
@@ -24,13 +24,48 @@
 #include "project_version.h"
 
 #include "tool_settings.h"
+#include "decode/decode_allocator.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_ascii_consumer.h"
+#include "generated/generated_vulkan_export_consumer.h"
+#include "util/file_path.h"
 #include "util/platform.h"
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <thread>
+#include <vector>
 
-const char kArguments[] = "--output";
+const char kJobsArgument[]      = "--jobs";
+const char kSplitFramesOption[] = "--split-frames";
+const char kFormatArgument[]    = "--format";
+
+const char kFormatJson[]     = "json";
+const char kFormatColumnar[] = "columnar";
+
+const char kOptions[] = "-h|--help,--version,--no-debug-popup,--split-frames";
+
+const char kArguments[] = "--output,--jobs,--format";
+
+// Upper limit for the number of worker threads requested with --jobs.
+const uint32_t kMaxJobCount = 256;
+
+// Number of shards created per worker thread, so that threads that finish early can pick up remaining work.
+const size_t kShardsPerJob = 4;
+
+// Size of the buffer used to copy the per-shard temporary output to the output file.
+const size_t kCopyBufferSize = 64 * 1024;
+
+// A contiguous range of frames that is converted by a single worker thread.
+struct FrameShard
+{
+    size_t first_frame{ 0 };   // Index of the first frame of the shard in the frame index.
+    size_t frame_count{ 0 };   // Number of frames in the shard.
+    FILE*  output{ nullptr };  // Temporary file receiving the shard's JSON fragment when not splitting frames.
+    bool   success{ false };
+};
 
 static void PrintUsage(const char* exe_name)
 {
@@ -42,7 +77,9 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to convert GFXReconstruct capture files to text.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--output file] [--format <format>]"
+                           " [--jobs <N>] [--split-frames] <file>\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tPath to the GFXReconstruct capture file to be converted");
     GFXRECON_WRITE_CONSOLE("        \t\tto text.");
@@ -50,7 +87,21 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
     GFXRECON_WRITE_CONSOLE("  --output file\t\t'stdout' or a path to a file to write JSON output");
-    GFXRECON_WRITE_CONSOLE("        \t\tto. Default is the input filepath with \"gfxr\" replaced by \"txt\".");
+    GFXRECON_WRITE_CONSOLE("        \t\tto. Default is the input filepath with \"gfxr\" replaced by \"txt\"");
+    GFXRECON_WRITE_CONSOLE("        \t\tfor JSON output, or by \"cols\" for columnar output.");
+    GFXRECON_WRITE_CONSOLE("  --format <format>\tOutput format. Available formats are:");
+    GFXRECON_WRITE_CONSOLE("        \t\t  %s\tJSON text with all decoded parameters (default).", kFormatJson);
+    GFXRECON_WRITE_CONSOLE("        \t\t  %s\tBinary columnar table with one row per API call,", kFormatColumnar);
+    GFXRECON_WRITE_CONSOLE("        \t\t        \tholding the call index, thread ID, API call ID,");
+    GFXRECON_WRITE_CONSOLE("        \t\t        \treturn value, key handle IDs, and parameter sizes.");
+    GFXRECON_WRITE_CONSOLE("        \t\t        \tThe --jobs and --split-frames options do not");
+    GFXRECON_WRITE_CONSOLE("        \t\t        \tapply to this format.");
+    GFXRECON_WRITE_CONSOLE("  --jobs <N>\t\tConvert the file with N threads, each processing a separate");
+    GFXRECON_WRITE_CONSOLE("        \t\trange of frames. The output is identical to single threaded");
+    GFXRECON_WRITE_CONSOLE("        \t\tconversion. N must be at least 1, and values larger than");
+    GFXRECON_WRITE_CONSOLE("        \t\t%u are clamped to %u. Default is 1.", kMaxJobCount, kMaxJobCount);
+    GFXRECON_WRITE_CONSOLE("  --split-frames\tWrite the JSON for each frame to a separate file, named");
+    GFXRECON_WRITE_CONSOLE("        \t\tby appending \"_frame_<N>\" to the output filename.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -58,7 +109,8 @@ static void PrintUsage(const char* exe_name)
 }
 
 static std::string GetOutputFileName(const gfxrecon::util::ArgumentParser& arg_parser,
-                                     const std::string&                    input_filename)
+                                     const std::string&                    input_filename,
+                                     bool                                  columnar)
 {
     std::string output_filename;
     if (arg_parser.IsArgumentSet(kOutput))
@@ -73,11 +125,315 @@ static std::string GetOutputFileName(const gfxrecon::util::ArgumentParser& arg_p
         {
             output_filename = output_filename.substr(0, suffix_pos);
         }
-        output_filename += ".txt";
+        output_filename += columnar ? ".cols" : ".txt";
     }
     return output_filename;
 }
 
+static bool GetJobCount(const gfxrecon::util::ArgumentParser& arg_parser, uint32_t* job_count)
+{
+    const auto& value = arg_parser.GetArgumentValue(kJobsArgument);
+
+    *job_count = 1;
+
+    if (arg_parser.IsArgumentSet(kJobsArgument))
+    {
+        char*         end    = nullptr;
+        unsigned long parsed = 0;
+
+        errno = 0;
+        if (!value.empty() && (value.find_first_not_of("0123456789") == std::string::npos))
+        {
+            parsed = std::strtoul(value.c_str(), &end, 10);
+        }
+
+        if ((end == nullptr) || (*end != '\0') || (parsed == 0))
+        {
+            GFXRECON_LOG_ERROR("Invalid value \"%s\" given for argument \"--jobs\"; must be a positive integer",
+                               value.c_str());
+            return false;
+        }
+
+        if ((errno == ERANGE) || (parsed > kMaxJobCount))
+        {
+            GFXRECON_LOG_WARNING("Value \"%s\" given for argument \"--jobs\" is too large; using %u jobs",
+                                 value.c_str(),
+                                 kMaxJobCount);
+            parsed = kMaxJobCount;
+        }
+
+        *job_count = static_cast<uint32_t>(parsed);
+    }
+
+    return true;
+}
+
+static uint64_t GetFileSize(const std::string& filename)
+{
+    uint64_t file_size = 0;
+    FILE*    file      = nullptr;
+
+    if ((gfxrecon::util::platform::FileOpen(&file, filename.c_str(), "rb") == 0) && (file != nullptr))
+    {
+        if (gfxrecon::util::platform::FileSeek(file, 0, gfxrecon::util::platform::FileSeekEnd))
+        {
+            file_size = static_cast<uint64_t>(gfxrecon::util::platform::FileTell(file));
+        }
+
+        gfxrecon::util::platform::FileClose(file);
+    }
+
+    return file_size;
+}
+
+static std::string GetFrameFileName(const std::string& output_filename, uint32_t frame_number)
+{
+    return gfxrecon::util::filepath::InsertFilenamePostfix(output_filename, "_frame_" + std::to_string(frame_number));
+}
+
+// Splits the frame index into contiguous shards of approximately equal size in bytes.
+static std::vector<FrameShard> CreateShards(const std::vector<gfxrecon::decode::FileProcessor::FramePosition>& frames,
+                                            uint64_t file_size,
+                                            size_t   shard_count)
+{
+    std::vector<FrameShard> shards;
+
+    if (!frames.empty())
+    {
+        // Guard against a file size that could not be determined.
+        file_size = std::max(file_size, frames.back().file_offset + 1);
+
+        uint64_t total_size  = file_size - frames.front().file_offset;
+        uint64_t target_size = std::max<uint64_t>(total_size / std::max<size_t>(shard_count, 1), 1);
+        size_t   first_frame = 0;
+
+        for (size_t i = 1; i <= frames.size(); ++i)
+        {
+            uint64_t end_offset = (i < frames.size()) ? frames[i].file_offset : file_size;
+
+            if ((i == frames.size()) || ((end_offset - frames[first_frame].file_offset) >= target_size))
+            {
+                FrameShard shard;
+                shard.first_frame = first_frame;
+                shard.frame_count = i - first_frame;
+                shards.push_back(shard);
+
+                first_frame = i;
+            }
+        }
+    }
+
+    return shards;
+}
+
+static void ConvertShard(const std::string&                                                input_filename,
+                         const std::string&                                                output_filename,
+                         const std::vector<gfxrecon::decode::FileProcessor::FramePosition>& frames,
+                         const std::vector<uint64_t>&                                      retained_data_offsets,
+                         bool                                                              split_frames,
+                         FrameShard*                                                       shard)
+{
+    // Each shard uses its own file processor, decoder, and consumer, which are not shared between threads.  Data from
+    // the blocks preceding the shard that is referenced by later blocks is loaded when seeking to the first frame.
+    gfxrecon::decode::FileProcessor file_processor;
+
+    if (file_processor.Initialize(input_filename) &&
+        file_processor.SeekToFrame(frames[shard->first_frame], retained_data_offsets))
+    {
+        gfxrecon::decode::VulkanAsciiConsumer ascii_consumer;
+        gfxrecon::decode::VulkanDecoder       decoder;
+        decoder.AddConsumer(&ascii_consumer);
+        file_processor.AddDecoder(&decoder);
+
+        bool success = true;
+
+        if (split_frames)
+        {
+            for (size_t i = 0; (i < shard->frame_count) && success; ++i)
+            {
+                uint32_t    frame_number   = frames[shard->first_frame + i].frame_number;
+                std::string frame_filename = GetFrameFileName(output_filename, frame_number);
+                FILE*       frame_file     = nullptr;
+
+                gfxrecon::util::platform::FileOpen(&frame_file, frame_filename.c_str(), "w");
+
+                if (frame_file != nullptr)
+                {
+                    ascii_consumer.Initialize(frame_file);
+                    file_processor.ProcessNextFrame();
+                    ascii_consumer.Destroy();
+                    gfxrecon::util::platform::FileClose(frame_file);
+                }
+                else
+                {
+                    GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?",
+                                       frame_filename.c_str());
+                    success = false;
+                }
+            }
+        }
+        else
+        {
+            ascii_consumer.InitializeFragment(shard->output);
+
+            for (size_t i = 0; i < shard->frame_count; ++i)
+            {
+                file_processor.ProcessNextFrame();
+            }
+
+            ascii_consumer.Destroy();
+        }
+
+        shard->success = success && (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+    }
+
+    // Decode allocators are per thread, and must be released by the worker thread that created them.
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+}
+
+static bool AppendShardOutput(FILE* shard_output, FILE* output_file, bool write_separator)
+{
+    bool success = true;
+
+    if (gfxrecon::util::platform::FileTell(shard_output) > 0)
+    {
+        std::vector<uint8_t> buffer(kCopyBufferSize);
+
+        if (write_separator)
+        {
+            fprintf(output_file, ",");
+        }
+
+        rewind(shard_output);
+
+        size_t bytes_read = 0;
+        while ((bytes_read = gfxrecon::util::platform::FileRead(buffer.data(), 1, buffer.size(), shard_output)) > 0)
+        {
+            success = success &&
+                      (gfxrecon::util::platform::FileWrite(buffer.data(), 1, bytes_read, output_file) == bytes_read);
+        }
+
+        success = success && !ferror(shard_output);
+    }
+
+    return success;
+}
+
+// Converts the file with multiple threads, each processing a separate shard of frames. The frame index is built by
+// reading block headers only, so each shard starts decoding from its first frame with the correct API call index.
+static bool ConvertSharded(gfxrecon::decode::FileProcessor* file_processor,
+                           const std::string&               input_filename,
+                           const std::string&               output_filename,
+                           uint32_t                         job_count,
+                           bool                             split_frames)
+{
+    std::vector<gfxrecon::decode::FileProcessor::FramePosition> frames;
+    std::vector<uint64_t>                                       retained_data_offsets;
+
+    if (!file_processor->IndexFrames(&frames, &retained_data_offsets))
+    {
+        GFXRECON_LOG_ERROR("Failed to build the frame index for \"%s\"", input_filename.c_str());
+        return false;
+    }
+
+    std::vector<FrameShard> shards = CreateShards(frames, GetFileSize(input_filename), job_count * kShardsPerJob);
+
+    if (!split_frames)
+    {
+        for (auto& shard : shards)
+        {
+            shard.output = tmpfile();
+
+            if (shard.output == nullptr)
+            {
+                GFXRECON_LOG_ERROR("Failed to create temporary file for frame conversion");
+                for (auto& created : shards)
+                {
+                    if (created.output != nullptr)
+                    {
+                        gfxrecon::util::platform::FileClose(created.output);
+                    }
+                }
+                return false;
+            }
+        }
+    }
+
+    std::atomic<size_t>      next_shard{ 0 };
+    std::vector<std::thread> workers;
+    size_t                   worker_count = std::min<size_t>(job_count, shards.size());
+
+    for (size_t i = 0; i < worker_count; ++i)
+    {
+        workers.emplace_back([&]() {
+            size_t shard_index = 0;
+            while ((shard_index = next_shard++) < shards.size())
+            {
+                ConvertShard(input_filename,
+                             output_filename,
+                             frames,
+                             retained_data_offsets,
+                             split_frames,
+                             &shards[shard_index]);
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    bool success = std::all_of(shards.begin(), shards.end(), [](const FrameShard& shard) { return shard.success; });
+
+    if (!split_frames)
+    {
+        FILE* output_file = nullptr;
+
+        if (gfxrecon::util::platform::StringCompare(output_filename.c_str(), "stdout") == 0)
+        {
+            output_file = stdout;
+        }
+        else
+        {
+            gfxrecon::util::platform::FileOpen(&output_file, output_filename.c_str(), "w");
+        }
+
+        if (output_file != nullptr)
+        {
+            // Reproduce the enclosing braces written by VulkanAsciiConsumer::Initialize() and Destroy().
+            bool write_separator = false;
+            fprintf(output_file, "{");
+
+            for (const auto& shard : shards)
+            {
+                bool has_output = gfxrecon::util::platform::FileTell(shard.output) > 0;
+                success         = AppendShardOutput(shard.output, output_file, write_separator) && success;
+                write_separator = write_separator || has_output;
+            }
+
+            fprintf(output_file, "\n}\n");
+
+            if (output_file != stdout)
+            {
+                gfxrecon::util::platform::FileClose(output_file);
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?", output_filename.c_str());
+            success = false;
+        }
+
+        for (auto& shard : shards)
+        {
+            gfxrecon::util::platform::FileClose(shard.output);
+        }
+    }
+
+    return success;
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
@@ -101,6 +457,30 @@ int main(int argc, const char** argv)
         gfxrecon::util::Log::Release();
         exit(-1);
     }
+
+    uint32_t    job_count    = 1;
+    bool        split_frames = arg_parser.IsOptionSet(kSplitFramesOption);
+    const auto& format       = arg_parser.GetArgumentValue(kFormatArgument);
+    bool        columnar     = (gfxrecon::util::platform::StringCompareNoCase(format.c_str(), kFormatColumnar) == 0);
+    if (!GetJobCount(arg_parser, &job_count))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    if (!format.empty() && !columnar &&
+        (gfxrecon::util::platform::StringCompareNoCase(format.c_str(), kFormatJson) != 0))
+    {
+        GFXRECON_LOG_ERROR("Unrecognized format \"%s\" given for argument \"--format\"", format.c_str());
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    if (columnar && ((job_count > 1) || split_frames))
+    {
+        GFXRECON_LOG_ERROR("The \"--jobs\" and \"--split-frames\" options are not supported for columnar output");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
 #if defined(WIN32) && defined(_DEBUG)
     if (arg_parser.IsOptionSet(kNoDebugPopup))
     {
@@ -110,38 +490,88 @@ int main(int argc, const char** argv)
 
     const auto& positional_arguments = arg_parser.GetPositionalArguments();
     std::string input_filename       = positional_arguments[0];
-    std::string output_filename      = GetOutputFileName(arg_parser, input_filename);
+    std::string output_filename      = GetOutputFileName(arg_parser, input_filename, columnar);
+
+    if (split_frames && (gfxrecon::util::platform::StringCompare(output_filename.c_str(), "stdout") == 0))
+    {
+        GFXRECON_LOG_ERROR("Option \"--split-frames\" requires an output file path; 'stdout' is not supported");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        FILE* output_file = nullptr;
-        if (gfxrecon::util::platform::StringCompare(output_filename.c_str(), "stdout") == 0)
+        if ((job_count > 1) || split_frames)
         {
-            output_file = stdout;
+            if (!ConvertSharded(&file_processor, input_filename, output_filename, job_count, split_frames))
+            {
+                GFXRECON_LOG_ERROR("Failed to convert \"%s\"", input_filename.c_str());
+            }
         }
-        else
+        else if (columnar)
         {
-            gfxrecon::util::platform::FileOpen(&output_file, output_filename.c_str(), "w");
-        }
+            FILE* output_file = nullptr;
+            if (gfxrecon::util::platform::StringCompare(output_filename.c_str(), "stdout") == 0)
+            {
+                output_file = stdout;
+            }
+            else
+            {
+                gfxrecon::util::platform::FileOpen(&output_file, output_filename.c_str(), "wb");
+            }
 
-        if (output_file)
-        {
-            gfxrecon::decode::VulkanAsciiConsumer ascii_consumer;
-            ascii_consumer.Initialize(output_file);
-            gfxrecon::decode::VulkanDecoder decoder;
-            decoder.AddConsumer(&ascii_consumer);
-            file_processor.AddDecoder(&decoder);
-            file_processor.ProcessAllFrames();
-            ascii_consumer.Destroy();
-            if (output_file != stdout)
+            if (output_file)
             {
-                gfxrecon::util::platform::FileClose(output_file);
+                gfxrecon::decode::VulkanExportConsumer export_consumer;
+                export_consumer.Initialize(output_file);
+                gfxrecon::decode::VulkanDecoder decoder;
+                decoder.AddConsumer(&export_consumer);
+                file_processor.AddDecoder(&decoder);
+                file_processor.ProcessAllFrames();
+                export_consumer.Destroy();
+                if (output_file != stdout)
+                {
+                    gfxrecon::util::platform::FileClose(output_file);
+                }
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?",
+                                   output_filename.c_str());
             }
         }
         else
         {
-            GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?", output_filename.c_str());
+            FILE* output_file = nullptr;
+            if (gfxrecon::util::platform::StringCompare(output_filename.c_str(), "stdout") == 0)
+            {
+                output_file = stdout;
+            }
+            else
+            {
+                gfxrecon::util::platform::FileOpen(&output_file, output_filename.c_str(), "w");
+            }
+
+            if (output_file)
+            {
+                gfxrecon::decode::VulkanAsciiConsumer ascii_consumer;
+                ascii_consumer.Initialize(output_file);
+                gfxrecon::decode::VulkanDecoder decoder;
+                decoder.AddConsumer(&ascii_consumer);
+                file_processor.AddDecoder(&decoder);
+                file_processor.ProcessAllFrames();
+                ascii_consumer.Destroy();
+                if (output_file != stdout)
+                {
+                    gfxrecon::util::platform::FileClose(output_file);
+                }
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?",
+                                   output_filename.c_str());
+            }
         }
     }
 
@@ -71,6 +71,8 @@ const char kWsiArgument[]                      = "--wsi";
 const char kSurfaceIndexArgument[]             = "--surface-index";
 const char kMemoryPortabilityShortOption[]     = "-m";
 const char kMemoryPortabilityLongOption[]      = "--memory-translation";
+const char kPoolMemoryOption[]                 = "--pool-memory";
+const char kAsyncPipelinesOption[]             = "--async-pipelines";
 const char kSyncOption[]                       = "--sync";
 const char kRemoveUnsupportedOption[]          = "--remove-unsupported";
 const char kValidateOption[]                   = "--validate";
@@ -84,7 +86,14 @@ const char kScreenshotRangeArgument[]          = "--screenshots";
 const char kScreenshotFormatArgument[]         = "--screenshot-format";
 const char kScreenshotDirArgument[]            = "--screenshot-dir";
 const char kScreenshotFilePrefixArgument[]     = "--screenshot-prefix";
+const char kScreenshotAsyncOption[]            = "--screenshot-async";
 const char kOutput[]                           = "--output";
+const char kProfileOption[]                    = "--profile";
+const char kProfileTraceArgument[]             = "--profile-trace";
+const char kFrameStatisticsArgument[]          = "--frame-stats";
+const char kLoopFramesArgument[]               = "--loop-frames";
+const char kLoopCountArgument[]                = "--loop-count";
+const char kPreloadArgument[]                  = "--preload";
 #if defined(WIN32)
 const char kApiFamilyOption[] = "--api";
 #endif
@@ -118,7 +127,10 @@ const char kApiFamilyVulkan[] = "vulkan";
 const char kApiFamilyAll[]    = "all";
 #endif
 
-const char kScreenshotFormatBmp[] = "bmp";
+const char kScreenshotFormatBmp[]  = "bmp";
+const char kScreenshotFormatPng[]  = "png";
+const char kScreenshotFormatQoi[]  = "qoi";
+const char kScreenshotFormatHash[] = "hash";
 
 #if defined(__ANDROID__)
 const char kDefaultScreenshotDir[] = "/sdcard";
@@ -177,12 +189,28 @@ static gfxrecon::decode::VulkanResourceAllocator* CreateDefaultAllocator()
         "Try replay with the '-m remap' or '-m rebind' options to enable memory translation.");
 }
 
+static gfxrecon::decode::VulkanResourceAllocator* CreatePooledDefaultAllocator()
+{
+    auto allocator = new gfxrecon::decode::VulkanDefaultAllocator(
+        "Try replay with the '-m remap' or '-m rebind' options to enable memory translation.");
+    allocator->SetMemoryPoolBlockSize(gfxrecon::decode::VulkanDefaultAllocator::kDefaultMemoryPoolBlockSize);
+    return allocator;
+}
+
 static gfxrecon::decode::VulkanResourceAllocator* CreateRemapAllocator()
 {
     return new gfxrecon::decode::VulkanRemapAllocator(
         "Try replay with the '-m rebind' option to enable advanced memory translation.");
 }
 
+static gfxrecon::decode::VulkanResourceAllocator* CreatePooledRemapAllocator()
+{
+    auto allocator = new gfxrecon::decode::VulkanRemapAllocator(
+        "Try replay with the '-m rebind' option to enable advanced memory translation.");
+    allocator->SetMemoryPoolBlockSize(gfxrecon::decode::VulkanDefaultAllocator::kDefaultMemoryPoolBlockSize);
+    return allocator;
+}
+
 static gfxrecon::decode::VulkanResourceAllocator* CreateRebindAllocator()
 {
     return new gfxrecon::decode::VulkanRebindAllocator();
@@ -191,7 +219,8 @@ static gfxrecon::decode::VulkanResourceAllocator* CreateRebindAllocator()
 static gfxrecon::decode::CreateResourceAllocator
 InitRealignAllocatorCreateFunc(const std::string&                              filename,
                                const gfxrecon::decode::VulkanReplayOptions&    replay_options,
-                               gfxrecon::decode::VulkanTrackedObjectInfoTable* tracked_object_info_table)
+                               gfxrecon::decode::VulkanTrackedObjectInfoTable* tracked_object_info_table,
+                               bool                                            pool_memory)
 {
     // Enable first pass of replay to generate resource tracking information.
     GFXRECON_WRITE_CONSOLE("First pass of replay resource tracking for realign memory portability mode. This may take "
@@ -220,9 +249,16 @@ InitRealignAllocatorCreateFunc(const std::string&                              f
 
     GFXRECON_WRITE_CONSOLE("First pass of replay resource tracking done.");
 
-    return [tracked_object_info_table]() -> gfxrecon::decode::VulkanResourceAllocator* {
-        return new gfxrecon::decode::VulkanRealignAllocator(
+    return [tracked_object_info_table, pool_memory]() -> gfxrecon::decode::VulkanResourceAllocator* {
+        auto allocator = new gfxrecon::decode::VulkanRealignAllocator(
             tracked_object_info_table, "Try replay with the '-m rebind' option to enable advanced memory translation.");
+
+        if (pool_memory)
+        {
+            allocator->SetMemoryPoolBlockSize(gfxrecon::decode::VulkanDefaultAllocator::kDefaultMemoryPoolBlockSize);
+        }
+
+        return allocator;
     };
 }
 
@@ -243,6 +279,81 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+static bool GetLoopFrames(const gfxrecon::util::ArgumentParser& arg_parser,
+                          uint32_t*                             first_frame,
+                          uint32_t*                             last_frame,
+                          uint32_t*                             loop_count)
+{
+    const auto& value = arg_parser.GetArgumentValue(kLoopFramesArgument);
+
+    if (value.empty())
+    {
+        return false;
+    }
+
+    std::vector<gfxrecon::util::FrameRange> frame_ranges = gfxrecon::util::GetFrameRanges(value);
+
+    if (frame_ranges.empty())
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid loop frame range \"%s\"", value.c_str());
+        return false;
+    }
+    else if (frame_ranges.size() > 1)
+    {
+        GFXRECON_LOG_WARNING("Only the first frame range specified with %s will be looped", kLoopFramesArgument);
+    }
+
+    *first_frame = frame_ranges[0].first;
+    *last_frame  = frame_ranges[0].last;
+    *loop_count  = 1;
+
+    const auto& count_value = arg_parser.GetArgumentValue(kLoopCountArgument);
+    if (!count_value.empty())
+    {
+        int count = std::stoi(count_value);
+
+        if (count > 0)
+        {
+            *loop_count = static_cast<uint32_t>(count);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid loop count %s", count_value.c_str());
+        }
+    }
+
+    return true;
+}
+
+static bool GetPreloadFrames(const gfxrecon::util::ArgumentParser& arg_parser,
+                             uint32_t*                             first_frame,
+                             uint32_t*                             last_frame)
+{
+    const auto& value = arg_parser.GetArgumentValue(kPreloadArgument);
+
+    if (value.empty())
+    {
+        return false;
+    }
+
+    std::vector<gfxrecon::util::FrameRange> frame_ranges = gfxrecon::util::GetFrameRanges(value);
+
+    if (frame_ranges.empty())
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid preload frame range \"%s\"", value.c_str());
+        return false;
+    }
+    else if (frame_ranges.size() > 1)
+    {
+        GFXRECON_LOG_WARNING("Only the first frame range specified with %s will be preloaded", kPreloadArgument);
+    }
+
+    *first_frame = frame_ranges[0].first;
+    *last_frame  = frame_ranges[0].last;
+
+    return true;
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -415,6 +526,22 @@ static gfxrecon::decode::ScreenshotFormat GetScreenshotFormat(const gfxrecon::ut
         {
             format = gfxrecon::decode::ScreenshotFormat::kBmp;
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatPng, value.c_str()) == 0)
+        {
+#if defined(ENABLE_ZLIB_COMPRESSION)
+            format = gfxrecon::decode::ScreenshotFormat::kPng;
+#else
+            GFXRECON_LOG_WARNING("PNG screenshots require zlib support, which is not available; using BMP");
+#endif
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatQoi, value.c_str()) == 0)
+        {
+            format = gfxrecon::decode::ScreenshotFormat::kQoi;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatHash, value.c_str()) == 0)
+        {
+            format = gfxrecon::decode::ScreenshotFormat::kHash;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecognized screenshot format option \"%s\"", value.c_str());
@@ -475,22 +602,35 @@ GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser&           a
                                const gfxrecon::decode::VulkanReplayOptions&    replay_options,
                                gfxrecon::decode::VulkanTrackedObjectInfoTable* tracked_object_info_table)
 {
-    gfxrecon::decode::CreateResourceAllocator func  = CreateDefaultAllocator;
-    const auto&                               value = arg_parser.GetArgumentValue(kMemoryPortabilityShortOption);
+    gfxrecon::decode::CreateResourceAllocator func        = CreateDefaultAllocator;
+    bool                                      pool_memory = arg_parser.IsOptionSet(kPoolMemoryOption);
+    const auto&                               value       = arg_parser.GetArgumentValue(kMemoryPortabilityShortOption);
+
+    if (pool_memory)
+    {
+        func = CreatePooledDefaultAllocator;
+    }
 
     if (!value.empty())
     {
         if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRebind, value.c_str()) == 0)
         {
+            if (pool_memory)
+            {
+                GFXRECON_LOG_WARNING("Ignoring %s option: allocations are already pooled by the \"-m %s\" mode",
+                                     kPoolMemoryOption,
+                                     kMemoryTranslationRebind);
+            }
+
             func = CreateRebindAllocator;
         }
         else if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRemap, value.c_str()) == 0)
         {
-            func = CreateRemapAllocator;
+            func = pool_memory ? CreatePooledRemapAllocator : CreateRemapAllocator;
         }
         else if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationRealign, value.c_str()) == 0)
         {
-            func = InitRealignAllocatorCreateFunc(filename, replay_options, tracked_object_info_table);
+            func = InitRealignAllocatorCreateFunc(filename, replay_options, tracked_object_info_table, pool_memory);
         }
         else if (gfxrecon::util::platform::StringCompareNoCase(kMemoryTranslationNone, value.c_str()) != 0)
         {
@@ -628,6 +768,9 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
     replay_options.screenshot_format      = GetScreenshotFormat(arg_parser);
     replay_options.screenshot_dir         = GetScreenshotDir(arg_parser);
     replay_options.screenshot_file_prefix = arg_parser.GetArgumentValue(kScreenshotFilePrefixArgument);
+    replay_options.screenshot_async       = arg_parser.IsOptionSet(kScreenshotAsyncOption);
+
+    replay_options.async_pipeline_creation = arg_parser.IsOptionSet(kAsyncPipelinesOption);
 
     std::string surface_index = arg_parser.GetArgumentValue(kSurfaceIndexArgument);
     if (!surface_index.empty())